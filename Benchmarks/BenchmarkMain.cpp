@@ -0,0 +1,201 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/catch_session.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+// =============================================================================
+// VREditorBenchmarks - Catch2 benchmarks checked against a baseline
+// =============================================================================
+// Runs like any Catch2 binary, plus:
+//   --results <file>     write every benchmark's mean (and spread) as JSON
+//   --baseline <file>    compare against a baseline; exit non-zero on regression
+//   --update-baseline    rewrite the baseline's means from this run, keeping
+//                        its tolerances (use with --baseline)
+//
+// Baseline format (Benchmarks/baseline.json):
+//   { "tolerance": 0.25,
+//     "benchmarks": { "<name>": { "meanNs": 1234.5, "tolerance": 0.4 }, ... } }
+// A benchmark regresses when its mean exceeds meanNs * (1 + tolerance); the
+// per-benchmark tolerance overrides the file-wide one. Benchmarks missing from
+// the baseline are reported but never fail the run.
+
+namespace {
+    struct BenchmarkResult {
+        std::string name;
+        double meanNs = 0.0;
+        double lowMeanNs = 0.0;
+        double highMeanNs = 0.0;
+        double stdDevNs = 0.0;
+        size_t samples = 0;
+    };
+
+    std::vector<BenchmarkResult> g_results;
+
+    double ToNs(auto duration)
+    {
+        return std::chrono::duration<double, std::nano>(duration).count();
+    }
+
+    class BenchmarkCollector : public Catch::EventListenerBase
+    {
+    public:
+        using EventListenerBase::EventListenerBase;
+
+        void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override
+        {
+            g_results.push_back({ stats.info.name, ToNs(stats.mean.point), ToNs(stats.mean.lower_bound),
+                                  ToNs(stats.mean.upper_bound), ToNs(stats.standardDeviation.point),
+                                  stats.samples.size() });
+        }
+    };
+
+    CATCH_REGISTER_LISTENER(BenchmarkCollector)
+
+    bool WriteJson(const std::filesystem::path& path, const nlohmann::json& json)
+    {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            std::fprintf(stderr, "Cannot write %s\n", path.string().c_str());
+            return false;
+        }
+        file << json.dump(2) << '\n';
+        return static_cast<bool>(file);
+    }
+
+    bool WriteResults(const std::filesystem::path& path)
+    {
+        nlohmann::json benchmarks = nlohmann::json::array();
+        for (const auto& result : g_results) {
+            benchmarks.push_back({
+                { "name", result.name },
+                { "meanNs", result.meanNs },
+                { "lowMeanNs", result.lowMeanNs },
+                { "highMeanNs", result.highMeanNs },
+                { "stdDevNs", result.stdDevNs },
+                { "samples", result.samples },
+            });
+        }
+        return WriteJson(path, { { "benchmarks", benchmarks } });
+    }
+
+    std::optional<nlohmann::json> LoadBaseline(const std::filesystem::path& path)
+    {
+        std::ifstream file(path);
+        if (!file) {
+            return std::nullopt;
+        }
+        auto json = nlohmann::json::parse(file, nullptr, false);
+        if (json.is_discarded() || !json.is_object()) {
+            return std::nullopt;
+        }
+        return json;
+    }
+
+    // Print one line per benchmark; returns the number of regressions
+    int CompareToBaseline(const nlohmann::json& baseline)
+    {
+        const double defaultTolerance = baseline.value("tolerance", 0.25);
+        const auto benchmarks = baseline.value("benchmarks", nlohmann::json::object());
+
+        int regressions = 0;
+        std::printf("\n%-56s %12s %12s %8s\n", "Benchmark", "Baseline ns", "Mean ns", "Change");
+        for (const auto& result : g_results) {
+            auto it = benchmarks.find(result.name);
+            if (it == benchmarks.end()) {
+                std::printf("%-56s %12s %12.1f %8s  (not in baseline)\n", result.name.c_str(), "-", result.meanNs, "-");
+                continue;
+            }
+
+            const double baselineNs = it->value("meanNs", 0.0);
+            const double tolerance = it->value("tolerance", defaultTolerance);
+            const double change = baselineNs > 0.0 ? result.meanNs / baselineNs - 1.0 : 0.0;
+
+            const char* verdict = "";
+            if (change > tolerance) {
+                verdict = "  REGRESSION";
+                regressions++;
+            } else if (change < -tolerance) {
+                verdict = "  (faster - update the baseline)";
+            }
+            std::printf("%-56s %12.1f %12.1f %+7.1f%%%s\n", result.name.c_str(), baselineNs, result.meanNs,
+                        change * 100.0, verdict);
+        }
+
+        if (regressions > 0) {
+            std::printf("\n%d benchmark(s) regressed beyond tolerance\n", regressions);
+        }
+        return regressions;
+    }
+
+    // New means, existing tolerances; benchmarks not run this time are kept
+    void UpdateBaseline(nlohmann::json& baseline)
+    {
+        auto& benchmarks = baseline["benchmarks"];
+        if (!benchmarks.is_object()) {
+            benchmarks = nlohmann::json::object();
+        }
+        for (const auto& result : g_results) {
+            benchmarks[result.name]["meanNs"] = std::round(result.meanNs * 10.0) / 10.0;
+        }
+        if (!baseline.contains("tolerance")) {
+            baseline["tolerance"] = 0.25;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Catch::Session session;
+
+    std::string resultsPath;
+    std::string baselinePath;
+    bool updateBaseline = false;
+
+    using Catch::Clara::Opt;
+    session.cli(session.cli() |
+                Opt(resultsPath, "file")["--results"]("write benchmark results as JSON") |
+                Opt(baselinePath, "file")["--baseline"]("compare against a baseline, fail on regression") |
+                Opt(updateBaseline)["--update-baseline"]("rewrite the baseline means from this run"));
+
+    if (int rc = session.applyCommandLine(argc, argv); rc != 0) {
+        return rc;
+    }
+
+    const int failed = session.run();
+    if (failed != 0) {
+        return failed;
+    }
+
+    if (!resultsPath.empty() && !WriteResults(resultsPath)) {
+        return 1;
+    }
+
+    if (baselinePath.empty()) {
+        return 0;
+    }
+
+    auto baseline = LoadBaseline(baselinePath);
+    if (updateBaseline) {
+        if (!baseline) {
+            baseline = nlohmann::json::object();
+        }
+        UpdateBaseline(*baseline);
+        return WriteJson(baselinePath, *baseline) ? 0 : 1;
+    }
+
+    if (!baseline) {
+        std::fprintf(stderr, "Cannot read baseline %s\n", baselinePath.c_str());
+        return 1;
+    }
+    return CompareToBaseline(*baseline) == 0 ? 0 : 1;
+}
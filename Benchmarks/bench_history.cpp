@@ -0,0 +1,74 @@
+#include <catch2/catch_all.hpp>
+#include "actions/ActionHistoryRepository.h"
+
+#include <random>
+#include <vector>
+
+using namespace Actions;
+
+// =============================================================================
+// ActionHistoryRepository - recording, undoing and redoing edits
+// =============================================================================
+// A session's worth of group moves through the real repository. Headless, form
+// lookups miss, so the registry hooks return early: this measures the history's
+// own bookkeeping (action copies, the ordered map and the redo stack).
+
+namespace {
+    constexpr size_t kActions = 100;
+    constexpr size_t kObjectsPerAction = 10;
+
+    std::vector<std::vector<SingleTransform>> MakeGroupMoves()
+    {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<float> coords(-5000.0f, 5000.0f);
+
+        std::vector<std::vector<SingleTransform>> moves(kActions);
+        for (size_t a = 0; a < kActions; ++a) {
+            moves[a].resize(kObjectsPerAction);
+            for (size_t o = 0; o < kObjectsPerAction; ++o) {
+                auto& st = moves[a][o];
+                st.formId = static_cast<RE::FormID>(0x10C0E3 + o);
+                st.initialTransform.translate = RE::NiPoint3(coords(rng), coords(rng), coords(rng));
+                st.changedTransform.translate = st.initialTransform.translate + RE::NiPoint3(10.0f, 0.0f, 0.0f);
+                st.changedEulerAngles = RE::NiPoint3(0.0f, 0.0f, 0.5f);
+            }
+        }
+        return moves;
+    }
+
+    void Record(ActionHistoryRepository* history, const std::vector<std::vector<SingleTransform>>& moves)
+    {
+        for (const auto& move : moves) {
+            auto transforms = move;
+            history->AddMultiTransform(std::move(transforms));
+        }
+    }
+}
+
+TEST_CASE("ActionHistoryRepository add/undo/redo", "[benchmark][history]") {
+    auto* history = ActionHistoryRepository::GetSingleton();
+    const auto moves = MakeGroupMoves();
+
+    BENCHMARK("ActionHistoryRepository add 100 group moves") {
+        history->Clear();
+        Record(history, moves);
+        return history->Count();
+    };
+
+    history->Clear();
+    Record(history, moves);
+
+    // Every action undone and redone again, so each run starts from the same history
+    BENCHMARK("ActionHistoryRepository undo+redo 100 group moves") {
+        size_t steps = 0;
+        while (history->Undo()) {
+            steps++;
+        }
+        while (history->Redo()) {
+            steps++;
+        }
+        return steps;
+    };
+
+    history->Clear();
+}
@@ -0,0 +1,103 @@
+#include <catch2/catch_all.hpp>
+#include "persistence/FormKeyUtil.h"
+#include "persistence/IniLineFormat.h"
+#include "util/JobSystem.h"
+
+#include <format>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Persistence;
+
+// =============================================================================
+// JobSystem - scaling of a batch of export formatting across worker counts
+// =============================================================================
+// The same work (_SWAP.ini lines for a large batch of references, split into
+// ParallelFor chunks) on 1, 2 and 4 workers, next to the inline loop. The ratios
+// only mean something on a machine with that many free cores.
+
+namespace {
+    constexpr size_t kLines = 16000;
+    constexpr size_t kGrain = 500;
+
+    struct Reference {
+        std::string formKey;
+        RE::NiPoint3 position;
+        RE::NiPoint3 rotation;
+        float scale;
+    };
+
+    std::vector<Reference> MakeReferences()
+    {
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> coords(-50000.0f, 50000.0f);
+        std::uniform_real_distribution<float> angles(-180.0f, 180.0f);
+
+        std::vector<Reference> references(kLines);
+        for (size_t i = 0; i < kLines; ++i) {
+            references[i].formKey = FormKeyUtil::BuildFormKey(static_cast<RE::FormID>(0x10C0E3 + i * 7), "Skyrim.esm");
+            references[i].position = RE::NiPoint3(coords(rng), coords(rng), coords(rng));
+            references[i].rotation = RE::NiPoint3(0.0f, 0.0f, angles(rng));
+            references[i].scale = 1.0f;
+        }
+        return references;
+    }
+
+    // One chunk's lines into its own buffer, as a per-cell export would
+    size_t FormatChunk(const std::vector<Reference>& references, size_t begin, size_t end)
+    {
+        std::string out;
+        for (size_t i = begin; i < end; ++i) {
+            const auto& ref = references[i];
+            IniLineFormat::AppendSwapLine(out, ref.formKey, ref.position, ref.rotation, ref.scale, 0);
+            out += '\n';
+        }
+        return out.size();
+    }
+
+    size_t FormatAll(Util::JobSystem& jobs, const std::vector<Reference>& references)
+    {
+        std::vector<size_t> sizes(references.size() / kGrain + 1);
+        jobs.ParallelFor(references.size(), kGrain, [&](size_t begin, size_t end) {
+            sizes[begin / kGrain] = FormatChunk(references, begin, end);
+        });
+
+        size_t total = 0;
+        for (size_t size : sizes) {
+            total += size;
+        }
+        return total;
+    }
+}
+
+TEST_CASE("JobSystem scaling", "[benchmark][jobs]") {
+    const auto references = MakeReferences();
+
+    BENCHMARK("JobSystem format 16000 lines, inline") {
+        return FormatChunk(references, 0, references.size());
+    };
+
+    for (size_t workers : { 1, 2, 4 }) {
+        Util::JobSystem jobs;
+        jobs.Start(workers);
+
+        BENCHMARK(std::format("JobSystem format 16000 lines, {} worker{}", workers, workers == 1 ? "" : "s")) {
+            return FormatAll(jobs, references);
+        };
+    }
+}
+
+TEST_CASE("JobSystem fork/join overhead", "[benchmark][jobs]") {
+    Util::JobSystem jobs;
+    jobs.Start(4);
+
+    BENCHMARK("JobSystem fork/join 1000 empty jobs") {
+        Util::JobGroup group(&jobs);
+        for (size_t i = 0; i < 1000; ++i) {
+            group.Run([] {});
+        }
+        group.Wait();
+        return 0;
+    };
+}
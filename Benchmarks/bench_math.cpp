@@ -0,0 +1,166 @@
+#include <catch2/catch_all.hpp>
+#include "grab/TransformSmoother.h"
+#include "util/RotationMath.h"
+#include "util/SimdMath.h"
+
+#include <format>
+#include <random>
+#include <vector>
+
+// =============================================================================
+// Math - rotation helpers and transform smoothing, batched over 1000 inputs
+// =============================================================================
+
+namespace {
+    constexpr size_t kCount = 1000;
+
+    std::vector<RE::NiPoint3> RandomAngles(uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> angle(-3.14159f, 3.14159f);
+        std::vector<RE::NiPoint3> angles(kCount);
+        for (auto& a : angles) {
+            a = RE::NiPoint3(angle(rng), angle(rng), angle(rng));
+        }
+        return angles;
+    }
+
+    std::vector<RE::NiMatrix3> ToMatrices(const std::vector<RE::NiPoint3>& angles)
+    {
+        std::vector<RE::NiMatrix3> matrices;
+        matrices.reserve(angles.size());
+        for (const auto& a : angles) {
+            matrices.push_back(Util::RotationMath::EulerToMatrix(a));
+        }
+        return matrices;
+    }
+
+    std::vector<RE::NiPoint3> RandomPoints(size_t count, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> coord(-5000.0f, 5000.0f);
+        std::vector<RE::NiPoint3> points(count);
+        for (auto& p : points) {
+            p = RE::NiPoint3(coord(rng), coord(rng), coord(rng));
+        }
+        return points;
+    }
+
+    // The scalar code SimdMath replaced, kept here as the comparison point
+    RE::NiMatrix3 ScalarMultiply(const RE::NiMatrix3& a, const RE::NiMatrix3& b)
+    {
+        RE::NiMatrix3 result;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                result.entry[i][j] = a.entry[i][0] * b.entry[0][j] + a.entry[i][1] * b.entry[1][j] +
+                                     a.entry[i][2] * b.entry[2][j];
+            }
+        }
+        return result;
+    }
+
+    RE::NiPoint3 ScalarRotateAround(const RE::NiMatrix3& m, const RE::NiPoint3& center, const RE::NiPoint3& p)
+    {
+        const RE::NiPoint3 d = { p.x - center.x, p.y - center.y, p.z - center.z };
+        return { center.x + (m.entry[0][0] * d.x + m.entry[0][1] * d.y + m.entry[0][2] * d.z),
+                 center.y + (m.entry[1][0] * d.x + m.entry[1][1] * d.y + m.entry[1][2] * d.z),
+                 center.z + (m.entry[2][0] * d.x + m.entry[2][1] * d.y + m.entry[2][2] * d.z) };
+    }
+}
+
+TEST_CASE("RotationMath batches", "[benchmark][math]") {
+    const auto angles = RandomAngles(1);
+    const auto matrices = ToMatrices(angles);
+    std::vector<RE::NiMatrix3> outMatrices(kCount);
+
+    BENCHMARK("RotationMath::EulerToMatrix x1000") {
+        for (size_t i = 0; i < kCount; ++i) {
+            outMatrices[i] = Util::RotationMath::EulerToMatrix(angles[i]);
+        }
+        return outMatrices[kCount / 2].entry[1][1];
+    };
+
+    BENCHMARK("RotationMath::ExtractZRotation x1000") {
+        float sum = 0.0f;
+        for (const auto& m : matrices) {
+            sum += Util::RotationMath::ExtractZRotation(m);
+        }
+        return sum;
+    };
+
+    BENCHMARK("RotationMath::RotatePointAroundZ x1000") {
+        const RE::NiPoint3 origin(100.0f, -50.0f, 0.0f);
+        float sum = 0.0f;
+        for (size_t i = 0; i < kCount; ++i) {
+            sum += Util::RotationMath::RotatePointAroundZ(angles[i] * 100.0f, origin, angles[i].z).x;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("TransformSmoother", "[benchmark][math]") {
+    const auto from = ToMatrices(RandomAngles(2));
+    const auto to = ToMatrices(RandomAngles(3));
+
+    BENCHMARK("TransformSmoother::LerpRotation x1000") {
+        float sum = 0.0f;
+        for (size_t i = 0; i < kCount; ++i) {
+            sum += Grab::TransformSmoother::LerpRotation(from[i], to[i], 0.3f).entry[0][0];
+        }
+        return sum;
+    };
+
+    // A grabbed object chasing a new hand target every frame at 90 Hz
+    BENCHMARK("TransformSmoother::Update x1000 frames") {
+        Grab::TransformSmoother smoother;
+        RE::NiTransform target;
+        smoother.SetCurrent(target);
+        for (size_t i = 0; i < kCount; ++i) {
+            target.rotate = to[i];
+            target.translate = RE::NiPoint3(static_cast<float>(i), 0.0f, 100.0f);
+            smoother.SetTarget(target);
+            smoother.Update(1.0f / 90.0f);
+        }
+        return smoother.GetCurrent().translate.x;
+    };
+}
+
+TEST_CASE("SimdMath against scalar", "[benchmark][math]") {
+    const auto a = ToMatrices(RandomAngles(4));
+    const auto b = ToMatrices(RandomAngles(5));
+    std::vector<RE::NiMatrix3> out(kCount);
+
+    BENCHMARK("Scalar multiply x1000") {
+        for (size_t i = 0; i < kCount; ++i) {
+            out[i] = ScalarMultiply(a[i], b[i]);
+        }
+        return out[kCount / 2].entry[1][1];
+    };
+
+    BENCHMARK("SimdMath::Multiply x1000") {
+        for (size_t i = 0; i < kCount; ++i) {
+            out[i] = Util::SimdMath::Multiply(a[i], b[i]);
+        }
+        return out[kCount / 2].entry[1][1];
+    };
+
+    // Group rotation around a grab center, as RemoteGrabController does per frame
+    const RE::NiMatrix3 rotation = a[0];
+    const RE::NiPoint3 center(100.0f, -200.0f, 50.0f);
+    const auto points = RandomPoints(kCount, 6);
+    std::vector<RE::NiPoint3> rotated(kCount);
+
+    for (size_t count : { 1, 10, 100, 1000 }) {
+        BENCHMARK(std::format("Scalar rotate around center, {} points", count)) {
+            for (size_t i = 0; i < count; ++i) {
+                rotated[i] = ScalarRotateAround(rotation, center, points[i]);
+            }
+            return rotated[count - 1].x;
+        };
+
+        BENCHMARK(std::format("SimdMath::RotatePointsAround, {} points", count)) {
+            Util::SimdMath::RotatePointsAround(rotation, center, std::span(points).first(count), rotated);
+            return rotated[count - 1].x;
+        };
+    }
+}
@@ -0,0 +1,265 @@
+#include <catch2/catch_all.hpp>
+#include "persistence/AddedObjectsParser.h"
+#include "persistence/BaseObjectSwapperParser.h"
+#include "persistence/CellBinaryConverter.h"
+#include "persistence/ChangedObjectRegistry.h"
+#include "persistence/EntryMetadata.h"
+#include "persistence/ExportBuilder.h"
+#include "persistence/FormKeyUtil.h"
+#include "persistence/IniLineFormat.h"
+
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Persistence;
+
+// =============================================================================
+// Persistence - INI line parsing/writing, comment metadata and form keys
+// =============================================================================
+// Text is generated in memory so the numbers measure the parsers and formatters,
+// not the disk. The ParseIniFile cases read a temp file the loaders' way; it
+// stays in the OS cache between runs.
+
+namespace {
+    constexpr size_t kEntries = 1000;
+
+    const char* const kPlugins[] = { "Skyrim.esm", "Update.esm", "Dawnguard.esm", "HearthFires.esm",
+                                     "Dragonborn.esm", "VREditorTest.esp" };
+    const char* const kMeshes[] = { "Clutter\\Barrel01.nif", "Clutter\\Common\\WoodenBowl01.nif",
+                                    "Architecture\\Whiterun\\WRClutter\\WRTable01.nif",
+                                    "Furniture\\Common\\Chair01.nif" };
+
+    // Cell's worth of moved and deleted references with full metadata
+    std::vector<BOSTransformEntry> MakeEntries(size_t count = kEntries)
+    {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> coords(-50000.0f, 50000.0f);
+        std::uniform_real_distribution<float> angles(0.0f, 360.0f);
+
+        std::vector<BOSTransformEntry> entries(count);
+        for (size_t i = 0; i < count; ++i) {
+            auto& entry = entries[i];
+            entry.formKeyString = FormKeyUtil::BuildFormKey(static_cast<RE::FormID>(0x10C0E3 + i * 17),
+                                                            kPlugins[i % std::size(kPlugins)]);
+            entry.position = RE::NiPoint3(coords(rng), coords(rng), coords(rng) * 0.1f);
+            entry.rotation = RE::NiPoint3(0.0f, 0.0f, angles(rng));
+            entry.scale = (i % 5 == 0) ? 1.25f : 1.0f;
+            entry.editorId = std::format("WRClutterBarrel{:04}", i);
+            entry.displayName = (i % 3 == 0) ? "" : "Barrel";
+            entry.meshName = kMeshes[i % std::size(kMeshes)];
+            entry.isDeleted = (i % 20 == 0);
+        }
+        return entries;
+    }
+
+    std::string WriteCell(const std::vector<BOSTransformEntry>& entries)
+    {
+        std::vector<const BOSTransformEntry*> moved;
+        std::vector<const BOSTransformEntry*> deleted;
+        std::vector<std::string> formKeys;
+        for (const auto& entry : entries) {
+            (entry.isDeleted ? deleted : moved).push_back(&entry);
+            formKeys.push_back(entry.formKeyString);
+        }
+
+        std::ostringstream out;
+        BaseObjectSwapperParser::WriteFileHeader(out);
+        out << "[Transforms]\n";
+        BaseObjectSwapperParser::WriteCellSection(out, "WhiterunBreezehome", "0x165A7~Skyrim.esm", moved, deleted,
+                                                  CollectPluginNames(formKeys));
+        return std::move(out).str();
+    }
+}
+
+TEST_CASE("EntryMetadata comment lines", "[benchmark][persistence]") {
+    const auto entries = MakeEntries();
+    std::vector<std::string> comments;
+    std::vector<EntryMetadata> metadata;
+    for (const auto& entry : entries) {
+        comments.push_back(entry.ToCommentLine());
+        metadata.push_back(entry.GetMetadata());
+    }
+
+    BENCHMARK("EntryMetadata::ParseFromComment x1000") {
+        size_t parsed = 0;
+        EntryMetadata out;
+        for (const auto& comment : comments) {
+            parsed += EntryMetadata::ParseFromComment(comment, out);
+        }
+        return parsed;
+    };
+
+    BENCHMARK("EntryMetadata::ToCommentLine x1000") {
+        size_t bytes = 0;
+        for (const auto& entry : metadata) {
+            bytes += entry.ToCommentLine().size();
+        }
+        return bytes;
+    };
+}
+
+TEST_CASE("FormKeyUtil key strings", "[benchmark][persistence]") {
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < kEntries; ++i) {
+        keys.push_back(FormKeyUtil::BuildFormKey(static_cast<RE::FormID>(0x800 + i * 4099),
+                                                 kPlugins[i % std::size(kPlugins)]));
+    }
+
+    BENCHMARK("FormKeyUtil::ParseFormKey x1000") {
+        RE::FormID sum = 0;
+        for (const auto& key : keys) {
+            if (auto parsed = FormKeyUtil::ParseFormKey(key)) {
+                sum += parsed->localFormId;
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("FormKeyUtil::BuildFormKey x1000") {
+        size_t bytes = 0;
+        for (size_t i = 0; i < kEntries; ++i) {
+            bytes += FormKeyUtil::BuildFormKey(static_cast<RE::FormID>(0x800 + i * 4099),
+                                               kPlugins[i % std::size(kPlugins)]).size();
+        }
+        return bytes;
+    };
+}
+
+TEST_CASE("BOS _SWAP.ini parsing and writing", "[benchmark][persistence]") {
+    const auto entries = MakeEntries();
+
+    // BaseObjectSwapperParser::ParseIniFile on a written cell file. Property
+    // parsing builds its regexes per line, so a smaller cell keeps the run time
+    // reasonable.
+    const auto path = std::filesystem::temp_directory_path() / "VREditor_Bench_SWAP.ini";
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << WriteCell(MakeEntries(100));
+    }
+    auto* parser = BaseObjectSwapperParser::GetSingleton();
+    REQUIRE(parser->ParseIniFile(path).size() == 100);
+
+    BENCHMARK("BOS ParseIniFile, 100 entries") {
+        return parser->ParseIniFile(path).size();
+    };
+    std::filesystem::remove(path);
+
+    BENCHMARK("BOS write cell, 1000 entries") {
+        return WriteCell(entries).size();
+    };
+}
+
+TEST_CASE("AddedObjects parsing and line writing", "[benchmark][persistence]") {
+    const auto entries = MakeEntries();
+
+    // AddedObjectsParser::ParseIniFile on a cell file from its own writer
+    std::vector<AddedObjectEntry> added(100);
+    for (size_t i = 0; i < added.size(); ++i) {
+        added[i].baseFormString = entries[i].formKeyString;
+        added[i].position = entries[i].position;
+        added[i].rotation = entries[i].rotation;
+        added[i].scale = entries[i].scale;
+        added[i].SetMetadata(entries[i].GetMetadata());
+    }
+    const auto path = std::filesystem::temp_directory_path() / "VREditor_Bench_AddedObjects.ini";
+    std::filesystem::remove(path);
+    auto* parser = AddedObjectsParser::GetSingleton();
+    REQUIRE(parser->WriteIniFile(path, "0x165A7~Skyrim.esm", "WhiterunBreezehome", added));
+    REQUIRE(parser->ParseIniFile(path).entries.size() == added.size());
+
+    BENCHMARK("AddedObjects ParseIniFile, 100 entries") {
+        return parser->ParseIniFile(path).entries.size();
+    };
+    std::filesystem::remove(path);
+
+    BENCHMARK("AddedObjects lines x1000") {
+        std::string out;
+        for (const auto& entry : entries) {
+            IniLineFormat::AppendCommentLine(out, entry.editorId, entry.displayName, entry.meshName, {});
+            out += '\n';
+            IniLineFormat::AppendAddedObjectLine(out, entry.formKeyString, entry.position, entry.rotation, entry.scale);
+            out += "\n\n";
+        }
+        return out.size();
+    };
+}
+
+TEST_CASE("Cell binary files", "[benchmark][persistence]") {
+    const auto entries = MakeEntries();
+    const auto bytes = CellBinary::FromTransforms(entries, "0x165A7~Skyrim.esm", "WhiterunBreezehome");
+
+    // View::Open needs 4-byte alignment, as a memory map provides
+    std::vector<uint32_t> words((bytes.size() + 3) / 4);
+    std::memcpy(words.data(), bytes.data(), bytes.size());
+    const std::span<const std::byte> file(reinterpret_cast<const std::byte*>(words.data()), bytes.size());
+
+    BENCHMARK("CellBinary build cell, 1000 entries") {
+        return CellBinary::FromTransforms(entries).size();
+    };
+
+    // Same rows the INI parse above produces, ten times as many
+    BENCHMARK("CellBinary read cell, 1000 entries") {
+        return CellBinary::ToTransforms(*CellBinary::View::Open(file)).size();
+    };
+
+    // Loaders that only need transforms read the columns in place
+    BENCHMARK("CellBinary position columns, 1000 entries") {
+        const auto view = CellBinary::View::Open(file);
+        float sum = 0.0f;
+        for (auto column : { CellBinary::Column::PosX, CellBinary::Column::PosY, CellBinary::Column::PosZ }) {
+            for (float value : view->GetFloatColumn(column)) {
+                sum += value;
+            }
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("ChangedObjectRegistry export", "[benchmark][persistence]") {
+    // The registry as a session with a thousand edited references across a few cells
+    // leaves it: every entry captured, so the export reads no game state
+    auto* registry = ChangedObjectRegistry::GetSingleton();
+    registry->Clear();
+
+    const auto entries = MakeEntries();
+    std::vector<std::pair<std::string, ChangedObjectRuntimeData>> registered;
+    std::vector<ChangedObjectRegistry::TransformUpdate> updates;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const auto& entry = entries[i];
+        ChangedObjectRuntimeData data;
+        data.saveData.formKeyString = entry.formKeyString;
+        data.saveData.cellFormKey = FormKeyUtil::BuildFormKey(static_cast<RE::FormID>(0x165A7 + i % 8), "Skyrim.esm");
+        data.saveData.cellEditorId = std::format("WhiterunCell{:02}", i % 8);
+        data.exportRecord.metadata = entry.GetMetadata();
+        registered.emplace_back(entry.formKeyString, std::move(data));
+
+        RE::NiTransform transform;
+        transform.translate = entry.position;
+        transform.scale = entry.scale;
+        updates.push_back({ entry.formKeyString, transform, entry.rotation, "Whiterun" });
+    }
+    registry->ReinsertEntries(std::move(registered));
+
+    BENCHMARK("ChangedObjectRegistry::UpdateCurrentTransforms x1000") {
+        registry->UpdateCurrentTransforms(updates);
+        return registry->Count();
+    };
+
+    BENCHMARK("ChangedObjectRegistry BOS export, 1000 entries") {
+        const auto groups = ExportBuilder::GroupBOSEntries(registry->GetPendingExportEntries());
+        size_t count = 0;
+        for (const auto& [cellFormKey, group] : groups) {
+            count += group.second.size();
+        }
+        return count;
+    };
+
+    registry->Clear();
+}
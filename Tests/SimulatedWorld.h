@@ -0,0 +1,214 @@
+#pragma once
+
+#include "TestStubs.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <optional>
+#include <random>
+#include <vector>
+
+// =============================================================================
+// SimulatedWorld - a populated fake cell for running world queries headless
+// =============================================================================
+// Owns references, their 3D (bounds, collision layer, optional rigid body) and
+// base forms, and attaches its cell to RE::TES so ForEachReferenceInRange on
+// either the TES or the cell sees the population. One world at a time - the
+// destructor detaches the cell again.
+//
+// Usage:
+//   SimulatedWorld world({ .referenceCount = 10000 });
+//   RE::PlayerCharacter::GetSingleton()->SetPosition(...);
+//   Util::WorldQuery::CollectInSphere(RE::TES::GetSingleton(), player, ...);
+
+class SimulatedWorld
+{
+public:
+    struct Config {
+        size_t referenceCount = 0;
+        float halfExtent = 4096.0f;  // References spread over [-halfExtent, halfExtent] in x/y
+        float height = 512.0f;       // ... and [0, height] in z
+        float minRadius = 8.0f;      // Bound sphere radius range
+        float maxRadius = 64.0f;
+        uint32_t seed = 1;
+    };
+
+    struct ReferenceSpec {
+        RE::FormType type = RE::FormType::Misc;
+        RE::COL_LAYER layer = RE::COL_LAYER::kClutter;
+        RE::NiPoint3 position;
+        float radius = 16.0f;
+        bool hasPhysics = true;  // Adds a rigid body with an AABB of the bound's size
+    };
+
+    struct PickResult {
+        RE::TESObjectREFR* ref = nullptr;
+        float distance = 0.0f;
+        RE::NiPoint3 hitPoint;
+        RE::NiPoint3 hitNormal;  // Outward bound-sphere normal at hitPoint
+    };
+
+    SimulatedWorld() :
+        SimulatedWorld(Config{})
+    {}
+
+    explicit SimulatedWorld(const Config& config) :
+        m_config(config)
+    {
+        m_cell.formID = 0x0000003C;
+        RE::TES::GetSingleton()->loadedCells.push_back(&m_cell);
+        Populate();
+    }
+
+    ~SimulatedWorld()
+    {
+        auto& cells = RE::TES::GetSingleton()->loadedCells;
+        cells.erase(std::remove(cells.begin(), cells.end(), &m_cell), cells.end());
+    }
+
+    SimulatedWorld(const SimulatedWorld&) = delete;
+    SimulatedWorld& operator=(const SimulatedWorld&) = delete;
+
+    RE::TESObjectCELL* GetCell() { return &m_cell; }
+    const std::vector<RE::TESObjectREFR*>& GetReferences() const { return m_cell.references; }
+
+    RE::TESObjectREFR* AddReference(const ReferenceSpec& spec)
+    {
+        auto& node = m_nodes.emplace_back();
+        node.world.translate = spec.position;
+        node.worldBound = { spec.position, spec.radius };
+        node.collisionLayer = spec.layer;
+
+        if (spec.hasPhysics) {
+            // Box inscribed in the bound sphere, in Havok units
+            const float half = spec.radius * 0.7f;
+            const float toHavok = RE::bhkWorld::GetWorldScale();
+            auto& body = m_bodies.emplace_back();
+            const float mins[3] = { spec.position.x - half, spec.position.y - half, spec.position.z - half };
+            const float maxs[3] = { spec.position.x + half, spec.position.y + half, spec.position.z + half };
+            for (int i = 0; i < 3; ++i) {
+                body.aabbWorldspace.min.quad.m128_f32[i] = mins[i] * toHavok;
+                body.aabbWorldspace.max.quad.m128_f32[i] = maxs[i] * toHavok;
+            }
+            auto& collision = m_collisions.emplace_back();
+            collision.rigidBody = &body;
+            node.collisionObject = &collision;
+        }
+
+        auto& ref = m_refs.emplace_back();
+        ref.formID = 0xFF000000 | static_cast<RE::FormID>(m_refs.size());
+        ref.SetBaseObject(BaseFor(spec.type));
+        ref.SetParentCell(&m_cell);
+        ref.SetPosition(spec.position);  // Before Set3D - the node is already in place
+        ref.Set3D(&node);
+
+        m_cell.references.push_back(&ref);
+        return &ref;
+    }
+
+    // Stand-in for bhkWorld::PickObject: nearest reference whose bound sphere the
+    // ray hits within maxDistance. direction must be normalized.
+    std::optional<PickResult> Pick(const RE::NiPoint3& origin, const RE::NiPoint3& direction, float maxDistance) const
+    {
+        std::optional<PickResult> best;
+        for (auto* ref : m_cell.references) {
+            auto* node = ref->Get3D();
+            if (!node || ref->IsDisabled() || ref->IsDeleted()) {
+                continue;
+            }
+
+            // |origin + t*direction - center|^2 = r^2, smallest t >= 0
+            const RE::NiPoint3 toOrigin = origin - node->worldBound.center;
+            const float b = toOrigin.x * direction.x + toOrigin.y * direction.y + toOrigin.z * direction.z;
+            const float c = toOrigin.x * toOrigin.x + toOrigin.y * toOrigin.y + toOrigin.z * toOrigin.z -
+                            node->worldBound.radius * node->worldBound.radius;
+            const float discriminant = b * b - c;
+            if (discriminant < 0.0f) {
+                continue;
+            }
+
+            const float root = std::sqrt(discriminant);
+            float t = -b - root;
+            if (t < 0.0f) {
+                t = -b + root;  // Origin inside the sphere
+            }
+            if (t < 0.0f || t > maxDistance || (best && t >= best->distance)) {
+                continue;
+            }
+            const RE::NiPoint3 hitPoint = origin + direction * t;
+            best = PickResult{ ref, t, hitPoint, (hitPoint - node->worldBound.center) * (1.0f / node->worldBound.radius) };
+        }
+        return best;
+    }
+
+private:
+    RE::TESForm* BaseFor(RE::FormType type)
+    {
+        for (auto& base : m_bases) {
+            if (base.formType == type) {
+                return &base;
+            }
+        }
+        auto& base = m_bases.emplace_back();
+        base.formID = 0x00100000 | static_cast<RE::FormID>(m_bases.size());
+        base.formType = type;
+        return &base;
+    }
+
+    // Roughly a furnished interior: mostly statics and clutter, some furniture,
+    // containers and doors
+    void Populate()
+    {
+        struct Kind {
+            RE::FormType type;
+            RE::COL_LAYER layer;
+            bool hasPhysics;
+            int weight;
+        };
+        static constexpr Kind kKinds[] = {
+            { RE::FormType::Static, RE::COL_LAYER::kStatic, false, 40 },
+            { RE::FormType::Misc, RE::COL_LAYER::kClutter, true, 25 },
+            { RE::FormType::MovableStatic, RE::COL_LAYER::kProps, true, 10 },
+            { RE::FormType::Furniture, RE::COL_LAYER::kStatic, false, 8 },
+            { RE::FormType::Weapon, RE::COL_LAYER::kWeapon, true, 5 },
+            { RE::FormType::Container, RE::COL_LAYER::kStatic, false, 4 },
+            { RE::FormType::Light, RE::COL_LAYER::kNonCollidable, false, 4 },
+            { RE::FormType::Door, RE::COL_LAYER::kAnimStatic, false, 2 },
+            { RE::FormType::Flora, RE::COL_LAYER::kTrees, false, 2 },
+        };
+
+        std::vector<int> weights;
+        for (const auto& kind : kKinds) {
+            weights.push_back(kind.weight);
+        }
+
+        std::mt19937 rng(m_config.seed);
+        std::discrete_distribution<size_t> pickKind(weights.begin(), weights.end());
+        std::uniform_real_distribution<float> xy(-m_config.halfExtent, m_config.halfExtent);
+        std::uniform_real_distribution<float> z(0.0f, m_config.height);
+        std::uniform_real_distribution<float> radius(m_config.minRadius, m_config.maxRadius);
+
+        m_cell.references.reserve(m_config.referenceCount);
+        for (size_t i = 0; i < m_config.referenceCount; ++i) {
+            const Kind& kind = kKinds[pickKind(rng)];
+            ReferenceSpec spec;
+            spec.type = kind.type;
+            spec.layer = kind.layer;
+            spec.hasPhysics = kind.hasPhysics;
+            spec.position = RE::NiPoint3(xy(rng), xy(rng), z(rng));
+            spec.radius = radius(rng);
+            AddReference(spec);
+        }
+    }
+
+    Config m_config;
+    RE::TESObjectCELL m_cell;
+
+    // Deques keep addresses stable as references are added
+    std::deque<RE::TESObjectREFR> m_refs;
+    std::deque<RE::NiNode> m_nodes;
+    std::deque<RE::bhkRigidBody> m_bodies;
+    std::deque<RE::bhkNiCollisionObject> m_collisions;
+    std::deque<RE::TESForm> m_bases;
+};
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cmath>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -21,9 +23,16 @@ using namespace std::literals;
 #include <format>
 
 namespace spdlog {
+    namespace level {
+        enum level_enum : int { trace, debug, info, warn, err, critical, off };
+    }
+
     namespace detail {
         enum class level { trace, debug, info, warn, error, critical };
 
+        // Messages below this are dropped (set_level)
+        inline std::atomic<int> min_level{ 0 };
+
         inline const char* level_name(level lvl) {
             switch (lvl) {
                 case level::trace: return "TRACE";
@@ -38,19 +47,26 @@ namespace spdlog {
 
         template<typename... Args>
         inline void log(level lvl, std::format_string<Args...> fmt, Args&&... args) {
+            if (static_cast<int>(lvl) < min_level.load(std::memory_order_relaxed)) return;
             std::cerr << "[" << level_name(lvl) << "] "
                       << std::format(fmt, std::forward<Args>(args)...) << std::endl;
         }
 
         inline void log(level lvl, const char* msg) {
+            if (static_cast<int>(lvl) < min_level.load(std::memory_order_relaxed)) return;
             std::cerr << "[" << level_name(lvl) << "] " << msg << std::endl;
         }
 
         inline void log(level lvl, const std::string& msg) {
+            if (static_cast<int>(lvl) < min_level.load(std::memory_order_relaxed)) return;
             std::cerr << "[" << level_name(lvl) << "] " << msg << std::endl;
         }
     }
 
+    inline void set_level(level::level_enum lvl) {
+        detail::min_level.store(lvl, std::memory_order_relaxed);
+    }
+
     template<typename... Args>
     inline void trace(std::format_string<Args...> fmt, Args&&... args) {
         detail::log(detail::level::trace, fmt, std::forward<Args>(args)...);
@@ -169,6 +185,13 @@ namespace RE {
 
     struct NiMatrix3 {
         float entry[3][3] = {{1,0,0}, {0,1,0}, {0,0,1}};
+
+        // Inverse of RotationMath::EulerToMatrix (away from gimbal lock)
+        void ToEulerAnglesXYZ(NiPoint3& angles) const {
+            angles.y = std::asin(std::clamp(entry[0][2], -1.0f, 1.0f));
+            angles.x = std::atan2(-entry[1][2], entry[2][2]);
+            angles.z = std::atan2(-entry[0][1], entry[0][0]);
+        }
     };
 
     struct NiTransform {
@@ -177,15 +200,93 @@ namespace RE {
         float scale = 1.0f;
     };
 
+    struct NiBound {
+        NiPoint3 center;
+        float radius = 0.0f;
+    };
+
+    // === Havok Types (collision bounds only) ===
+    struct hkVector4 {
+        struct {
+            float m128_f32[4] = {};  // MSVC __m128 member name
+        } quad;
+    };
+
+    struct hkAabb {
+        hkVector4 min;
+        hkVector4 max;
+    };
+
+    class bhkRigidBody {
+    public:
+        hkAabb aabbWorldspace;  // Havok units
+
+        void GetAabbWorldspace(hkAabb& out) const { out = aabbWorldspace; }
+    };
+
+    class bhkNiCollisionObject {
+    public:
+        bhkRigidBody* rigidBody = nullptr;
+
+        bhkRigidBody* GetRigidBody() const { return rigidBody; }
+    };
+
+    class bhkWorld {
+    public:
+        static float GetWorldScale() { return 0.0142875f; }
+        static float GetWorldScaleInverse() { return 69.99125f; }
+    };
+
+    // Values match CommonLibSSE-NG
+    enum class COL_LAYER : std::uint32_t {
+        kUnidentified = 0,
+        kStatic = 1,
+        kAnimStatic = 2,
+        kTransparent = 3,
+        kClutter = 4,
+        kWeapon = 5,
+        kProjectile = 6,
+        kSpell = 7,
+        kBiped = 8,
+        kTrees = 9,
+        kProps = 10,
+        kWater = 11,
+        kTrigger = 12,
+        kTerrain = 13,
+        kTrap = 14,
+        kNonCollidable = 15,
+        kCloudTrap = 16,
+        kGround = 17,
+        kPortal = 18,
+        kDebrisSmall = 19,
+        kDebrisLarge = 20,
+        kAcousticSpace = 21,
+        kActorZone = 22,
+        kProjectileZone = 23,
+        kGasTrap = 24,
+        kShellCasting = 25,
+        kTransparentWall = 26,
+        kInvisibleWall = 27,
+        kTransparentSmallAnim = 28,
+        kClutterLarge = 29,
+        kCharController = 30,
+        kStairHelper = 31,
+    };
+
     // === Scene Graph Types ===
     class NiAVObject {
     public:
         NiTransform local;
         NiTransform world;
         NiAVObject* parent = nullptr;
+        NiBound worldBound;
+        COL_LAYER collisionLayer = COL_LAYER::kUnidentified;
+        bhkNiCollisionObject* collisionObject = nullptr;
         virtual ~NiAVObject() = default;
 
         NiAVObject* GetObjectByName(std::string_view) { return this; }
+        COL_LAYER GetCollisionLayer() const { return collisionLayer; }
+        bhkNiCollisionObject* GetCollisionObject() const { return collisionObject; }
     };
 
     class NiNode : public NiAVObject {
@@ -197,6 +298,67 @@ namespace RE {
     using FormID = std::uint32_t;
     using RefHandle = uint32_t;
 
+    // Subset used by WorldQuery (CommonLibSSE-NG order, values not matched)
+    enum class FormType : std::uint8_t {
+        None,
+        Scroll,
+        Activator,
+        TalkingActivator,
+        Armor,
+        Book,
+        Container,
+        Door,
+        Ingredient,
+        Light,
+        Misc,
+        Apparatus,
+        Static,
+        StaticCollection,
+        MovableStatic,
+        Grass,
+        Tree,
+        Flora,
+        Furniture,
+        Weapon,
+        Ammo,
+        NPC,
+        AlchemyItem,
+        IdleMarker,
+        SoulGem,
+        Cell,
+        Reference,
+        ActorCharacter,
+        AnimatedObject,
+        ArtObject,
+        VolumetricLighting,
+    };
+
+    // Record signatures for the types the tests use
+    inline std::string_view FormTypeToString(FormType type)
+    {
+        switch (type) {
+        case FormType::Activator: return "ACTI";
+        case FormType::Container: return "CONT";
+        case FormType::Door: return "DOOR";
+        case FormType::Light: return "LIGH";
+        case FormType::Misc: return "MISC";
+        case FormType::Static: return "STAT";
+        case FormType::MovableStatic: return "MSTT";
+        case FormType::Furniture: return "FURN";
+        case FormType::Cell: return "CELL";
+        case FormType::Reference: return "REFR";
+        case FormType::ActorCharacter: return "ACHR";
+        default: return "NONE";
+        }
+    }
+
+    namespace BSContainer {
+        enum class ForEachResult {
+            kContinue = 0,
+            kStop = 1,
+        };
+    }
+
     template<typename T>
     class NiPointer {
     public:
@@ -223,22 +385,114 @@ namespace RE {
         uint32_t native_handle() const { return value; }
     };
 
+    // Plugin a form was loaded from - see FormKeyUtil
+    class TESFile {
+    public:
+        std::string fileName;
+        std::uint8_t compileIndex = 0;
+        std::uint16_t smallFileCompileIndex = 0;
+        bool isLight = false;
+
+        std::string_view GetFilename() const { return fileName; }
+        bool IsLight() const { return isLight; }
+        std::uint8_t GetCompileIndex() const { return compileIndex; }
+        std::uint16_t GetSmallFileCompileIndex() const { return smallFileCompileIndex; }
+    };
+
     class TESForm {
     public:
         FormID formID = 0;
+        FormType formType = FormType::None;
+        bool deleted = false;
+        bool disabled = false;
+        std::string name;
+        std::string editorId;
+        TESFile* sourceFile = nullptr;
         virtual ~TESForm() = default;
 
         FormID GetFormID() const { return formID; }
-        TESForm* GetBaseObject() { return this; }
+        FormType GetFormType() const { return formType; }
+        bool Is(FormType type) const { return formType == type; }
+        bool IsDeleted() const { return deleted; }
+        bool IsDisabled() const { return disabled; }
+        const char* GetName() const { return name.c_str(); }
+        const char* GetFormEditorID() const { return editorId.c_str(); }
+
+        TESFile* GetFile(std::int32_t = -1) const { return sourceFile; }
+
+        // Form ID without the load order bits (ESL forms keep the low 12 bits)
+        FormID GetLocalFormID() const
+        {
+            if (sourceFile && sourceFile->IsLight()) {
+                return formID & 0x00000FFF;
+            }
+            return formID & 0x00FFFFFF;
+        }
 
         template<typename T>
         T* As() { return dynamic_cast<T*>(this); }
+
+        // Headless form table: empty unless a test registers forms, so lookups miss
+        template<typename T = TESForm>
+        static T* LookupByID(FormID id)
+        {
+            auto it = s_formTable.find(id);
+            return it != s_formTable.end() ? dynamic_cast<T*>(it->second) : nullptr;
+        }
+        static TESForm* LookupByEditorID(std::string_view) { return nullptr; }
+
+        static void RegisterLookup(TESForm* form) { s_formTable[form->formID] = form; }
+        static void ClearLookups() { s_formTable.clear(); }
+
+    private:
+        static inline std::map<FormID, TESForm*> s_formTable;
+    };
+
+    // Model component - combine with TESForm for base objects that have a mesh
+    class TESModel {
+    public:
+        std::string model;
+        virtual ~TESModel() = default;
+
+        const char* GetModel() const { return model.c_str(); }
+    };
+
+    class TESObjectCELL;
+
+    class BGSLocation : public TESForm {
+    public:
+        const char* GetFullName() const { return name.c_str(); }
     };
 
     class TESObjectREFR : public TESForm {
     public:
+        TESObjectREFR() { formType = FormType::Reference; }
+
         NiPoint3 GetPosition() const { return position; }
-        void SetPosition(const NiPoint3& pos) { position = pos; }
+        NiPoint3 GetAngle() const { return angle; }
+        float GetScale() const { return scale; }
+
+        // Like the game, moving a reference moves its loaded 3D (translation and bound)
+        void SetPosition(const NiPoint3& pos)
+        {
+            if (node) {
+                const NiPoint3 delta = pos - position;
+                node->world.translate = node->world.translate + delta;
+                node->worldBound.center = node->worldBound.center + delta;
+            }
+            position = pos;
+        }
+        void SetAngle(const NiPoint3& a) { angle = a; }
+        void SetScale(float s) { scale = s; }
+        void SetDelete(bool d) { deleted = d; }
+
+        TESForm* GetBaseObject() { return baseObject; }
+        const char* GetDisplayFullName() { return baseObject ? baseObject->GetName() : ""; }
+        void SetBaseObject(TESForm* base) { baseObject = base; }
+
+        TESObjectCELL* GetParentCell() const { return parentCell; }
+        void SetParentCell(TESObjectCELL* cell) { parentCell = cell; }
+        BGSLocation* GetCurrentLocation() const { return nullptr; }
 
         NiNode* Get3D() { return node; }
         void Set3D(NiNode* n) { node = n; }
@@ -261,12 +515,74 @@ namespace RE {
 
     private:
         NiPoint3 position;
+        NiPoint3 angle;
+        float scale = 1.0f;
+        TESForm* baseObject = nullptr;
+        TESObjectCELL* parentCell = nullptr;
         NiNode* node = nullptr;
         ObjectRefHandle handle;
         static inline std::map<uint32_t, TESObjectREFR*> s_handleMap;
     };
 
-    class PlayerCharacter : public TESObjectREFR {
+    class Actor : public TESObjectREFR {
+    public:
+        Actor() { formType = FormType::ActorCharacter; }
+    };
+
+    // A cell's reference list - populated by tests (see SimulatedWorld.h)
+    class TESObjectCELL : public TESForm {
+    public:
+        TESObjectCELL() { formType = FormType::Cell; }
+
+        std::vector<TESObjectREFR*> references;
+
+        BGSLocation* GetLocation() const { return nullptr; }
+
+        // Linear scan over the cell, like the game
+        void ForEachReferenceInRange(const NiPoint3& origin, float radius,
+                                     std::function<BSContainer::ForEachResult(TESObjectREFR*)> callback) const
+        {
+            const float radiusSquared = radius * radius;
+            for (auto* ref : references) {
+                const NiPoint3 d = ref->GetPosition() - origin;
+                if (d.x * d.x + d.y * d.y + d.z * d.z <= radiusSquared &&
+                    callback(ref) == BSContainer::ForEachResult::kStop) {
+                    return;
+                }
+            }
+        }
+    };
+
+    class TES {
+    public:
+        static TES* GetSingleton() {
+            static TES instance;
+            return &instance;
+        }
+
+        // Cells the stub treats as attached
+        std::vector<TESObjectCELL*> loadedCells;
+
+        void ForEachReferenceInRange(TESObjectREFR* origin, float radius,
+                                     std::function<BSContainer::ForEachResult(TESObjectREFR*)> callback)
+        {
+            if (!origin) {
+                return;
+            }
+            bool stopped = false;
+            for (auto* cell : loadedCells) {
+                cell->ForEachReferenceInRange(origin->GetPosition(), radius, [&](TESObjectREFR* ref) {
+                    stopped = callback(ref) == BSContainer::ForEachResult::kStop;
+                    return stopped ? BSContainer::ForEachResult::kStop : BSContainer::ForEachResult::kContinue;
+                });
+                if (stopped) {
+                    return;
+                }
+            }
+        }
+    };
+
+    class PlayerCharacter : public Actor {
     public:
         static PlayerCharacter* GetSingleton() {
             static PlayerCharacter instance;
@@ -298,6 +614,8 @@ namespace RE {
 
         void ClearForms() { forms.clear(); }
 
+        std::vector<TESFile*> files;  // Load order, like the game's BSSimpleList
+
     private:
         std::map<std::string, TESForm*> forms;
     };
@@ -0,0 +1,149 @@
+#include <catch2/catch_all.hpp>
+#include "actions/ArrayLayout.h"
+
+using namespace Actions::ArrayLayout;
+using Catch::Approx;
+
+// =============================================================================
+// ArrayLayout - placement math for the array duplicate tool
+// =============================================================================
+
+namespace {
+    Placement MakePlacement(float x, float y, float z, float yaw = 0.0f)
+    {
+        Placement p;
+        p.position = RE::NiPoint3(x, y, z);
+        p.angle = RE::NiPoint3(0.0f, 0.0f, yaw);
+        return p;
+    }
+
+    void RequirePosition(const Placement& p, float x, float y, float z)
+    {
+        REQUIRE(p.position.x == Approx(x).margin(1e-3));
+        REQUIRE(p.position.y == Approx(y).margin(1e-3));
+        REQUIRE(p.position.z == Approx(z).margin(1e-3));
+    }
+}
+
+TEST_CASE("ArrayLayout linear spacing", "[math][transform]") {
+    std::vector<Placement> sources{ MakePlacement(100.0f, 0.0f, 10.0f, 1.0f) };
+
+    SECTION("Copy k is offset by k * offset") {
+        auto result = ComputeLinear(sources, { 3, RE::NiPoint3(50.0f, -10.0f, 5.0f) });
+        REQUIRE(result.size() == 3);
+        RequirePosition(result[0], 150.0f, -10.0f, 15.0f);
+        RequirePosition(result[1], 200.0f, -20.0f, 20.0f);
+        RequirePosition(result[2], 250.0f, -30.0f, 25.0f);
+    }
+
+    SECTION("Angles are kept") {
+        auto result = ComputeLinear(sources, { 2, RE::NiPoint3(1.0f, 0.0f, 0.0f) });
+        for (const auto& p : result) {
+            REQUIRE(p.angle.z == Approx(1.0f));
+        }
+    }
+
+    SECTION("Zero or negative count produces nothing") {
+        REQUIRE(ComputeLinear(sources, { 0, RE::NiPoint3(1.0f, 0.0f, 0.0f) }).empty());
+        REQUIRE(ComputeLinear(sources, { -4, RE::NiPoint3(1.0f, 0.0f, 0.0f) }).empty());
+    }
+
+    SECTION("Count is clamped") {
+        auto result = ComputeLinear(sources, { kMaxCount + 100, RE::NiPoint3(1.0f, 0.0f, 0.0f) });
+        REQUIRE(result.size() == static_cast<size_t>(kMaxCount));
+    }
+}
+
+TEST_CASE("ArrayLayout radial placement", "[math][transform]") {
+    std::vector<Placement> sources{ MakePlacement(100.0f, 0.0f, 20.0f) };
+    const RE::NiPoint3 pivot(0.0f, 0.0f, 0.0f);
+
+    SECTION("Full circle spreads copies evenly without landing on the source") {
+        RadialParams params{ 3, pivot, kTwoPi, true };
+        REQUIRE(RadialStepAngle(params) == Approx(kPi / 2.0f));
+
+        auto result = ComputeRadial(sources, params);
+        REQUIRE(result.size() == 3);
+        RequirePosition(result[0], 0.0f, 100.0f, 20.0f);
+        RequirePosition(result[1], -100.0f, 0.0f, 20.0f);
+        RequirePosition(result[2], 0.0f, -100.0f, 20.0f);
+    }
+
+    SECTION("Arc ends the last copy at the total angle") {
+        RadialParams params{ 2, pivot, kPi / 2.0f, true };
+        REQUIRE(RadialStepAngle(params) == Approx(kPi / 4.0f));
+
+        auto result = ComputeRadial(sources, params);
+        REQUIRE(result.size() == 2);
+        const float d = 100.0f / std::sqrt(2.0f);
+        RequirePosition(result[0], d, d, 20.0f);
+        RequirePosition(result[1], 0.0f, 100.0f, 20.0f);
+    }
+
+    SECTION("Off-origin pivot") {
+        RadialParams params{ 1, RE::NiPoint3(50.0f, 50.0f, 0.0f), kPi, true };
+        auto result = ComputeRadial(sources, params);
+        REQUIRE(result.size() == 1);
+        RequirePosition(result[0], 0.0f, 100.0f, 20.0f);
+    }
+
+    SECTION("Copies are turned with the circle") {
+        RadialParams params{ 3, pivot, kTwoPi, true };
+        auto result = ComputeRadial(sources, params);
+        REQUIRE(result[0].angle.z == Approx(kPi / 2.0f));
+        REQUIRE(result[1].angle.z == Approx(kPi));
+        REQUIRE(result[2].angle.z == Approx(3.0f * kPi / 2.0f));
+    }
+
+    SECTION("rotateCopies=false keeps the source angle") {
+        RadialParams params{ 3, pivot, kTwoPi, false };
+        auto result = ComputeRadial(sources, params);
+        for (const auto& p : result) {
+            REQUIRE(p.angle.z == Approx(0.0f).margin(1e-6));
+        }
+    }
+
+    SECTION("Yaw wraps into [0, 2*pi)") {
+        std::vector<Placement> turned{ MakePlacement(100.0f, 0.0f, 0.0f, 3.0f * kPi / 2.0f) };
+        RadialParams params{ 1, pivot, kPi, true };
+        auto result = ComputeRadial(turned, params);
+        REQUIRE(result[0].angle.z == Approx(kPi / 2.0f));
+    }
+
+    SECTION("Zero count produces nothing") {
+        REQUIRE(ComputeRadial(sources, { 0, pivot, kTwoPi, true }).empty());
+        REQUIRE(RadialStepAngle({ 0, pivot, kTwoPi, true }) == 0.0f);
+    }
+}
+
+TEST_CASE("ArrayLayout with several sources", "[math][transform]") {
+    std::vector<Placement> sources{
+        MakePlacement(100.0f, 0.0f, 0.0f),
+        MakePlacement(200.0f, 0.0f, 0.0f),
+    };
+
+    SECTION("Result is copy-major") {
+        auto result = ComputeLinear(sources, { 2, RE::NiPoint3(0.0f, 10.0f, 0.0f) });
+        REQUIRE(result.size() == 4);
+        RequirePosition(result[0], 100.0f, 10.0f, 0.0f);
+        RequirePosition(result[1], 200.0f, 10.0f, 0.0f);
+        RequirePosition(result[2], 100.0f, 20.0f, 0.0f);
+        RequirePosition(result[3], 200.0f, 20.0f, 0.0f);
+    }
+
+    SECTION("Group rotates rigidly around the centroid") {
+        RE::NiPoint3 center = Centroid(sources);
+        RequirePosition({ center, {} }, 150.0f, 0.0f, 0.0f);
+
+        auto result = ComputeRadial(sources, { 1, center, kPi, true });
+        REQUIRE(result.size() == 2);
+        RequirePosition(result[0], 200.0f, 0.0f, 0.0f);
+        RequirePosition(result[1], 100.0f, 0.0f, 0.0f);
+    }
+
+    SECTION("WrapAngle") {
+        REQUIRE(WrapAngle(-kPi / 2.0f) == Approx(3.0f * kPi / 2.0f));
+        REQUIRE(WrapAngle(kTwoPi + 0.5f) == Approx(0.5f));
+        REQUIRE(WrapAngle(0.0f) == 0.0f);
+    }
+}
@@ -0,0 +1,222 @@
+#include <catch2/catch_all.hpp>
+#include "persistence/CellBinaryConverter.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace Persistence;
+using namespace Persistence::CellBinary;
+
+// =============================================================================
+// CellBinary - columnar .vrcb files and their INI conversion
+// =============================================================================
+
+namespace {
+    AddedObjectEntry MakeAdded(const char* baseForm, RE::NiPoint3 position, RE::NiPoint3 rotation, float scale)
+    {
+        AddedObjectEntry entry;
+        entry.baseFormString = baseForm;
+        entry.position = position;
+        entry.rotation = rotation;
+        entry.scale = scale;
+        return entry;
+    }
+
+    AddedObjectsFileData MakeCell()
+    {
+        AddedObjectsFileData data;
+        data.cellFormKey = "0x1A26F~Skyrim.esm";
+        data.cellEditorId = "WhiterunExterior01";
+
+        auto chair = MakeAdded("0x10C0E3~Skyrim.esm", { 100.5f, 200.0f, -30.25f }, { 0, 0, 90 }, 1.25f);
+        chair.editorId = "WRChair01";
+        chair.displayName = "Chair";
+        chair.meshName = "Furniture\\Chair01.nif";
+        data.entries.push_back(std::move(chair));
+
+        data.entries.push_back(MakeAdded("MyEditorIdThing", { 1, 2, 3 }, { 4, 5, 6 }, 1.0f));
+        data.entries.push_back(MakeAdded("0x800~MyMod.esp", { -1, -2, -3 }, { 0, 45, 0 }, 0.5f));
+        data.entries.push_back(MakeAdded("0x10C0E4~Skyrim.esm", { 7, 8, 9 }, { 0, 0, -90 }, 2.0f));
+        return data;
+    }
+
+    // View::Open requires 4-byte aligned bytes - copy into uint32_t storage
+    struct AlignedBuffer {
+        explicit AlignedBuffer(const std::vector<std::byte>& bytes) :
+            words((bytes.size() + 3) / 4), size(bytes.size())
+        {
+            std::memcpy(words.data(), bytes.data(), bytes.size());
+        }
+
+        std::span<const std::byte> Bytes(size_t offset = 0) const
+        {
+            return { reinterpret_cast<const std::byte*>(words.data()) + offset, size - offset };
+        }
+
+        std::vector<uint32_t> words;
+        size_t size;
+    };
+
+    void RequireSameEntries(const std::vector<AddedObjectEntry>& actual, const std::vector<AddedObjectEntry>& expected)
+    {
+        REQUIRE(actual.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            INFO("row " << i);
+            REQUIRE(actual[i].baseFormString == expected[i].baseFormString);
+            REQUIRE(actual[i].position == expected[i].position);
+            REQUIRE(actual[i].rotation == expected[i].rotation);
+            REQUIRE(actual[i].scale == expected[i].scale);
+            REQUIRE(actual[i].editorId == expected[i].editorId.view());
+            REQUIRE(actual[i].meshName == expected[i].meshName.view());
+        }
+    }
+}
+
+TEST_CASE("CellBinary round-trips AddedObjects rows in memory", "[persistence]") {
+    const auto cell = MakeCell();
+    AlignedBuffer buffer(FromAddedObjects(cell));
+
+    std::string error;
+    auto view = View::Open(buffer.Bytes(), &error);
+    INFO(error);
+    REQUIRE(view.has_value());
+    REQUIRE(view->GetKind() == FileKind::AddedObjects);
+    REQUIRE(view->GetRowCount() == 4);
+    REQUIRE(view->GetCellFormKey() == "0x1A26F~Skyrim.esm");
+    REQUIRE(view->GetCellEditorId() == "WhiterunExterior01");
+
+    const auto data = ToAddedObjects(*view);
+    REQUIRE(data.cellFormKey == cell.cellFormKey);
+    REQUIRE(data.cellEditorId == cell.cellEditorId);
+    RequireSameEntries(data.entries, cell.entries);
+}
+
+TEST_CASE("CellBinary splits form keys into plugin table and local IDs", "[persistence]") {
+    AlignedBuffer buffer(FromAddedObjects(MakeCell()));
+    auto view = View::Open(buffer.Bytes());
+    REQUIRE(view.has_value());
+
+    const auto plugins = view->GetUIntColumn(Column::FormPlugin);
+    const auto formIds = view->GetUIntColumn(Column::FormId);
+
+    // Skyrim.esm is stored once and shared by both of its rows
+    REQUIRE(plugins[0] == plugins[3]);
+    REQUIRE(view->GetPluginName(plugins[0]) == "Skyrim.esm");
+    REQUIRE(view->GetPluginName(plugins[2]) == "MyMod.esp");
+    REQUIRE(formIds[0] == 0x10C0E3);
+    REQUIRE(formIds[2] == 0x800);
+
+    // Editor IDs go through the string table
+    REQUIRE(plugins[1] == kEditorIdPlugin);
+    REQUIRE(view->GetString(formIds[1]) == "MyEditorIdThing");
+
+    // Float columns read in place
+    const auto posX = view->GetFloatColumn(Column::PosX);
+    REQUIRE(posX[0] == 100.5f);
+    REQUIRE(posX[2] == -1.0f);
+}
+
+TEST_CASE("CellBinary keeps non-canonical form keys as strings", "[persistence]") {
+    // Parses as a form key, but would not be rebuilt byte-identical
+    Builder builder(FileKind::Transforms, {}, {});
+    builder.AddRow("0x00abc~Skyrim.esm", { 1, 2, 3 }, {}, 1.0f, kFlagDeleted, {});
+    AlignedBuffer buffer(builder.Finish());
+
+    auto view = View::Open(buffer.Bytes());
+    REQUIRE(view.has_value());
+    REQUIRE(view->GetUIntColumn(Column::FormPlugin)[0] == kEditorIdPlugin);
+    REQUIRE(view->GetFormKey(0) == "0x00abc~Skyrim.esm");
+
+    const auto entries = ToTransforms(*view);
+    REQUIRE(entries.size() == 1);
+    REQUIRE(entries[0].formKeyString == "0x00abc~Skyrim.esm");
+    REQUIRE(entries[0].isDeleted);
+    REQUIRE(view->GetCellFormKey().empty());
+}
+
+TEST_CASE("CellBinary rejects damaged files", "[persistence]") {
+    const auto bytes = FromAddedObjects(MakeCell());
+    REQUIRE(bytes.size() % 4 == 0);
+
+    std::string error;
+
+    SECTION("truncated") {
+        AlignedBuffer buffer(std::vector<std::byte>(bytes.begin(), bytes.end() - 4));
+        REQUIRE_FALSE(View::Open(buffer.Bytes(), &error).has_value());
+        REQUIRE(error == "file size does not match the header");
+    }
+
+    SECTION("shorter than the header") {
+        AlignedBuffer buffer(std::vector<std::byte>(bytes.begin(), bytes.begin() + 16));
+        REQUIRE_FALSE(View::Open(buffer.Bytes(), &error).has_value());
+    }
+
+    SECTION("bad magic") {
+        auto damaged = bytes;
+        damaged[0] = std::byte{ 'X' };
+        AlignedBuffer buffer(damaged);
+        REQUIRE_FALSE(View::Open(buffer.Bytes(), &error).has_value());
+        REQUIRE(error == "not a cell binary file (bad magic)");
+    }
+
+    SECTION("huge row count") {
+        auto damaged = bytes;
+        const uint32_t rowCount = 0xFFFFFFFF;
+        std::memcpy(damaged.data() + offsetof(FileHeader, rowCount), &rowCount, sizeof(rowCount));
+        AlignedBuffer buffer(damaged);
+        REQUIRE_FALSE(View::Open(buffer.Bytes(), &error).has_value());
+    }
+
+    SECTION("misaligned") {
+        auto shifted = bytes;
+        shifted.insert(shifted.begin(), std::byte{ 0 });
+        AlignedBuffer buffer(shifted);
+        REQUIRE_FALSE(View::Open(buffer.Bytes(1), &error).has_value());
+        REQUIRE(error == "buffer is not 4-byte aligned");
+    }
+}
+
+TEST_CASE("CellBinary converts cell files both ways", "[persistence]") {
+    const auto dir = std::filesystem::temp_directory_path() / "vreditor_test_cell_binary";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto cell = MakeCell();
+    const auto iniPath = dir / "VREditor_WhiterunExterior01_AddedObjects.ini";
+    REQUIRE(AddedObjectsParser::GetSingleton()->WriteIniFile(iniPath, cell.cellFormKey, cell.cellEditorId,
+                                                             cell.entries));
+
+    REQUIRE(GetIniKind(iniPath) == FileKind::AddedObjects);
+    REQUIRE(GetIniKind(dir / "X_SWAP.ini") == FileKind::Transforms);
+    REQUIRE_FALSE(GetIniKind(dir / "VREditor.ini").has_value());
+
+    const auto binaryPath = GetBinaryPath(iniPath);
+    REQUIRE(binaryPath.filename() == "VREditor_WhiterunExterior01_AddedObjects.vrcb");
+    REQUIRE(ConvertIniToBinary(iniPath, binaryPath));
+
+    std::string error;
+    auto loaded = ReadAddedObjects(binaryPath, &error);
+    INFO(error);
+    REQUIRE(loaded.has_value());
+    REQUIRE(loaded->iniFileName == iniPath.filename().string());
+    REQUIRE(loaded->cellFormKey == cell.cellFormKey);
+    RequireSameEntries(loaded->entries, AddedObjectsParser::GetSingleton()->ParseIniFile(iniPath).entries);
+
+    // Back to INI: the parser reads the same rows as from the original
+    const auto backPath = dir / "Back_AddedObjects.ini";
+    REQUIRE(ConvertBinaryToIni(binaryPath, backPath));
+    const auto back = AddedObjectsParser::GetSingleton()->ParseIniFile(backPath);
+    REQUIRE(back.cellFormKey == cell.cellFormKey);
+    RequireSameEntries(back.entries, loaded->entries);
+
+    // A file that is not a cell binary is refused
+    {
+        std::ofstream junk(dir / "junk.vrcb", std::ios::binary);
+        junk << "definitely not a cell file, but long enough to hold a header";
+    }
+    REQUIRE_FALSE(ReadAddedObjects(dir / "junk.vrcb").has_value());
+    REQUIRE_FALSE(ConvertIniToBinary(dir / "VREditor.ini", dir / "out.vrcb", &error));
+
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,204 @@
+#include <catch2/catch_all.hpp>
+#include "persistence/BaseFormMetadataCache.h"
+#include "persistence/ChangedObjectRegistry.h"
+#include "persistence/ExportBuilder.h"
+
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace Persistence;
+
+// =============================================================================
+// ExportBuilder - INI entries from captured registry data, no game lookups
+// =============================================================================
+
+namespace {
+    constexpr float kDegToRad = 3.14159265358979323846f / 180.0f;
+
+    ChangedObjectRuntimeData MakeMoved(const char* cell, RE::NiPoint3 position, RE::NiPoint3 angleDegrees)
+    {
+        ChangedObjectRuntimeData data;
+        data.saveData.cellFormKey = cell;
+        data.saveData.cellEditorId = "WhiterunExterior01";
+        data.exportRecord = ExportBuilder::CaptureRecord(position, angleDegrees * kDegToRad, 1.5f);
+        data.exportRecord.metadata.editorId = "WRTable01";
+        data.exportRecord.metadata.meshName = "Furniture\\Table01.nif";
+        data.hasPendingExportChanges = true;
+        return data;
+    }
+
+    class TestStatic : public RE::TESForm, public RE::TESModel {
+    public:
+        TestStatic(RE::FormID id, std::string edid, std::string mesh)
+        {
+            formID = id;
+            formType = RE::FormType::Static;
+            editorId = std::move(edid);
+            model = std::move(mesh);
+        }
+    };
+}
+
+TEST_CASE("ExportBuilder captures positions and normalized degrees", "[persistence]") {
+    const auto record = ExportBuilder::CaptureRecord({ 10, 20, 30 }, { 0.5f, -0.25f, 4.0f }, 2.0f);
+    REQUIRE(record.captured);
+    REQUIRE(record.position == RE::NiPoint3(10, 20, 30));
+    REQUIRE(record.scale == 2.0f);
+    REQUIRE_THAT(record.angleDegrees.x, Catch::Matchers::WithinAbs(28.6479f, 1e-3));
+    REQUIRE_THAT(record.angleDegrees.y, Catch::Matchers::WithinAbs(-14.3239f, 1e-3));
+    // 4 rad = 229.18 deg wraps into [-180, 180]
+    REQUIRE_THAT(record.angleDegrees.z, Catch::Matchers::WithinAbs(229.1831f - 360.0f, 1e-3));
+
+    for (float angle = -1000.0f; angle <= 1000.0f; angle += 7.3f) {
+        const float normalized = ExportBuilder::NormalizeAngleDegrees(angle);
+        REQUIRE(normalized >= -180.0f);
+        REQUIRE(normalized <= 180.0f);
+        REQUIRE_THAT(std::remainder(normalized - angle, 360.0f), Catch::Matchers::WithinAbs(0.0f, 1e-3));
+    }
+}
+
+TEST_CASE("ExportBuilder groups BOS entries by cell", "[persistence]") {
+    std::map<std::string, ChangedObjectRuntimeData> registry;
+    registry["0x1~Skyrim.esm"] = MakeMoved("0x3C~Skyrim.esm", { 1, 2, 3 }, { 0, 0, 90 });
+    registry["0x2~Skyrim.esm"] = MakeMoved("0x3C~Skyrim.esm", { 4, 5, 6 }, { 0, 0, -45 });
+    registry["0x2~Skyrim.esm"].saveData.wasDeleted = true;
+    registry["0x3~Skyrim.esm"] = MakeMoved("0x99~Skyrim.esm", { 7, 8, 9 }, { 0, 0, 0 });
+
+    auto created = MakeMoved("0x3C~Skyrim.esm", { 0, 0, 0 }, { 0, 0, 0 });
+    created.saveData.wasCreated = true;
+    created.saveData.baseFormKey = "0x12345~Skyrim.esm";
+    registry["0xFF000801~DYNAMIC"] = created;
+
+    auto noCell = MakeMoved("", { 0, 0, 0 }, { 0, 0, 0 });
+    registry["0x4~Skyrim.esm"] = noCell;
+
+    ExportBuilder::PendingEntries pending;
+    for (const auto& [key, data] : registry) {
+        pending.emplace_back(key, &data);
+    }
+
+    const auto groups = ExportBuilder::GroupBOSEntries(pending);
+    REQUIRE(groups.size() == 2);
+    const auto& whiterun = groups.at("0x3C~Skyrim.esm");
+    REQUIRE(whiterun.first == "WhiterunExterior01");
+    REQUIRE(whiterun.second.size() == 2);
+
+    const auto& moved = whiterun.second[0];
+    REQUIRE(moved.formKeyString == "0x1~Skyrim.esm");
+    REQUIRE(moved.position == RE::NiPoint3(1, 2, 3));
+    REQUIRE_THAT(moved.rotation.z, Catch::Matchers::WithinAbs(90.0f, 1e-4));
+    REQUIRE(moved.scale == 1.5f);
+    REQUIRE_FALSE(moved.isDeleted);
+    REQUIRE(moved.editorId == "WRTable01");
+    REQUIRE(moved.meshName == "Furniture\\Table01.nif");
+
+    REQUIRE(whiterun.second[1].isDeleted);
+    REQUIRE_THAT(whiterun.second[1].rotation.z, Catch::Matchers::WithinAbs(-45.0f, 1e-4));
+    REQUIRE(groups.at("0x99~Skyrim.esm").second.size() == 1);
+
+    SECTION("AddedObjects groups take only created objects") {
+        const auto added = ExportBuilder::GroupAddedObjectEntries(pending);
+        REQUIRE(added.size() == 1);
+        const auto& entry = added.at("0x3C~Skyrim.esm").second.at(0);
+        // Base form by editor ID when the base object has one
+        REQUIRE(entry.baseFormString == "WRTable01");
+        REQUIRE(entry.meshName == "Furniture\\Table01.nif");
+    }
+
+    SECTION("created objects without an editor ID use the base form key") {
+        registry["0xFF000801~DYNAMIC"].exportRecord.metadata.editorId = "";
+        const auto added = ExportBuilder::GroupAddedObjectEntries(pending);
+        REQUIRE(added.at("0x3C~Skyrim.esm").second.at(0).baseFormString == "0x12345~Skyrim.esm");
+    }
+}
+
+TEST_CASE("ExportBuilder falls back to the transform for uncaptured entries", "[persistence]") {
+    ChangedObjectRuntimeData loaded;
+    loaded.saveData.cellFormKey = "0x3C~Skyrim.esm";
+    loaded.currentTransform.translate = { 100, 200, 300 };
+    loaded.currentTransform.scale = 0.5f;
+    // 30 degree yaw, as RotationMath::EulerToMatrix builds it
+    const float c = std::cos(30.0f * kDegToRad);
+    const float s = std::sin(30.0f * kDegToRad);
+    loaded.currentTransform.rotate.entry[0][0] = c;
+    loaded.currentTransform.rotate.entry[0][1] = -s;
+    loaded.currentTransform.rotate.entry[1][0] = s;
+    loaded.currentTransform.rotate.entry[1][1] = c;
+    REQUIRE_FALSE(loaded.exportRecord.captured);
+
+    const auto entry = ExportBuilder::ToBOSEntry("0x5~Skyrim.esm", loaded);
+    REQUIRE(entry.position == RE::NiPoint3(100, 200, 300));
+    REQUIRE(entry.scale == 0.5f);
+    REQUIRE_THAT(entry.rotation.z, Catch::Matchers::WithinAbs(30.0f, 1e-4));
+    REQUIRE(entry.editorId.empty());
+}
+
+TEST_CASE("ExportBuilder exports a registry entry restored from a save", "[persistence]") {
+    RE::TESFile skyrim;
+    skyrim.fileName = "Skyrim.esm";
+    auto* dataHandler = RE::TESDataHandler::GetSingleton();
+    dataHandler->files = { &skyrim };
+
+    TestStatic barrel(0x00012345, "Barrel01", "Clutter\\Barrel01.nif");
+    RE::TESObjectREFR ref;
+    ref.formID = 0x0010C0E3;
+    ref.sourceFile = &skyrim;
+    ref.editorId = "WRBarrelRef";
+    ref.SetBaseObject(&barrel);
+    ref.SetPosition({ 100, 200, 300 });
+    ref.SetAngle({ 0.3f, -0.2f, 2.0f });
+    ref.SetScale(1.25f);
+    RE::TESForm::RegisterLookup(&ref);
+
+    auto* registry = ChangedObjectRegistry::GetSingleton();
+    registry->Clear();
+    Persistence::BaseFormMetadataCache::GetSingleton()->Invalidate();
+
+    const std::string formKey = "0x10C0E3~Skyrim.esm";
+    std::vector<ChangedObjectSaveGameData> saved(2);
+    saved[0].formKeyString = formKey;
+    saved[0].cellFormKey = "0x3C~Skyrim.esm";
+    saved[0].cellEditorId = "WhiterunExterior01";
+    saved[1].formKeyString = "0x10C0E4~Skyrim.esm";  // Not loaded
+    saved[1].cellFormKey = "0x3C~Skyrim.esm";
+    registry->LoadEntries(std::move(saved));
+
+    REQUIRE(registry->CaptureRestoredExportRecords() == 1);
+
+    const auto exportBOS = [&] {
+        registry->MarkPendingExport({ formKey });
+        const auto groups = ExportBuilder::GroupBOSEntries(registry->GetPendingExportEntries());
+        REQUIRE(groups.at("0x3C~Skyrim.esm").second.size() == 1);
+        return groups.at("0x3C~Skyrim.esm").second[0];
+    };
+
+    // The reference's own angles, not ones recovered from a matrix
+    const auto restored = exportBOS();
+    REQUIRE(restored.formKeyString == formKey);
+    REQUIRE(restored.position == RE::NiPoint3(100, 200, 300));
+    REQUIRE(restored.rotation == ExportBuilder::RadiansToDegrees({ 0.3f, -0.2f, 2.0f }));
+    REQUIRE(restored.scale == 1.25f);
+    REQUIRE(restored.editorId == "WRBarrelRef");
+    REQUIRE(restored.meshName == "Clutter\\Barrel01.nif");
+
+    SECTION("a later edit keeps the restored metadata") {
+        RE::NiTransform moved;
+        moved.translate = { 150, 200, 300 };
+        registry->UpdateCurrentTransform(formKey, moved, { 0.0f, 0.0f, 1.0f }, "Whiterun");
+
+        const auto edited = exportBOS();
+        REQUIRE(edited.position == RE::NiPoint3(150, 200, 300));
+        REQUIRE(edited.rotation == ExportBuilder::RadiansToDegrees({ 0.0f, 0.0f, 1.0f }));
+        REQUIRE(edited.editorId == "WRBarrelRef");
+    }
+
+    SECTION("records are captured once") {
+        REQUIRE(registry->CaptureRestoredExportRecords() == 0);
+    }
+
+    registry->Clear();
+    RE::TESForm::ClearLookups();
+    dataHandler->files.clear();
+}
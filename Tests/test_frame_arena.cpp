@@ -0,0 +1,109 @@
+#include <catch2/catch_all.hpp>
+#include "SimulatedWorld.h"
+#include "util/FrameArena.h"
+#include "util/WorldQuery.h"
+
+#include <cstdint>
+#include <numeric>
+
+using Util::FrameArena;
+using Util::FrameSet;
+using Util::FrameVector;
+
+// =============================================================================
+// FrameArena - per-frame bump allocation for scratch containers
+// =============================================================================
+
+namespace {
+    bool IsInside(const FrameArena& arena, const void* p, const void* first)
+    {
+        const auto offset = static_cast<const std::byte*>(p) - static_cast<const std::byte*>(first);
+        return offset >= 0 && static_cast<size_t>(offset) < arena.GetCapacity();
+    }
+}
+
+TEST_CASE("FrameArena bumps, aligns and resets", "[arena]") {
+    FrameArena arena(1024);
+    arena.Reset();
+
+    void* first = arena.allocate(24, 8);
+    void* aligned = arena.allocate(16, 64);
+    REQUIRE(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+    REQUIRE(IsInside(arena, aligned, first));
+    REQUIRE(arena.GetBytesUsed() >= 40);
+    REQUIRE(arena.GetOverflowCount() == 0);
+
+    // Deallocation is a no-op; Reset hands the same memory out again
+    arena.deallocate(aligned, 16, 64);
+    arena.Reset();
+    REQUIRE(arena.GetBytesUsed() == 0);
+    REQUIRE(arena.GetLastFrameBytes() >= 40);
+    REQUIRE(arena.allocate(24, 8) == first);
+}
+
+TEST_CASE("FrameArena overflows to the heap and grows to fit", "[arena]") {
+    FrameArena arena(256);
+    arena.Reset();
+
+    auto frame = [&] {
+        FrameVector<int> values(&arena);
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+        REQUIRE(std::accumulate(values.begin(), values.end(), 0) == 499500);
+    };
+
+    frame();
+    REQUIRE(arena.GetOverflowCount() > 0);
+
+    // After one grow the same workload fits and stays off the heap
+    arena.Reset();
+    REQUIRE(arena.GetGrowCount() == 1);
+    REQUIRE(arena.GetCapacity() > 4000);
+    for (int i = 0; i < 5; ++i) {
+        frame();
+        REQUIRE(arena.GetOverflowCount() == 0);
+        arena.Reset();
+    }
+    REQUIRE(arena.GetGrowCount() == 1);
+}
+
+TEST_CASE("FrameArena backs the world queries", "[arena][world]") {
+    SimulatedWorld world({ .referenceCount = 500, .halfExtent = 500.0f });
+    auto* player = RE::PlayerCharacter::GetSingleton();
+    player->SetPosition({ 0, 0, 0 });
+
+    FrameArena arena;
+    arena.Reset();
+
+    FrameVector<RE::TESObjectREFR*> inSphere(&arena);
+    Util::WorldQuery::CollectInSphere(RE::TES::GetSingleton(), player, { 0, 0, 100 }, 300.0f,
+        [](RE::TESObjectREFR*) { return true; }, inSphere);
+
+    std::vector<RE::TESObjectREFR*> heapResult;
+    Util::WorldQuery::CollectInSphere(RE::TES::GetSingleton(), player, { 0, 0, 100 }, 300.0f,
+        [](RE::TESObjectREFR*) { return true; }, heapResult);
+    REQUIRE_FALSE(inSphere.empty());
+    REQUIRE(std::vector<RE::TESObjectREFR*>(inSphere.begin(), inSphere.end()) == heapResult);
+
+    FrameVector<Util::WorldQuery::WorldAABB> aabbs(&arena);
+    FrameSet<RE::FormID> excluded(&arena);
+    for (auto* ref : inSphere) {
+        Util::WorldQuery::WorldAABB aabb;
+        if (Util::WorldQuery::GetWorldAABB(ref, aabb)) {
+            aabbs.push_back(aabb);
+            excluded.insert(ref->GetFormID());
+        }
+    }
+
+    Util::WorldQuery::TouchingParams params;
+    params.maxResults = 1000;
+    FrameVector<RE::TESObjectREFR*> touching(&arena);
+    Util::WorldQuery::CollectTouching(world.GetCell(), {}, aabbs, excluded, params, touching);
+    for (auto* ref : touching) {
+        REQUIRE_FALSE(excluded.contains(ref->GetFormID()));
+    }
+
+    REQUIRE(arena.GetBytesUsed() > 0);
+    REQUIRE(arena.GetOverflowCount() == 0);
+}
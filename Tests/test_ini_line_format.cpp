@@ -0,0 +1,219 @@
+#include <catch2/catch_all.hpp>
+#include "persistence/IniLineFormat.h"
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+using namespace Persistence::IniLineFormat;
+
+// =============================================================================
+// IniLineFormat - text formatting shared by the AddedObjects and BOS writers
+// =============================================================================
+
+namespace {
+    constexpr uint32_t kInitiallyDisabledFlag = 0x00000800;
+
+    // The ostringstream formatter the writers used before IniLineFormat
+    // Kept as the reference the new output must match byte for byte
+    std::string LegacyFormatFloat(float value)
+    {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(4) << value;
+        std::string result = ss.str();
+
+        size_t dotPos = result.find('.');
+        if (dotPos != std::string::npos) {
+            size_t lastNonZero = result.find_last_not_of('0');
+            if (lastNonZero > dotPos) {
+                result.erase(lastNonZero + 1);
+            } else {
+                result.erase(dotPos);
+            }
+        }
+        return result;
+    }
+
+    std::string LegacySwapLine(const std::string& formKey, const RE::NiPoint3& pos, const RE::NiPoint3& rot,
+                               float scale, bool isDeleted)
+    {
+        std::ostringstream ss;
+        ss << formKey << "|";
+        ss << "posA(" << LegacyFormatFloat(pos.x) << "," << LegacyFormatFloat(pos.y) << ","
+           << LegacyFormatFloat(pos.z) << ")";
+        ss << ",rotA(" << LegacyFormatFloat(rot.x) << "," << LegacyFormatFloat(rot.y) << ","
+           << LegacyFormatFloat(rot.z) << ")";
+        if (std::abs(scale - 1.0f) > 0.0001f) {
+            ss << ",scaleA(" << LegacyFormatFloat(scale) << ")";
+        }
+        if (isDeleted) {
+            ss << ",flags(0x" << std::hex << std::setfill('0') << std::setw(8) << kInitiallyDisabledFlag << ")";
+        }
+        ss << "|100";
+        return ss.str();
+    }
+
+    struct GoldenEntry {
+        const char* form;
+        RE::NiPoint3 position;
+        RE::NiPoint3 rotation;
+        float scale;
+        bool isDeleted;
+    };
+
+    // Order matters - Tests/data/ini_line_format_golden.txt has one AddedObjects
+    // line and one BOS line per entry, in this order
+    const GoldenEntry kGoldenEntries[] = {
+        { "0x10C0E3~Skyrim.esm", { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, 1.0f, false },
+        { "0x10C0E3~Skyrim.esm", { -0.0f, 1.0f, -1.0f }, { 0.5f, 90.0f, 359.99999f }, 1.5f, true },
+        { "BarrelBase01", { 1234.5678f, -1234.56785f, 0.1f }, { 0.3f, 180.0f, 270.125f }, 0.25f, false },
+        { "0xF81B0~Dawnguard.esm", { 0.00005f, 0.00004999f, -0.00001f }, { 1e-5f, -1e-5f, 3.14159265f }, 1.00005f, true },
+        { "0x800~MyMod.esp", { 100000.125f, -98765.4321f, 16777216.0f }, { 2.675f, 45.00004f, 45.00005f }, 2.0f, false },
+        { "WRDragonStatue01", { 1e7f, -3.4e6f, 7.77777f }, { 12.3456789f, -0.49995f, 0.99995f }, 0.9999f, false },
+        { "0xABCDEF~Update.esm", { 3.4028235e38f, -1.17549435e-38f, 123.4f }, { 0.0001f, 0.00015f, 0.00025f }, 10.0f, true },
+    };
+
+    RE::NiPoint3 RandomPoint(std::mt19937& rng, std::uniform_real_distribution<float>& dist)
+    {
+        return RE::NiPoint3(dist(rng), dist(rng), dist(rng));
+    }
+
+    std::string ReadGoldenFile()
+    {
+        std::ifstream file(VREDITOR_TEST_DATA_DIR "/ini_line_format_golden.txt", std::ios::binary);
+        std::ostringstream ss;
+        ss << file.rdbuf();
+
+        // Tolerate a CRLF checkout (git autocrlf) - the writers emit '\n'
+        std::string text = ss.str();
+        std::erase(text, '\r');
+        return text;
+    }
+}
+
+TEST_CASE("IniLineFormat floats match the legacy formatter", "[persistence]") {
+    SECTION("Edge values") {
+        const float values[] = {
+            0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 0.1f, 0.3f, 2.675f, 0.00005f, 0.00004999f, -0.00004f,
+            1234.5678f, -1234.56785f, 359.99999f, 16777216.0f, 3.4028235e38f, -3.4028235e38f,
+            1.17549435e-38f, 1.4e-45f,
+        };
+        for (float value : values) {
+            INFO("value " << value);
+            REQUIRE(FormatFloat(value) == LegacyFormatFloat(value));
+        }
+    }
+
+    SECTION("Trailing zeros are trimmed") {
+        REQUIRE(FormatFloat(2.0f) == "2");
+        REQUIRE(FormatFloat(1.5f) == "1.5");
+        REQUIRE(FormatFloat(-0.00001f) == "-0");
+        REQUIRE(FormatFloat(0.12345f) == LegacyFormatFloat(0.12345f));
+    }
+
+    SECTION("Random world coordinates and angles") {
+        std::mt19937 rng(12345);
+        std::uniform_real_distribution<float> coords(-250000.0f, 250000.0f);
+        std::uniform_real_distribution<float> angles(-360.0f, 360.0f);
+        std::uniform_real_distribution<float> small(-0.001f, 0.001f);
+
+        for (int i = 0; i < 100000; ++i) {
+            for (float value : { coords(rng), angles(rng), small(rng) }) {
+                if (FormatFloat(value) != LegacyFormatFloat(value)) {
+                    INFO("value " << std::setprecision(9) << value);
+                    REQUIRE(FormatFloat(value) == LegacyFormatFloat(value));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("IniLineFormat lines match the golden file", "[persistence]") {
+    std::string generated;
+    for (const auto& entry : kGoldenEntries) {
+        AppendAddedObjectLine(generated, entry.form, entry.position, entry.rotation, entry.scale);
+        generated += '\n';
+        AppendSwapLine(generated, entry.form, entry.position, entry.rotation, entry.scale,
+                       entry.isDeleted ? kInitiallyDisabledFlag : 0);
+        generated += '\n';
+    }
+
+    const std::string golden = ReadGoldenFile();
+    REQUIRE_FALSE(golden.empty());
+    REQUIRE(generated == golden);
+}
+
+TEST_CASE("IniLineFormat swap lines match the legacy writer", "[persistence]") {
+    std::mt19937 rng(67890);
+    std::uniform_real_distribution<float> coords(-100000.0f, 100000.0f);
+    std::uniform_real_distribution<float> angles(0.0f, 360.0f);
+    std::uniform_real_distribution<float> scales(0.5f, 2.0f);
+
+    std::string line;
+    for (int i = 0; i < 1000; ++i) {
+        const RE::NiPoint3 pos = RandomPoint(rng, coords);
+        const RE::NiPoint3 rot = RandomPoint(rng, angles);
+        const float scale = (i % 3 == 0) ? 1.0f : scales(rng);
+        const bool isDeleted = (i % 5 == 0);
+
+        line.clear();
+        AppendSwapLine(line, "0x10C0E3~Skyrim.esm", pos, rot, scale, isDeleted ? kInitiallyDisabledFlag : 0);
+        REQUIRE(line == LegacySwapLine("0x10C0E3~Skyrim.esm", pos, rot, scale, isDeleted));
+    }
+}
+
+TEST_CASE("IniLineFormat comment and hex helpers", "[persistence]") {
+    std::string out;
+    AppendCommentLine(out, "Barrel01", "Barrel", "Clutter\\Barrel01.NIF", "");
+    REQUIRE(out == "; Barrel01|Barrel|Clutter\\Barrel01.NIF|");
+
+    out.clear();
+    AppendHex32(out, 0x800);
+    REQUIRE(out == "0x00000800");
+
+    out.clear();
+    AppendHex32(out, 0xDEADBEEF);
+    REQUIRE(out == "0xdeadbeef");
+
+    out.clear();
+    AppendHex32(out, 0);
+    REQUIRE(out == "0x00000000");
+}
+
+TEST_CASE("IniLineFormat writing 100k entries", "[.benchmark]") {
+    constexpr size_t kEntries = 100000;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coords(-100000.0f, 100000.0f);
+    std::uniform_real_distribution<float> angles(0.0f, 360.0f);
+
+    std::vector<GoldenEntry> entries;
+    entries.reserve(kEntries);
+    for (size_t i = 0; i < kEntries; ++i) {
+        entries.push_back({ "0x10C0E3~Skyrim.esm", RandomPoint(rng, coords), RandomPoint(rng, angles),
+                            (i % 4 == 0) ? 1.5f : 1.0f, (i % 10 == 0) });
+    }
+
+    BENCHMARK("ostringstream (legacy)") {
+        std::ostringstream file;
+        for (const auto& entry : entries) {
+            file << LegacySwapLine(entry.form, entry.position, entry.rotation, entry.scale, entry.isDeleted) << "\n";
+        }
+        return file.str().size();
+    };
+
+    BENCHMARK("to_chars into a reused buffer") {
+        std::ostringstream file;
+        std::string buffer;
+        for (const auto& entry : entries) {
+            buffer.clear();
+            AppendSwapLine(buffer, entry.form, entry.position, entry.rotation, entry.scale,
+                           entry.isDeleted ? kInitiallyDisabledFlag : 0);
+            buffer += '\n';
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+        return file.str().size();
+    };
+}
@@ -0,0 +1,403 @@
+#include <catch2/catch_all.hpp>
+#include "SimulatedWorld.h"
+#include "util/InputTrace.h"
+#include "util/WorldQuery.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <random>
+#include <string>
+#include <vector>
+
+// =============================================================================
+// InputTrace - binary format round trip and headless replay
+// =============================================================================
+
+using namespace Util::InputTrace;
+
+namespace {
+    constexpr uint64_t kTriggerMask = 1ull << 33;  // vr::k_EButton_SteamVR_Trigger
+    constexpr uint64_t kGripMask = 1ull << 2;      // vr::k_EButton_Grip
+
+    // Synthetic session: both hands sampled every frame, trigger pressed and released
+    // periodically, hands moving in a circle, the right one pointing at the floor
+    Writer MakeSession(size_t frames, uint32_t seed = 1)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> stick(-1.0f, 1.0f);
+
+        Writer writer;
+        uint64_t timeUs = 0;
+        for (size_t frame = 0; frame < frames; ++frame) {
+            for (bool isLeft : { true, false }) {
+                ControllerSample sample;
+                sample.packetNum = static_cast<uint32_t>(frame);
+                sample.buttonPressed = ((frame / 30) % 2 == 1 ? kTriggerMask : 0) | (isLeft && frame % 7 == 0 ? kGripMask : 0);
+                sample.buttonTouched = sample.buttonPressed;
+                sample.axis[0][0] = stick(rng);
+                sample.axis[0][1] = stick(rng);
+                sample.axis[1][0] = sample.buttonPressed & kTriggerMask ? 1.0f : 0.0f;
+                writer.AddController(timeUs, isLeft, sample);
+            }
+
+            FramePoses poses;
+            poses.mask = kPoseHmd | kPoseLeft | kPoseRight;
+            const float t = static_cast<float>(frame) * 0.05f;
+            poses.hmd.translate[2] = 120.0f;
+            poses.left.translate[0] = std::cos(t) * 40.0f;
+            poses.left.translate[1] = std::sin(t) * 40.0f;
+            poses.right.translate[0] = -poses.left.translate[0];
+            poses.right.translate[2] = 100.0f;
+            poses.right.rotate[0][1] = t;
+            poses.right.rotate[2][1] = -0.3f;  // Pointing forward and down
+            writer.AddFrame(timeUs, 1.0f / 90.0f, poses);
+
+            timeUs += 11111;
+        }
+        return writer;
+    }
+
+    std::vector<Record> ParseOrFail(const std::vector<uint8_t>& bytes)
+    {
+        auto records = Parse(bytes.data(), bytes.size());
+        REQUIRE(records.has_value());
+        return std::move(*records);
+    }
+
+    // Reproduces InputManager's press/release edge detection and keeps a log of
+    // everything delivered, so two replays can be compared event for event
+    class RecordingSink : public IReplaySink
+    {
+    public:
+        void ApplyControllerState(bool isLeft, const ControllerSample& sample) override
+        {
+            uint64_t& last = m_lastButtons[isLeft ? 0 : 1];
+            presses += std::popcount(sample.buttonPressed & ~last);
+            releases += std::popcount(last & ~sample.buttonPressed);
+            last = sample.buttonPressed;
+            log += std::format("C{}:{:x}:{};", isLeft ? 'L' : 'R', sample.buttonPressed, sample.axis[0][0]);
+        }
+
+        void ApplyPoses(const FramePoses& poses) override
+        {
+            log += std::format("P{}:{},{};", poses.mask, poses.left.translate[0], poses.right.rotate[0][1]);
+        }
+
+        void RunFrame(float deltaTime) override
+        {
+            frames++;
+            totalTime += deltaTime;
+            log += "F;";
+        }
+
+        std::string log;
+        int presses = 0;
+        int releases = 0;
+        int frames = 0;
+        double totalTime = 0.0;
+
+    private:
+        uint64_t m_lastButtons[2] = {};
+    };
+
+    // SphereSelectionController::OnFrameUpdate without the visuals, on a simulated
+    // world: the right thumbstick scales the radius, the right hand's pointing ray
+    // places the sphere (SimulatedWorld::Pick for Raycast::CastRay), and the
+    // throttled scan is WorldQuery::CollectInSphere. Constants mirror
+    // SphereSelectionController.h.
+    class SphereSelectionSink : public IReplaySink
+    {
+    public:
+        static constexpr float kDefaultRadius = 25.0f;
+        static constexpr float kMinRadius = 2.5f;
+        static constexpr float kMaxRadius = 1500.0f;
+        static constexpr float kScanIntervalMs = 50.0f;
+        static constexpr float kMaxRayDistance = 10000.0f;
+        static constexpr float kThumbstickDeadzone = 0.3f;
+        static constexpr float kRadiusScaleSpeed = 50.0f;
+
+        // verify: check every scan against a brute-force search (tests, not benchmarks)
+        SphereSelectionSink(SimulatedWorld& world, bool verify) :
+            m_world(world), m_verify(verify)
+        {
+            m_found.reserve(512);
+        }
+
+        void ApplyControllerState(bool isLeft, const ControllerSample& sample) override
+        {
+            if (isLeft) {
+                return;
+            }
+            const float x = sample.axis[0][0];
+            const float y = sample.axis[0][1];
+            m_thumbstickY = (std::abs(y) > kThumbstickDeadzone && std::abs(y) > std::abs(x)) ? y : 0.0f;
+        }
+
+        void ApplyPoses(const FramePoses& poses) override
+        {
+            if (poses.mask & kPoseHmd) {
+                const auto& t = poses.hmd.translate;
+                RE::PlayerCharacter::GetSingleton()->SetPosition({ t[0], t[1], t[2] });
+            }
+            if (poses.mask & kPoseRight) {
+                m_hand = poses.right;
+            }
+        }
+
+        void RunFrame(float deltaTime) override
+        {
+            if (std::abs(m_thumbstickY) > 0.01f) {
+                const float sign = m_thumbstickY > 0.0f ? 1.0f : -1.0f;
+                const float remapped = std::max(0.0f, (std::abs(m_thumbstickY) - kThumbstickDeadzone) / (1.0f - kThumbstickDeadzone));
+                radius = std::clamp(radius + sign * remapped * kRadiusScaleSpeed * deltaTime, kMinRadius, kMaxRadius);
+            }
+
+            // Pointing direction is the Y axis of the hand rotation
+            const RE::NiPoint3 origin{ m_hand.translate[0], m_hand.translate[1], m_hand.translate[2] };
+            RE::NiPoint3 direction{ m_hand.rotate[0][1], m_hand.rotate[1][1], m_hand.rotate[2][1] };
+            direction = direction * (1.0f / direction.Length());
+            auto hit = m_world.Pick(origin, direction, kMaxRayDistance);
+            m_center = hit ? hit->hitPoint : origin + direction * kMaxRayDistance;
+
+            m_timeSinceLastScan += deltaTime * 1000.0f;
+            if (m_timeSinceLastScan >= kScanIntervalMs) {
+                m_timeSinceLastScan = 0.0f;
+                Scan();
+            }
+        }
+
+        float radius = kDefaultRadius;
+        int scans = 0;
+        int mismatches = 0;
+        size_t totalFound = 0;
+        std::string log;  // Per scan: found count
+
+    private:
+        void Scan()
+        {
+            m_found.clear();
+            Util::WorldQuery::CollectInSphere(RE::TES::GetSingleton(), RE::PlayerCharacter::GetSingleton(), m_center,
+                                              radius, [](RE::TESObjectREFR*) { return true; }, m_found);
+            scans++;
+            totalFound += m_found.size();
+
+            if (m_verify) {
+                log += std::format("{};", m_found.size());
+                size_t expected = 0;
+                for (auto* ref : m_world.GetReferences()) {
+                    const RE::NiPoint3 d = ref->GetPosition() - m_center;
+                    if (Util::WorldQuery::IsSphereSelectable(ref) && d.x * d.x + d.y * d.y + d.z * d.z <= radius * radius) {
+                        expected++;
+                    }
+                }
+                if (expected != m_found.size()) {
+                    mismatches++;
+                }
+            }
+        }
+
+        SimulatedWorld& m_world;
+        bool m_verify;
+        float m_thumbstickY = 0.0f;
+        float m_timeSinceLastScan = kScanIntervalMs;  // Immediate first scan
+        Pose m_hand;
+        RE::NiPoint3 m_center;
+        std::vector<RE::TESObjectREFR*> m_found;
+    };
+}
+
+TEST_CASE("InputTrace round-trips controller states and frames", "[input]") {
+    Writer writer;
+    ControllerSample sample;
+    sample.packetNum = 42;
+    sample.buttonPressed = kTriggerMask | kGripMask;
+    sample.buttonTouched = kTriggerMask;
+    sample.axis[0][0] = -0.5f;
+    sample.axis[4][1] = 0.25f;
+    writer.AddController(100, true, sample);
+
+    FramePoses poses;
+    poses.mask = kPoseLeft;
+    poses.left.rotate[1][2] = 0.75f;
+    poses.left.translate[2] = -12.5f;
+    writer.AddFrame(200, 0.011f, poses);
+
+    REQUIRE(writer.GetControllerCount() == 1);
+    REQUIRE(writer.GetFrameCount() == 1);
+
+    const auto records = ParseOrFail(writer.GetBuffer());
+    REQUIRE(records.size() == 2);
+
+    const auto& controller = records[0];
+    REQUIRE(controller.type == RecordType::kController);
+    REQUIRE(controller.timeUs == 100);
+    REQUIRE(controller.isLeft);
+    REQUIRE(controller.controller.packetNum == 42);
+    REQUIRE(controller.controller.buttonPressed == (kTriggerMask | kGripMask));
+    REQUIRE(controller.controller.buttonTouched == kTriggerMask);
+    REQUIRE(controller.controller.axis[0][0] == -0.5f);
+    REQUIRE(controller.controller.axis[4][1] == 0.25f);
+
+    const auto& frame = records[1];
+    REQUIRE(frame.type == RecordType::kFrame);
+    REQUIRE(frame.timeUs == 200);
+    REQUIRE(frame.deltaTime == 0.011f);
+    REQUIRE(frame.poses.mask == kPoseLeft);
+    REQUIRE(frame.poses.left.rotate[1][2] == 0.75f);
+    REQUIRE(frame.poses.left.translate[2] == -12.5f);
+    REQUIRE(frame.poses.hmd.rotate[0][0] == 1.0f);
+}
+
+TEST_CASE("InputTrace timestamps do not wrap in long sessions", "[input]") {
+    constexpr uint64_t kThreeHoursUs = 3ull * 60 * 60 * 1000 * 1000;  // past uint32 microseconds
+    Writer writer;
+    writer.AddFrame(kThreeHoursUs, 0.011f, {});
+
+    const auto records = ParseOrFail(writer.GetBuffer());
+    REQUIRE(records.size() == 1);
+    REQUIRE(records[0].timeUs == kThreeHoursUs);
+}
+
+TEST_CASE("InputTrace rejects damaged traces", "[input]") {
+    auto bytes = MakeSession(3).GetBuffer();
+
+    SECTION("truncated record") {
+        bytes.pop_back();
+        REQUIRE_FALSE(Parse(bytes.data(), bytes.size()).has_value());
+    }
+
+    SECTION("wrong magic") {
+        bytes[0] = 'X';
+        REQUIRE_FALSE(Parse(bytes.data(), bytes.size()).has_value());
+    }
+
+    SECTION("unsupported version") {
+        const uint32_t version = kVersion + 1;
+        std::memcpy(bytes.data() + sizeof(kMagic), &version, sizeof(version));
+        REQUIRE_FALSE(Parse(bytes.data(), bytes.size()).has_value());
+    }
+
+    SECTION("unknown record type") {
+        bytes[kHeaderSize] = 0x7F;  // first record
+        REQUIRE_FALSE(Parse(bytes.data(), bytes.size()).has_value());
+    }
+
+    SECTION("header only is an empty trace") {
+        bytes.resize(kHeaderSize);
+        auto records = Parse(bytes.data(), bytes.size());
+        REQUIRE(records.has_value());
+        REQUIRE(records->empty());
+    }
+}
+
+TEST_CASE("InputTrace replay delivers controller states before their frame", "[input]") {
+    Replayer replayer(ParseOrFail(MakeSession(2).GetBuffer()));
+    RecordingSink sink;
+
+    REQUIRE(replayer.StepFrame(sink));
+    REQUIRE(sink.frames == 1);
+    REQUIRE(sink.log.starts_with("CL:"));
+    REQUIRE(sink.log.find(";CR:") < sink.log.find(";P7:"));
+    REQUIRE(sink.log.ends_with("F;"));
+
+    REQUIRE(replayer.StepFrame(sink));
+    REQUIRE_FALSE(replayer.StepFrame(sink));
+    REQUIRE(replayer.IsFinished());
+    REQUIRE(replayer.GetFramesPlayed() == 2);
+}
+
+TEST_CASE("InputTrace replay is deterministic", "[input]") {
+    const auto path = std::filesystem::temp_directory_path() / "vreditor_test_input.vrtrace";
+    constexpr size_t kFrames = 300;
+    REQUIRE(MakeSession(kFrames).Save(path));
+
+    auto loaded = Load(path);
+    std::filesystem::remove(path);
+    REQUIRE(loaded.has_value());
+
+    Replayer replayer(std::move(*loaded));
+    RecordingSink first;
+    while (replayer.StepFrame(first)) {}
+
+    replayer.Rewind();
+    RecordingSink second;
+    while (replayer.StepFrame(second)) {}
+
+    REQUIRE(first.frames == static_cast<int>(kFrames));
+    REQUIRE(first.totalTime == Catch::Approx(kFrames / 90.0).epsilon(1e-4));
+    REQUIRE(first.presses > 0);
+    REQUIRE(first.presses - first.releases <= 2);  // trigger may still be held at the end
+    REQUIRE(first.log == second.log);
+}
+
+TEST_CASE("InputTrace replay drives the sphere selection scan", "[input][world]") {
+    // A cluttered floor in front of the player: small references on a ground plane
+    // (the top of a huge bound sphere) the pointing ray lands on
+    SimulatedWorld world({ .referenceCount = 2000, .halfExtent = 512.0f, .height = 64.0f, .maxRadius = 24.0f });
+    world.AddReference({ RE::FormType::Static, RE::COL_LAYER::kGround, { 0, 0, -100000 }, 100000.0f, false });
+    constexpr size_t kFrames = 300;
+    Replayer replayer(ParseOrFail(MakeSession(kFrames).GetBuffer()));
+
+    SphereSelectionSink first(world, true);
+    while (replayer.StepFrame(first)) {}
+
+    // 90 Hz frames, one scan per 50 ms: the first frame and every fifth after it
+    REQUIRE(first.scans == static_cast<int>((kFrames + 4) / 5));
+    REQUIRE(first.mismatches == 0);
+    REQUIRE(first.totalFound > 0);
+    REQUIRE(first.radius != SphereSelectionSink::kDefaultRadius);
+    REQUIRE(first.radius >= SphereSelectionSink::kMinRadius);
+    REQUIRE(first.radius <= SphereSelectionSink::kMaxRadius);
+
+    replayer.Rewind();
+    SphereSelectionSink second(world, true);
+    while (replayer.StepFrame(second)) {}
+    REQUIRE(first.log == second.log);
+}
+
+TEST_CASE("InputTrace parse and step throughput", "[.benchmark]") {
+    // RecordingSink times the trace format and Replayer only; SphereSelectionSink
+    // adds the sphere selection loop. No other listener work is measured.
+    // Steps VREDITOR_REPLAY_TRACE (a recorded .vrtrace) if set, else a synthetic session
+    std::vector<Record> records;
+    std::vector<Record> sphereRecords;
+    if (const char* tracePath = std::getenv("VREDITOR_REPLAY_TRACE")) {
+        auto loaded = Load(tracePath);
+        REQUIRE(loaded.has_value());
+        records = std::move(*loaded);
+        sphereRecords = records;
+    } else {
+        records = ParseOrFail(MakeSession(10000).GetBuffer());
+        sphereRecords = ParseOrFail(MakeSession(1000).GetBuffer());  // Every frame picks across 10k references
+    }
+
+    Replayer replayer(std::move(records));
+
+    BENCHMARK("step session into a recording sink") {
+        replayer.Rewind();
+        RecordingSink sink;
+        while (replayer.StepFrame(sink)) {}
+        return sink.frames;
+    };
+
+    // The same trace through the sphere selection loop on 10k references
+    SimulatedWorld world({ .referenceCount = 10000, .halfExtent = 1024.0f, .height = 64.0f, .maxRadius = 24.0f });
+    world.AddReference({ RE::FormType::Static, RE::COL_LAYER::kGround, { 0, 0, -100000 }, 100000.0f, false });
+    Replayer sphereReplayer(std::move(sphereRecords));
+    BENCHMARK("replay session into sphere selection, 10k references") {
+        sphereReplayer.Rewind();
+        SphereSelectionSink sink(world, false);
+        while (sphereReplayer.StepFrame(sink)) {}
+        return sink.totalFound;
+    };
+
+    const auto bytes = MakeSession(10000).GetBuffer();
+    BENCHMARK("parse 10k frames") {
+        return Parse(bytes.data(), bytes.size())->size();
+    };
+}
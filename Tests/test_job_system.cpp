@@ -0,0 +1,256 @@
+#include <catch2/catch_all.hpp>
+#include "util/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using Util::JobGroup;
+using Util::JobSystem;
+
+// =============================================================================
+// JobSystem - work stealing, fork/join and main-thread continuations
+// =============================================================================
+
+namespace {
+    // Recursive fork/join: every call forks both halves into a nested group
+    uint64_t ParallelSum(JobSystem& jobs, uint64_t begin, uint64_t end)
+    {
+        if (end - begin <= 64) {
+            uint64_t sum = 0;
+            for (uint64_t i = begin; i < end; ++i) {
+                sum += i;
+            }
+            return sum;
+        }
+
+        const uint64_t middle = begin + (end - begin) / 2;
+        uint64_t left = 0;
+        uint64_t right = 0;
+        JobGroup group(&jobs);
+        group.Run([&] { left = ParallelSum(jobs, begin, middle); });
+        group.Run([&] { right = ParallelSum(jobs, middle, end); });
+        group.Wait();
+        return left + right;
+    }
+}
+
+TEST_CASE("JobSystem runs jobs inline until started", "[jobs]") {
+    JobSystem jobs;
+    REQUIRE_FALSE(jobs.IsRunning());
+
+    const auto caller = std::this_thread::get_id();
+    std::thread::id ranOn;
+    jobs.Schedule([&] { ranOn = std::this_thread::get_id(); });
+    REQUIRE(ranOn == caller);
+
+    size_t covered = 0;
+    jobs.ParallelFor(100, 10, [&](size_t begin, size_t end) { covered += end - begin; });
+    REQUIRE(covered == 100);
+}
+
+TEST_CASE("JobSystem runs every scheduled job before shutdown returns", "[jobs]") {
+    JobSystem jobs;
+    jobs.Start(4);
+    REQUIRE(jobs.IsRunning());
+    REQUIRE(jobs.GetWorkerCount() == 4);
+
+    constexpr size_t kJobs = 20000;
+    std::atomic<size_t> ran{ 0 };
+    for (size_t i = 0; i < kJobs; ++i) {
+        jobs.Schedule([&] { ran.fetch_add(1, std::memory_order_relaxed); });
+    }
+
+    jobs.Shutdown();
+    REQUIRE_FALSE(jobs.IsRunning());
+    REQUIRE(ran.load() == kJobs);
+
+    // Inline again once stopped
+    jobs.Schedule([&] { ran.fetch_add(1); });
+    REQUIRE(ran.load() == kJobs + 1);
+}
+
+TEST_CASE("JobSystem idle workers steal from a busy worker's deque", "[jobs]") {
+    JobSystem jobs;
+    jobs.Start(4);
+
+    // Everything is forked from one job, so it all lands in that worker's deque
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    JobGroup outer(&jobs);
+    outer.Run([&] {
+        JobGroup inner(&jobs);
+        for (int i = 0; i < 64; ++i) {
+            inner.Run([&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                std::lock_guard lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            });
+        }
+        inner.Wait();
+    });
+    outer.Wait();
+
+    REQUIRE(threads.size() > 1);
+}
+
+TEST_CASE("JobSystem fork/join stress", "[jobs]") {
+    JobSystem jobs;
+    jobs.Start(4);
+
+    constexpr uint64_t kCount = 200000;
+    const uint64_t expected = kCount * (kCount - 1) / 2;
+
+    // Nested groups several thousand deep in total, waited on from workers and the caller
+    for (int round = 0; round < 20; ++round) {
+        REQUIRE(ParallelSum(jobs, 0, kCount) == expected);
+    }
+
+    // Outside threads forking into the same pool at once
+    std::vector<std::thread> callers;
+    std::atomic<int> correct{ 0 };
+    for (int i = 0; i < 4; ++i) {
+        callers.emplace_back([&] {
+            for (int round = 0; round < 5; ++round) {
+                if (ParallelSum(jobs, 0, kCount) == expected) {
+                    correct.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    REQUIRE(correct.load() == 20);
+}
+
+TEST_CASE("JobSystem ParallelFor covers each index once", "[jobs]") {
+    JobSystem jobs;
+    jobs.Start(3);
+
+    for (size_t grain : { size_t(1), size_t(7), size_t(64), size_t(1000), size_t(5000) }) {
+        std::vector<std::atomic<int>> hits(1000);
+        jobs.ParallelFor(hits.size(), grain, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                hits[i].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        INFO("grain " << grain);
+        for (const auto& hit : hits) {
+            REQUIRE(hit.load() == 1);
+        }
+    }
+}
+
+TEST_CASE("JobSystem continuations run on the thread that drains them", "[jobs]") {
+    JobSystem jobs;
+    jobs.Start(2);
+
+    const auto mainThread = std::this_thread::get_id();
+    std::vector<int> results;
+    std::vector<std::thread::id> workThreads;
+    std::mutex mutex;
+    int thenCount = 0;
+
+    JobGroup group(&jobs);
+    for (int i = 0; i < 10; ++i) {
+        group.Run([&, i] {
+            jobs.ScheduleThen(
+                [&, i] {
+                    std::lock_guard lock(mutex);
+                    workThreads.push_back(std::this_thread::get_id());
+                    return i * i;
+                },
+                [&](int square) {
+                    REQUIRE(std::this_thread::get_id() == mainThread);
+                    results.push_back(square);
+                });
+            jobs.ScheduleThen([] {}, [&] { thenCount++; });
+        });
+    }
+    group.Wait();
+
+    // The ScheduleThen work jobs are not part of the group - wait for their continuations
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (jobs.GetPendingContinuationCount() < 20 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    REQUIRE(jobs.GetPendingContinuationCount() == 20);
+    REQUIRE(results.empty());
+
+    // FrameCallbackDispatcher's call in game
+    jobs.OnFrameUpdate(0.016f);
+    REQUIRE(jobs.GetPendingContinuationCount() == 0);
+    REQUIRE(thenCount == 10);
+
+    std::sort(results.begin(), results.end());
+    REQUIRE(results == std::vector<int>{ 0, 1, 4, 9, 16, 25, 36, 49, 64, 81 });
+    for (const auto& id : workThreads) {
+        REQUIRE(id != mainThread);
+    }
+
+    // Continuations queued by continuations wait for the next frame
+    jobs.RunOnMainThread([&] { jobs.RunOnMainThread([&] { thenCount++; }); });
+    REQUIRE(jobs.RunMainThreadContinuations() == 1);
+    REQUIRE(thenCount == 10);
+    REQUIRE(jobs.RunMainThreadContinuations() == 1);
+    REQUIRE(thenCount == 11);
+}
+
+TEST_CASE("JobSystem exceptions", "[jobs]") {
+    JobSystem jobs;
+    jobs.Start(2);
+
+    SECTION("a group rethrows the first one from Wait") {
+        JobGroup group(&jobs);
+        std::atomic<int> ran{ 0 };
+        for (int i = 0; i < 8; ++i) {
+            group.Run([&, i] {
+                ran.fetch_add(1);
+                if (i == 3) {
+                    throw std::runtime_error("job failed");
+                }
+            });
+        }
+        REQUIRE_THROWS_WITH(group.Wait(), "job failed");
+        REQUIRE(ran.load() == 8);
+
+        // Nothing left to rethrow
+        REQUIRE_NOTHROW(group.Wait());
+    }
+
+    SECTION("a plain job is logged and the pool keeps working") {
+        jobs.Schedule([] { throw std::runtime_error("ignored"); });
+        REQUIRE(ParallelSum(jobs, 0, 10000) == 10000ull * 9999 / 2);
+    }
+}
+
+TEST_CASE("JobSystem restarts cleanly", "[jobs]") {
+    JobSystem jobs;
+    for (size_t workers = 1; workers <= 8; ++workers) {
+        jobs.Start(workers);
+        REQUIRE(jobs.GetWorkerCount() == workers);
+
+        // Jobs still queued (and forking) at shutdown are run, not dropped
+        std::atomic<size_t> ran{ 0 };
+        for (int i = 0; i < 100; ++i) {
+            jobs.Schedule([&] {
+                ran.fetch_add(1);
+                jobs.Schedule([&] { ran.fetch_add(1); });
+            });
+        }
+        jobs.Shutdown();
+        REQUIRE(ran.load() == 200);
+        REQUIRE(jobs.GetWorkerCount() == 0);
+    }
+
+    REQUIRE(JobSystem::GetDefaultWorkerCount() >= 1);
+    REQUIRE(JobSystem::GetDefaultWorkerCount() <= 4);
+}
@@ -0,0 +1,71 @@
+#include <catch2/catch_all.hpp>
+#include "TestStubs.h"
+#include "log.h"
+
+// =============================================================================
+// LOG_* macros - arguments must not be evaluated when the level is disabled
+// =============================================================================
+
+namespace {
+    int g_evaluations = 0;
+
+    int CountedArgument()
+    {
+        return ++g_evaluations;
+    }
+
+    // Restores the runtime level even if a REQUIRE fails
+    struct RuntimeLevelGuard {
+        ~RuntimeLevelGuard() { Log::SetLevel(Log::kTrace); }
+    };
+}
+
+TEST_CASE("LOG macros skip argument evaluation below the runtime level", "[log]") {
+    RuntimeLevelGuard guard;
+    g_evaluations = 0;
+
+    Log::SetLevel(Log::kWarn);
+    LOG_TRACE("trace {}", CountedArgument());
+    LOG_DEBUG("debug {}", CountedArgument());
+    LOG_INFO("info {}", CountedArgument());
+    REQUIRE(g_evaluations == 0);
+
+    LOG_WARN("warn {}", CountedArgument());
+    REQUIRE(g_evaluations == 1);
+
+    Log::SetLevel(Log::kOff);
+    LOG_ERROR("error {}", CountedArgument());
+    REQUIRE(g_evaluations == 1);
+}
+
+TEST_CASE("LOG macros honour the compile-time minimum", "[log]") {
+    RuntimeLevelGuard guard;
+    Log::SetLevel(Log::kTrace);
+
+    REQUIRE(Log::IsEnabled(Log::kTrace) == (VREDIT_LOG_MIN_LEVEL <= Log::kTrace));
+    REQUIRE(Log::IsEnabled(Log::kError));
+}
+
+TEST_CASE("Log::SetLevel clamps out-of-range values", "[log]") {
+    RuntimeLevelGuard guard;
+
+    Log::SetLevel(-5);
+    REQUIRE(Log::g_runtimeLevel.load() == Log::kTrace);
+
+    Log::SetLevel(42);
+    REQUIRE(Log::g_runtimeLevel.load() == Log::kOff);
+    REQUIRE_FALSE(Log::IsEnabled(Log::kCritical));
+}
+
+TEST_CASE("LOG macros work as unbraced if/else bodies", "[log]") {
+    RuntimeLevelGuard guard;
+    Log::SetLevel(Log::kOff);
+
+    bool elseTaken = false;
+    if (g_evaluations < 0)
+        LOG_INFO("never");
+    else
+        elseTaken = true;
+
+    REQUIRE(elseTaken);
+}
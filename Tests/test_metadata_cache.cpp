@@ -0,0 +1,77 @@
+#include <catch2/catch_all.hpp>
+#include "persistence/BaseFormMetadataCache.h"
+
+using Persistence::BaseFormMetadataCache;
+
+// =============================================================================
+// BaseFormMetadataCache - exporter comment metadata, read once per base form
+// =============================================================================
+
+namespace {
+    class TestStatic : public RE::TESForm, public RE::TESModel {
+    public:
+        TestStatic(RE::FormID id, std::string edid, std::string fullName, std::string mesh)
+        {
+            formID = id;
+            formType = RE::FormType::Static;
+            editorId = std::move(edid);
+            name = std::move(fullName);
+            model = std::move(mesh);
+        }
+    };
+}
+
+TEST_CASE("BaseFormMetadataCache reads a base form once", "[persistence]") {
+    auto* cache = BaseFormMetadataCache::GetSingleton();
+    cache->Invalidate();
+
+    TestStatic barrel(0x00012345, "Barrel01", "Barrel", "Clutter\\Barrel01.nif");
+    RE::TESForm light;
+    light.formID = 0x00054321;
+    light.formType = RE::FormType::Light;
+
+    const auto first = cache->Get(&barrel);
+    REQUIRE(first.editorId == "Barrel01");
+    REQUIRE(first.displayName == "Barrel");
+    REQUIRE(first.meshName == "Clutter\\Barrel01.nif");
+    REQUIRE(first.formTypeName == "STAT");
+    REQUIRE(cache->GetMissCount() == 1);
+
+    // Later reads come from the cache, not the form
+    barrel.name = "Renamed";
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(cache->Get(&barrel).displayName == "Barrel");
+    }
+    REQUIRE(cache->GetHitCount() == 10);
+    REQUIRE(cache->GetMissCount() == 1);
+
+    // Forms without a model still get their type code
+    const auto lightMetadata = cache->Get(&light);
+    REQUIRE(lightMetadata.IsEmpty());
+    REQUIRE(lightMetadata.formTypeName == "LIGH");
+    REQUIRE(cache->GetSize() == 2);
+
+    SECTION("Find only reports cached forms") {
+        REQUIRE(cache->Find(0x00012345)->meshName == "Clutter\\Barrel01.nif");
+        REQUIRE_FALSE(cache->Find(0x00099999).has_value());
+    }
+
+    SECTION("Invalidate re-reads the form") {
+        cache->Invalidate();
+        REQUIRE(cache->GetSize() == 0);
+        REQUIRE_FALSE(cache->Find(0x00012345).has_value());
+        REQUIRE(cache->Get(&barrel).displayName == "Renamed");
+        REQUIRE(cache->GetMissCount() == 1);
+    }
+
+    SECTION("dynamic forms are never cached") {
+        TestStatic spawned(0xFF000801, "", "Spawned", "Clutter\\Bucket01.nif");
+        REQUIRE(cache->Get(&spawned).displayName == "Spawned");
+        spawned.name = "Respawned";
+        REQUIRE(cache->Get(&spawned).displayName == "Respawned");
+        REQUIRE_FALSE(cache->Find(0xFF000801).has_value());
+        REQUIRE(cache->GetSize() == 2);
+    }
+
+    REQUIRE(cache->Get(nullptr).IsCompletelyEmpty());
+}
@@ -0,0 +1,137 @@
+#include <catch2/catch_all.hpp>
+
+// The profiler is compiled out of normal builds - force it on for this file
+#define VREDIT_PROFILER
+#include "util/Profiler.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+// =============================================================================
+// Profiler - zone recording and Chrome trace output
+// =============================================================================
+
+namespace {
+    size_t CountOccurrences(const std::string& text, const std::string& needle)
+    {
+        size_t count = 0;
+        for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+            count++;
+        }
+        return count;
+    }
+
+    std::string Capture()
+    {
+        std::string json;
+        Util::Profiler::WriteChromeTrace(json);
+        return json;
+    }
+}
+
+TEST_CASE("Profiler records nothing outside a capture", "[profiler]") {
+    Util::Profiler::Stop();
+    Util::Profiler::Start();
+    Util::Profiler::Stop();
+    {
+        PROFILE_ZONE("idle");
+    }
+
+    const std::string json = Capture();
+    REQUIRE(json == "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[]}");
+}
+
+TEST_CASE("Profiler writes balanced nested zones", "[profiler]") {
+    Util::Profiler::Start();
+    {
+        PROFILE_ZONE("outer");
+        {
+            PROFILE_ZONE("inner \"quoted\"");
+        }
+    }
+    Util::Profiler::Stop();
+
+    const std::string json = Capture();
+    REQUIRE(CountOccurrences(json, "\"ph\":\"B\"") == 2);
+    REQUIRE(CountOccurrences(json, "\"ph\":\"E\"") == 2);
+    REQUIRE(json.find("\"name\":\"outer\"") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"inner \\\"quoted\\\"\"") != std::string::npos);
+
+    // B outer, B inner, E inner, E outer
+    REQUIRE(json.find("\"name\":\"outer\",\"ph\":\"B\"") < json.find("\"ph\":\"E\""));
+}
+
+TEST_CASE("Profiler drops end events of zones opened before the capture", "[profiler]") {
+    Util::Profiler::Stop();
+    {
+        Util::Profiler::Zone early("early");  // not recording - records nothing
+        Util::Profiler::Start();
+        PROFILE_ZONE("late");
+    }
+    Util::Profiler::Stop();
+
+    const std::string json = Capture();
+    REQUIRE(json.find("early") == std::string::npos);
+    REQUIRE(CountOccurrences(json, "\"name\":\"late\"") == 2);
+}
+
+TEST_CASE("Profiler keeps the newest events when a thread wraps its buffer", "[profiler]") {
+    Util::Profiler::Start();
+    const size_t zones = Util::Profiler::kEventsPerThread;  // 2x the buffer in events
+    for (size_t i = 0; i < zones; ++i) {
+        PROFILE_ZONE("loop");
+    }
+    Util::Profiler::Stop();
+
+    const std::string json = Capture();
+    REQUIRE(CountOccurrences(json, "\"ph\":\"B\"") == zones / 2);
+    REQUIRE(CountOccurrences(json, "\"ph\":\"E\"") == zones / 2);
+}
+
+TEST_CASE("Profiler separates threads", "[profiler]") {
+    Util::Profiler::Start();
+    {
+        PROFILE_ZONE("main");
+    }
+    std::thread worker([] { PROFILE_ZONE("worker"); });
+    worker.join();
+    Util::Profiler::Stop();
+
+    const std::string json = Capture();
+    const size_t mainPos = json.find("\"name\":\"main\"");
+    const size_t workerPos = json.find("\"name\":\"worker\"");
+    REQUIRE(mainPos != std::string::npos);
+    REQUIRE(workerPos != std::string::npos);
+
+    auto tidAt = [&](size_t pos) {
+        const size_t tid = json.find("\"tid\":", pos) + 6;
+        return json.substr(tid, json.find(',', tid) - tid);
+    };
+    REQUIRE(tidAt(mainPos) != tidAt(workerPos));
+}
+
+TEST_CASE("Profiler writes a trace while other threads record", "[profiler]") {
+    Util::Profiler::Start();
+
+    // Enough zones to wrap the buffer while the trace is being copied
+    std::atomic<bool> done{ false };
+    std::thread worker([&] {
+        while (!done.load()) {
+            PROFILE_ZONE("spin");
+        }
+    });
+
+    for (int i = 0; i < 20; ++i) {
+        const std::string json = Capture();
+        REQUIRE(json.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+        REQUIRE(json.ends_with("]}"));
+        // Every event is one of the worker's, and every end has its begin
+        REQUIRE(CountOccurrences(json, "\"name\":\"spin\"") == CountOccurrences(json, "\"name\":"));
+        REQUIRE(CountOccurrences(json, "\"ph\":\"E\"") <= CountOccurrences(json, "\"ph\":\"B\""));
+    }
+
+    done.store(true);
+    worker.join();
+    Util::Profiler::Stop();
+}
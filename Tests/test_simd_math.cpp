@@ -0,0 +1,282 @@
+#include <catch2/catch_all.hpp>
+#include "util/RotationMath.h"
+#include "util/SimdMath.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Util::SimdMath;
+
+// =============================================================================
+// SimdMath - SSE results checked against the scalar code they replaced
+// =============================================================================
+// The Legacy* functions are verbatim copies of PositioningUtil::MultiplyMatrices,
+// PositioningUtil::RotationAroundZ, HandRotationTransformer::InvertRotation,
+// RemoteGrabController's offset rotation and RotationMath::EulerToMatrix /
+// RotatePointAroundZ as they were before SimdMath. Everything must match them
+// bit for bit except SinCos itself, which gets a few ulp.
+
+namespace {
+    RE::NiMatrix3 LegacyMultiply(const RE::NiMatrix3& a, const RE::NiMatrix3& b)
+    {
+        RE::NiMatrix3 result;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                result.entry[i][j] =
+                    a.entry[i][0] * b.entry[0][j] +
+                    a.entry[i][1] * b.entry[1][j] +
+                    a.entry[i][2] * b.entry[2][j];
+            }
+        }
+        return result;
+    }
+
+    RE::NiMatrix3 LegacyTranspose(const RE::NiMatrix3& m)
+    {
+        RE::NiMatrix3 result;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                result.entry[i][j] = m.entry[j][i];
+            }
+        }
+        return result;
+    }
+
+    RE::NiPoint3 LegacyRotateAround(const RE::NiMatrix3& m, const RE::NiPoint3& center, const RE::NiPoint3& p)
+    {
+        RE::NiPoint3 offset = { p.x - center.x, p.y - center.y, p.z - center.z };
+        RE::NiPoint3 rotatedOffset = {
+            m.entry[0][0] * offset.x + m.entry[0][1] * offset.y + m.entry[0][2] * offset.z,
+            m.entry[1][0] * offset.x + m.entry[1][1] * offset.y + m.entry[1][2] * offset.z,
+            m.entry[2][0] * offset.x + m.entry[2][1] * offset.y + m.entry[2][2] * offset.z
+        };
+        return { center.x + rotatedOffset.x, center.y + rotatedOffset.y, center.z + rotatedOffset.z };
+    }
+
+    RE::NiMatrix3 LegacyEulerToMatrix(const RE::NiPoint3& angles)
+    {
+        float cx = std::cos(angles.x);
+        float sx = std::sin(angles.x);
+        float cy = std::cos(angles.y);
+        float sy = std::sin(angles.y);
+        float cz = std::cos(angles.z);
+        float sz = std::sin(angles.z);
+
+        RE::NiMatrix3 result;
+        result.entry[0][0] = cy * cz;
+        result.entry[0][1] = -cy * sz;
+        result.entry[0][2] = sy;
+
+        result.entry[1][0] = sx * sy * cz + cx * sz;
+        result.entry[1][1] = -sx * sy * sz + cx * cz;
+        result.entry[1][2] = -sx * cy;
+
+        result.entry[2][0] = -cx * sy * cz + sx * sz;
+        result.entry[2][1] = cx * sy * sz + sx * cz;
+        result.entry[2][2] = cx * cy;
+
+        return result;
+    }
+
+    RE::NiMatrix3 LegacyRotationAroundZ(float angle)
+    {
+        RE::NiMatrix3 result;
+        float c = std::cos(angle);
+        float s = std::sin(angle);
+
+        result.entry[0][0] = c;
+        result.entry[0][1] = -s;
+        result.entry[0][2] = 0.0f;
+
+        result.entry[1][0] = s;
+        result.entry[1][1] = c;
+        result.entry[1][2] = 0.0f;
+
+        result.entry[2][0] = 0.0f;
+        result.entry[2][1] = 0.0f;
+        result.entry[2][2] = 1.0f;
+
+        return result;
+    }
+
+    RE::NiPoint3 LegacyRotatePointAroundZ(const RE::NiPoint3& point, const RE::NiPoint3& origin, float angle)
+    {
+        float c = std::cos(angle);
+        float s = std::sin(angle);
+
+        float dx = point.x - origin.x;
+        float dy = point.y - origin.y;
+
+        float rx = dx * c - dy * s;
+        float ry = dx * s + dy * c;
+
+        return RE::NiPoint3{ origin.x + rx, origin.y + ry, point.z };
+    }
+
+    std::vector<RE::NiPoint3> RandomAngles(size_t count, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> angle(-6.3f, 6.3f);
+        std::vector<RE::NiPoint3> angles(count);
+        for (auto& a : angles) {
+            a = RE::NiPoint3(angle(rng), angle(rng), angle(rng));
+        }
+        return angles;
+    }
+
+    std::vector<RE::NiPoint3> RandomPoints(size_t count, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> coord(-50000.0f, 50000.0f);
+        std::vector<RE::NiPoint3> points(count);
+        for (auto& p : points) {
+            p = RE::NiPoint3(coord(rng), coord(rng), coord(rng));
+        }
+        return points;
+    }
+
+    void RequireIdentical(const RE::NiMatrix3& a, const RE::NiMatrix3& b)
+    {
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                REQUIRE(a.entry[i][j] == b.entry[i][j]);
+            }
+        }
+    }
+
+    void RequireNear(const RE::NiMatrix3& a, const RE::NiMatrix3& b, float margin)
+    {
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                REQUIRE(std::abs(a.entry[i][j] - b.entry[i][j]) <= margin);
+            }
+        }
+    }
+}
+
+TEST_CASE("SimdMath matrix products match the scalar code exactly", "[math]") {
+    const auto angles = RandomAngles(200, 11);
+    std::vector<RE::NiMatrix3> matrices;
+    for (const auto& a : angles) {
+        matrices.push_back(LegacyEulerToMatrix(a));
+    }
+    // Non-rotations too - nothing here relies on orthonormality
+    RE::NiMatrix3 skewed;
+    skewed.entry[0][1] = 3.5f;
+    skewed.entry[2][0] = -1e-3f;
+    skewed.entry[1][1] = 1e4f;
+    matrices.push_back(skewed);
+
+    for (size_t i = 0; i + 1 < matrices.size(); ++i) {
+        RequireIdentical(Multiply(matrices[i], matrices[i + 1]), LegacyMultiply(matrices[i], matrices[i + 1]));
+        RequireIdentical(InvertRotation(matrices[i]), LegacyTranspose(matrices[i]));
+    }
+}
+
+TEST_CASE("SimdMath point rotation matches the scalar code exactly", "[math]") {
+    const auto points = RandomPoints(500, 12);
+    const RE::NiMatrix3 rotation = LegacyEulerToMatrix({ 0.3f, -1.2f, 2.5f });
+    const RE::NiPoint3 center(1234.5f, -987.25f, 40.0f);
+
+    std::vector<RE::NiPoint3> batch(points.size());
+    RotatePointsAround(rotation, center, points, batch);
+
+    std::vector<RE::NiPoint3> transformed(points.size());
+    TransformPoints(rotation, points, transformed);
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        const RE::NiPoint3 expected = LegacyRotateAround(rotation, center, points[i]);
+        REQUIRE(RotateAround(rotation, center, points[i]) == expected);
+        REQUIRE(batch[i] == expected);
+        REQUIRE(transformed[i] == LegacyRotateAround(rotation, {}, points[i]));
+        REQUIRE(Transform(rotation, points[i]) == transformed[i]);
+    }
+
+    SECTION("in-place batches") {
+        std::vector<RE::NiPoint3> inPlace = points;
+        TransformPoints(rotation, inPlace, inPlace);
+        REQUIRE(inPlace == transformed);
+    }
+
+    SECTION("a shorter output span bounds the batch") {
+        std::vector<RE::NiPoint3> two(2);
+        TransformPoints(rotation, points, two);
+        REQUIRE(two[1] == transformed[1]);
+    }
+}
+
+TEST_CASE("SimdMath SinCos stays within a few ulp of std::sin and std::cos", "[math]") {
+    constexpr float kMargin = 3.0e-7f;  // ~2.5 ulp at 1.0
+
+    for (float angle = -100.0f; angle <= 100.0f; angle += 0.00731f) {
+        float s, c;
+        SinCos(angle, s, c);
+        REQUIRE(std::abs(s - std::sin(angle)) <= kMargin);
+        REQUIRE(std::abs(c - std::cos(angle)) <= kMargin);
+    }
+
+    SECTION("exact at zero") {
+        float s, c;
+        SinCos(0.0f, s, c);
+        REQUIRE(s == 0.0f);
+        REQUIRE(c == 1.0f);
+    }
+
+    SECTION("all four lanes are independent") {
+        alignas(16) float s[4];
+        alignas(16) float c[4];
+        __m128 sines, cosines;
+        SinCos(_mm_set_ps(-2.0f, 3.0f, -0.5f, 1.0f), sines, cosines);
+        _mm_store_ps(s, sines);
+        _mm_store_ps(c, cosines);
+        const float angles[4] = { 1.0f, -0.5f, 3.0f, -2.0f };
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(std::abs(s[i] - std::sin(angles[i])) <= kMargin);
+            REQUIRE(std::abs(c[i] - std::cos(angles[i])) <= kMargin);
+        }
+    }
+}
+
+TEST_CASE("SimdMath Euler and Z rotations match the scalar code exactly", "[math]") {
+    for (const auto& angles : RandomAngles(500, 13)) {
+        RequireIdentical(EulerToMatrix(angles), LegacyEulerToMatrix(angles));
+        RequireIdentical(Util::RotationMath::EulerToMatrix(angles), LegacyEulerToMatrix(angles));
+    }
+
+    // Including angles past a few turns, where a polynomial's range reduction drifts
+    const auto points = RandomPoints(500, 15);
+    const RE::NiPoint3 origin(-310.5f, 2048.0f, 12.0f);
+    for (size_t i = 0; i < points.size(); ++i) {
+        const float angle = -200.0f + 0.8f * static_cast<float>(i);
+        RequireIdentical(RotationAroundZ(angle), LegacyRotationAroundZ(angle));
+        REQUIRE(Util::RotationMath::RotatePointAroundZ(points[i], origin, angle) ==
+                LegacyRotatePointAroundZ(points[i], origin, angle));
+    }
+}
+
+TEST_CASE("SimdMath quaternions round-trip rotations", "[math]") {
+    for (const auto& angles : RandomAngles(200, 14)) {
+        const RE::NiMatrix3 m = LegacyEulerToMatrix(angles);
+        RequireNear(Quat::FromMatrix(m).ToMatrix(), m, 1.0e-5f);
+    }
+
+    SECTION("slerp endpoints and shortest path") {
+        const RE::NiMatrix3 a = LegacyEulerToMatrix({ 0.1f, 0.2f, 0.3f });
+        const RE::NiMatrix3 b = LegacyEulerToMatrix({ -0.4f, 1.0f, 2.9f });
+        const Quat qa = Quat::FromMatrix(a);
+        const Quat qb = Quat::FromMatrix(b);
+
+        RequireNear(Quat::Slerp(qa, qb, 0.0f).ToMatrix(), a, 1.0e-5f);
+        RequireNear(Quat::Slerp(qa, qb, 1.0f).ToMatrix(), b, 1.0e-5f);
+
+        // q and -q are the same rotation
+        const Quat negated{ _mm_xor_ps(qb.v, _mm_set1_ps(-0.0f)) };
+        RequireNear(Quat::Slerp(qa, negated, 0.5f).ToMatrix(), Quat::Slerp(qa, qb, 0.5f).ToMatrix(), 1.0e-6f);
+    }
+
+    SECTION("degenerate quaternions normalize to identity") {
+        const Quat tiny = Quat::FromWXYZ(0.0f, 1e-6f, 0.0f, 0.0f);
+        RequireIdentical(tiny.Normalize().ToMatrix(), RE::NiMatrix3());
+    }
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch_all.hpp>
+#include "persistence/EntryMetadata.h"
+#include "persistence/StringPool.h"
+
+#include <format>
+#include <string>
+
+using namespace Persistence;
+
+// =============================================================================
+// StringPool - interned metadata strings and comment parsing on top of them
+// =============================================================================
+
+TEST_CASE("StringPool stores each distinct string once", "[persistence]") {
+    auto* pool = StringPool::GetSingleton();
+
+    std::string first = "Clutter\\StringPoolTest\\Barrel01.nif";
+    std::string second = first;  // Equal contents, different buffer
+    const std::string_view a = pool->Intern(first);
+    const size_t count = pool->GetStringCount();
+    const size_t bytes = pool->GetBytesStored();
+
+    const std::string_view b = pool->Intern(second);
+    REQUIRE(a == first);
+    REQUIRE(a.data() == b.data());
+    REQUIRE(a.data() != first.data());
+    REQUIRE(pool->GetStringCount() == count);
+    REQUIRE(pool->GetBytesStored() == bytes);
+
+    // Pooled copies outlive the strings they came from
+    first.assign(first.size(), 'x');
+    REQUIRE(a == second);
+
+    SECTION("empty strings never reach the pool") {
+        REQUIRE(pool->Intern("").empty());
+        REQUIRE(pool->GetStringCount() == count);
+    }
+
+    SECTION("long strings keep their contents") {
+        const std::string longPath(40000, 'm');
+        const std::string_view pooled = pool->Intern(longPath);
+        REQUIRE(pooled == longPath);
+        REQUIRE(pool->Intern(std::string(longPath)).data() == pooled.data());
+        REQUIRE(pool->Intern("StringPoolTestAfterLong") == "StringPoolTestAfterLong");
+    }
+}
+
+TEST_CASE("InternedString behaves like a string value", "[persistence]") {
+    InternedString editorId = "StringPoolTestChair";
+    InternedString fromString = std::string("StringPoolTestChair");
+    REQUIRE(editorId == "StringPoolTestChair");
+    REQUIRE(editorId.data() == fromString.data());
+    REQUIRE(editorId.size() == 19);
+    REQUIRE(std::format("'{}'", editorId) == "'StringPoolTestChair'");
+
+    InternedString empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty == std::string_view());
+    empty = static_cast<const char*>(nullptr);
+    REQUIRE(empty.empty());
+
+    REQUIRE(InternedString("a") < std::string_view("b"));
+    REQUIRE(editorId == fromString);
+    REQUIRE(InternedString("a") < InternedString("b"));
+}
+
+TEST_CASE("EntryMetadata comments are sliced into pooled fields", "[persistence]") {
+    EntryMetadata first, second;
+    REQUIRE(EntryMetadata::ParseFromComment("; WRTable01 | Table |Furniture\\Table01.nif|STAT", first));
+    REQUIRE(first.editorId == "WRTable01");
+    REQUIRE(first.displayName == "Table");
+    REQUIRE(first.meshName == "Furniture\\Table01.nif");
+    REQUIRE(first.formTypeName == "STAT");
+
+    // The same mesh on another line shares the pooled copy
+    REQUIRE(EntryMetadata::ParseFromComment(";WRTable02||Furniture\\Table01.nif", second));
+    REQUIRE(second.editorId == "WRTable02");
+    REQUIRE(second.displayName.empty());
+    REQUIRE(second.meshName.data() == first.meshName.data());
+    REQUIRE(second.formTypeName.empty());
+
+    // Fields past the fourth are ignored
+    EntryMetadata extra;
+    REQUIRE(EntryMetadata::ParseFromComment("; a|b|c|LIGH|ignored", extra));
+    REQUIRE(extra.formTypeName == "LIGH");
+
+    REQUIRE(EntryMetadata::ParseFromComment(first.ToCommentLine(), second));
+    REQUIRE(second.editorId == first.editorId);
+    REQUIRE(second.formTypeName == first.formTypeName);
+
+    EntryMetadata rejected;
+    REQUIRE_FALSE(EntryMetadata::ParseFromComment("; only|two", rejected));
+    REQUIRE_FALSE(EntryMetadata::ParseFromComment("WRTable01|Table|mesh.nif", rejected));
+}
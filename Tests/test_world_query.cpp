@@ -0,0 +1,491 @@
+#include <catch2/catch_all.hpp>
+#include "SimulatedWorld.h"
+#include "actions/ActionHistoryRepository.h"
+#include "grab/GrabTransformMath.h"
+#include "util/WorldQuery.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace Util::WorldQuery;
+using Catch::Approx;
+
+// =============================================================================
+// WorldQuery - sphere selection and touching-object scans on a simulated world
+// =============================================================================
+
+namespace {
+    auto AcceptAll = [](RE::TESObjectREFR*) { return true; };
+
+    RE::PlayerCharacter* PlacePlayer(const RE::NiPoint3& position)
+    {
+        auto* player = RE::PlayerCharacter::GetSingleton();
+        player->SetPosition(position);
+        return player;
+    }
+
+    float DistanceSquared(const RE::NiPoint3& a, const RE::NiPoint3& b)
+    {
+        const RE::NiPoint3 d = a - b;
+        return d.x * d.x + d.y * d.y + d.z * d.z;
+    }
+
+    // Table (static, no physics) with plates on it and a cup further away
+    struct TableScene {
+        SimulatedWorld world;
+        RE::TESObjectREFR* table;
+        RE::TESObjectREFR* plateA;
+        RE::TESObjectREFR* plateB;
+        RE::TESObjectREFR* sword;
+        RE::TESObjectREFR* farCup;
+        RE::TESObjectREFR* staticPillar;
+
+        TableScene()
+        {
+            table = world.AddReference({ RE::FormType::Furniture, RE::COL_LAYER::kProps, { 0, 0, 40 }, 50.0f, true });
+            plateA = world.AddReference({ RE::FormType::Misc, RE::COL_LAYER::kClutter, { 20, 0, 80 }, 8.0f, true });
+            plateB = world.AddReference({ RE::FormType::Misc, RE::COL_LAYER::kClutter, { -20, 10, 80 }, 8.0f, true });
+            sword = world.AddReference({ RE::FormType::Weapon, RE::COL_LAYER::kWeapon, { 0, -25, 78 }, 30.0f, true });
+            farCup = world.AddReference({ RE::FormType::Misc, RE::COL_LAYER::kClutter, { 300, 0, 0 }, 6.0f, true });
+            staticPillar = world.AddReference({ RE::FormType::Static, RE::COL_LAYER::kStatic, { 0, 40, 40 }, 40.0f, false });
+        }
+
+        std::vector<RE::TESObjectREFR*> FindTouching(std::vector<RE::TESObjectREFR*> selection,
+                                                     const TouchingParams& params = TouchingParams{})
+        {
+            std::vector<WorldAABB> aabbs;
+            std::unordered_set<RE::FormID> excluded;
+            RE::NiPoint3 center;
+            for (auto* ref : selection) {
+                WorldAABB aabb;
+                REQUIRE(GetWorldAABB(ref, aabb));
+                aabb.Expand(5.0f);
+                aabbs.push_back(aabb);
+                excluded.insert(ref->GetFormID());
+                center = center + aabb.Center() * (1.0f / selection.size());
+            }
+
+            std::vector<RE::TESObjectREFR*> found;
+            CollectTouching(world.GetCell(), center, aabbs, excluded, params, found);
+            return found;
+        }
+    };
+
+    bool Contains(const std::vector<RE::TESObjectREFR*>& refs, RE::TESObjectREFR* ref)
+    {
+        return std::find(refs.begin(), refs.end(), ref) != refs.end();
+    }
+
+    // What RemoteGrabController records per object on entering remote mode
+    struct GrabbedObject {
+        RE::TESObjectREFR* ref;
+        RE::NiTransform initialTransform;
+        RE::NiPoint3 initialEulerAngles;
+        RE::NiPoint3 offsetFromCenter;
+    };
+
+    // Gives every reference a yaw, then grabs them all around their centroid
+    std::vector<GrabbedObject> GrabAll(const std::vector<RE::TESObjectREFR*>& refs, RE::NiPoint3& outCenter)
+    {
+        outCenter = {};
+        for (auto* ref : refs) {
+            outCenter = outCenter + ref->GetPosition() * (1.0f / refs.size());
+        }
+
+        std::vector<GrabbedObject> grabbed;
+        grabbed.reserve(refs.size());
+        for (size_t i = 0; i < refs.size(); ++i) {
+            auto* ref = refs[i];
+            ref->SetAngle({ 0.0f, 0.0f, static_cast<float>(i % 628) * 0.01f });
+            ref->Get3D()->world.rotate = Util::RotationMath::EulerToMatrix(ref->GetAngle());
+            grabbed.push_back({ ref, ref->Get3D()->world, ref->GetAngle(), ref->GetPosition() - outCenter });
+        }
+        return grabbed;
+    }
+
+    // One frame of a floating remote grab, as RemoteGrabTransformCalculator::Calculate
+    void MoveGroup(const std::vector<GrabbedObject>& grabbed, const RE::NiPoint3& center, float angle,
+                   bool rotationGrid, std::vector<Grab::ComputedObjectTransform>& out)
+    {
+        out.clear();
+        for (const auto& obj : grabbed) {
+            const RE::NiPoint3 floatingPos = Grab::GrabTransformMath::FloatingPosition(obj.offsetFromCenter, center, angle);
+            out.push_back(Grab::GrabTransformMath::Floating(obj.initialTransform, obj.initialEulerAngles, floatingPos,
+                                                            angle, rotationGrid, 15.0f));
+        }
+    }
+
+    // The action RemoteGrabController records on release
+    std::vector<Actions::SingleTransform> ToSingleTransforms(const std::vector<GrabbedObject>& grabbed,
+                                                             const std::vector<Grab::ComputedObjectTransform>& moved)
+    {
+        std::vector<Actions::SingleTransform> transforms(grabbed.size());
+        for (size_t i = 0; i < grabbed.size(); ++i) {
+            auto& st = transforms[i];
+            st.formId = grabbed[i].ref->GetFormID();
+            st.initialTransform = grabbed[i].initialTransform;
+            st.initialEulerAngles = grabbed[i].initialEulerAngles;
+            st.changedTransform = moved[i].transform;
+            st.changedEulerAngles = moved[i].eulerAngles;
+        }
+        return transforms;
+    }
+
+    // UndoRedoController::ApplyTransformWithEuler, on the simulated references
+    void Apply(SimulatedWorld& world, const Actions::MultiTransformAction& action, bool changed)
+    {
+        std::unordered_map<RE::FormID, RE::TESObjectREFR*> byId;
+        for (auto* ref : world.GetReferences()) {
+            byId[ref->GetFormID()] = ref;
+        }
+        for (const auto& st : action.transforms) {
+            auto* ref = byId.at(st.formId);
+            ref->SetPosition(changed ? st.changedTransform.translate : st.initialTransform.translate);
+            ref->SetAngle(changed ? st.changedEulerAngles : st.initialEulerAngles);
+        }
+    }
+
+    bool MatricesMatch(const RE::NiMatrix3& a, const RE::NiMatrix3& b, float epsilon = 1e-4f)
+    {
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                if (std::abs(a.entry[r][c] - b.entry[r][c]) > epsilon) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+TEST_CASE("WorldQuery bounds prefer the rigid body over the bound sphere", "[world]") {
+    SimulatedWorld world;
+    auto* physics = world.AddReference({ RE::FormType::Misc, RE::COL_LAYER::kClutter, { 100, 0, 0 }, 10.0f, true });
+    auto* boundOnly = world.AddReference({ RE::FormType::Static, RE::COL_LAYER::kStatic, { 0, 100, 0 }, 10.0f, false });
+
+    WorldAABB aabb;
+    REQUIRE(GetWorldAABB(physics, aabb));
+    REQUIRE(aabb.min.x == Approx(93.0f).margin(0.01f));  // 0.7 * radius box, through Havok scale
+    REQUIRE(aabb.max.x == Approx(107.0f).margin(0.01f));
+
+    REQUIRE(GetWorldAABB(boundOnly, aabb));
+    REQUIRE(aabb.min.y == Approx(90.0f));
+    REQUIRE(aabb.max.y == Approx(110.0f));
+
+    SECTION("moving a reference moves its bounds") {
+        boundOnly->SetPosition({ 0, 200, 0 });
+        REQUIRE(GetWorldAABB(boundOnly, aabb));
+        REQUIRE(aabb.Center().y == Approx(200.0f));
+    }
+}
+
+TEST_CASE("WorldQuery sphere scan matches a brute-force search", "[world]") {
+    SimulatedWorld world({ .referenceCount = 2000, .halfExtent = 1000.0f });
+    auto* player = PlacePlayer({ 0, 0, 0 });
+
+    // Sphere away from the player - the search radius has to grow to reach it
+    const RE::NiPoint3 center(600, -300, 100);
+    const float radius = 250.0f;
+
+    std::vector<RE::TESObjectREFR*> found;
+    CollectInSphere(RE::TES::GetSingleton(), player, center, radius, AcceptAll, found);
+
+    std::vector<RE::TESObjectREFR*> expected;
+    for (auto* ref : world.GetReferences()) {
+        if (IsSphereSelectable(ref) && DistanceSquared(ref->GetPosition(), center) <= radius * radius) {
+            expected.push_back(ref);
+        }
+    }
+
+    REQUIRE_FALSE(expected.empty());
+    std::sort(found.begin(), found.end());
+    std::sort(expected.begin(), expected.end());
+    REQUIRE(found == expected);
+}
+
+TEST_CASE("WorldQuery sphere scan skips unselectable references", "[world]") {
+    SimulatedWorld world;
+    auto* player = PlacePlayer({ 0, 0, 0 });  // Itself in range - an Actor, never selected
+    world.GetCell()->references.push_back(player);
+
+    auto* chair = world.AddReference({ RE::FormType::Furniture, RE::COL_LAYER::kStatic, { 10, 0, 0 }, 20.0f, false });
+    auto* disabled = world.AddReference({ RE::FormType::Misc, RE::COL_LAYER::kClutter, { 0, 10, 0 }, 5.0f, true });
+    auto* deleted = world.AddReference({ RE::FormType::Misc, RE::COL_LAYER::kClutter, { 0, -10, 0 }, 5.0f, true });
+    auto* unloaded = world.AddReference({ RE::FormType::Misc, RE::COL_LAYER::kClutter, { -10, 0, 0 }, 5.0f, true });
+    world.AddReference({ RE::FormType::NPC, RE::COL_LAYER::kBiped, { 5, 5, 0 }, 30.0f, false });
+    disabled->disabled = true;
+    deleted->deleted = true;
+    unloaded->Set3D(nullptr);
+
+    std::vector<RE::TESObjectREFR*> found;
+    CollectInSphere(RE::TES::GetSingleton(), player, { 0, 0, 0 }, 50.0f, AcceptAll, found);
+    REQUIRE(found == std::vector<RE::TESObjectREFR*>{ chair });
+
+    SECTION("caller filter applies") {
+        found.clear();
+        CollectInSphere(RE::TES::GetSingleton(), player, { 0, 0, 0 }, 50.0f,
+            [&](RE::TESObjectREFR* ref) { return ref != chair; }, found);
+        REQUIRE(found.empty());
+    }
+}
+
+TEST_CASE("WorldQuery finds loose objects resting on a selection", "[world]") {
+    TableScene scene;
+
+    auto found = scene.FindTouching({ scene.table });
+    REQUIRE(found.size() == 3);
+    REQUIRE(Contains(found, scene.plateA));
+    REQUIRE(Contains(found, scene.plateB));
+    REQUIRE(Contains(found, scene.sword));
+    REQUIRE_FALSE(Contains(found, scene.farCup));
+    REQUIRE_FALSE(Contains(found, scene.staticPillar));  // No physics
+
+    SECTION("selected objects are not reported") {
+        found = scene.FindTouching({ scene.table, scene.plateA });
+        REQUIRE_FALSE(Contains(found, scene.plateA));
+        REQUIRE(Contains(found, scene.plateB));
+    }
+
+    SECTION("result count is capped") {
+        TouchingParams params;
+        params.maxResults = 1;
+        REQUIRE(scene.FindTouching({ scene.table }, params).size() == 1);
+    }
+
+    SECTION("props only when requested") {
+        TouchingParams params;
+        params.includeProps = false;
+        found = scene.FindTouching({ scene.plateA }, params);
+        REQUIRE_FALSE(Contains(found, scene.table));
+
+        params.includeProps = true;
+        found = scene.FindTouching({ scene.plateA }, params);
+        REQUIRE(Contains(found, scene.table));
+    }
+}
+
+TEST_CASE("SimulatedWorld pick returns the nearest bound hit", "[world]") {
+    SimulatedWorld world;
+    auto* nearBox = world.AddReference({ RE::FormType::Static, RE::COL_LAYER::kStatic, { 100, 0, 0 }, 10.0f, false });
+    world.AddReference({ RE::FormType::Static, RE::COL_LAYER::kStatic, { 300, 0, 0 }, 50.0f, false });
+    world.AddReference({ RE::FormType::Static, RE::COL_LAYER::kStatic, { 100, 100, 0 }, 10.0f, false });
+
+    auto hit = world.Pick({ 0, 0, 0 }, { 1, 0, 0 }, 1000.0f);
+    REQUIRE(hit.has_value());
+    REQUIRE(hit->ref == nearBox);
+    REQUIRE(hit->distance == Approx(90.0f));
+    REQUIRE(hit->hitPoint.x == Approx(90.0f));
+
+    REQUIRE_FALSE(world.Pick({ 0, 0, 0 }, { 1, 0, 0 }, 50.0f).has_value());
+    REQUIRE_FALSE(world.Pick({ 0, 0, 0 }, { 0, -1, 0 }, 1000.0f).has_value());
+}
+
+TEST_CASE("Grab math moves a 10k-reference group rigidly", "[world][transform]") {
+    SimulatedWorld world({ .referenceCount = 10000 });
+    RE::NiPoint3 center;
+    const auto grabbed = GrabAll(world.GetReferences(), center);
+
+    const RE::NiPoint3 newCenter = center + RE::NiPoint3{ 120.0f, -40.0f, 25.0f };
+    const float angle = 0.7f;
+    std::vector<Grab::ComputedObjectTransform> moved;
+    MoveGroup(grabbed, newCenter, angle, false, moved);
+    REQUIRE(moved.size() == grabbed.size());
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < grabbed.size(); ++i) {
+        const auto& obj = grabbed[i];
+        const auto& result = moved[i];
+
+        // Orbits the center at its old distance, height offset kept
+        const RE::NiPoint3 offset = result.transform.translate - newCenter;
+        const float oldRadius = std::hypot(obj.offsetFromCenter.x, obj.offsetFromCenter.y);
+        const bool orbitOk = std::abs(std::hypot(offset.x, offset.y) - oldRadius) < 0.05f &&
+                             std::abs(offset.z - obj.offsetFromCenter.z) < 1e-3f;
+
+        // Turned by the same angle, and the matrix agrees with the Euler angles written to the game
+        const bool yawOk = std::abs(result.eulerAngles.z - (obj.initialEulerAngles.z - angle)) < 1e-5f;
+        const bool matrixOk = MatricesMatch(result.transform.rotate, Util::RotationMath::EulerToMatrix(result.eulerAngles));
+
+        if (!orbitOk || !yawOk || !matrixOk || result.groundSnapped) {
+            mismatches++;
+        }
+    }
+    REQUIRE(mismatches == 0);
+
+    // Relative layout survives: neighbours stay the same distance apart
+    for (size_t i = 1; i < grabbed.size(); i += 97) {
+        const RE::NiPoint3 before = grabbed[i].initialTransform.translate - grabbed[i - 1].initialTransform.translate;
+        const RE::NiPoint3 after = moved[i].transform.translate - moved[i - 1].transform.translate;
+        REQUIRE(after.Length() == Approx(before.Length()).epsilon(1e-4));
+    }
+
+    SECTION("rotation grid snaps every final yaw to 15 degrees") {
+        MoveGroup(grabbed, newCenter, angle, true, moved);
+        const float grid = 15.0f * (3.14159265f / 180.0f);
+        for (const auto& result : moved) {
+            const float steps = result.eulerAngles.z / grid;
+            REQUIRE(steps == Approx(std::round(steps)).margin(1e-3));
+        }
+    }
+}
+
+TEST_CASE("Grab math snaps to the surface a ray hits", "[world][transform]") {
+    // A hill: the top of a large bound sphere, with objects carried above it
+    SimulatedWorld world;
+    world.AddReference({ RE::FormType::Static, RE::COL_LAYER::kGround, { 0, 0, -900 }, 1000.0f, false });
+
+    RE::NiTransform initial;
+    initial.rotate = Util::RotationMath::EulerToMatrix({ 0, 0, 1.0f });
+    const RE::NiPoint3 initialEuler{ 0, 0, 1.0f };
+
+    for (float x = -400.0f; x <= 400.0f; x += 100.0f) {
+        const RE::NiPoint3 floatingPos{ x, x * 0.5f, 300.0f };
+        auto hit = world.Pick(floatingPos, { 0, 0, -1 }, 2000.0f);
+        REQUIRE(hit.has_value());
+
+        auto result = Grab::GrabTransformMath::GroundSnapped(initial, initialEuler, hit->hitPoint, hit->hitNormal,
+                                                             0.25f, false, 15.0f);
+        REQUIRE(result.groundSnapped);
+        REQUIRE(result.transform.translate.z == Approx(hit->hitPoint.z));
+        REQUIRE(result.eulerAngles.z == Approx(0.75f));
+
+        // Local Z axis (third column) points along the surface normal
+        REQUIRE(result.transform.rotate.entry[0][2] == Approx(hit->hitNormal.x).margin(1e-4));
+        REQUIRE(result.transform.rotate.entry[1][2] == Approx(hit->hitNormal.y).margin(1e-4));
+        REQUIRE(result.transform.rotate.entry[2][2] == Approx(hit->hitNormal.z).margin(1e-4));
+    }
+}
+
+TEST_CASE("Undo and redo of a 10k-reference grab restore the world", "[world][transform]") {
+    SimulatedWorld world({ .referenceCount = 10000 });
+    RE::NiPoint3 center;
+    const auto grabbed = GrabAll(world.GetReferences(), center);
+
+    std::vector<Grab::ComputedObjectTransform> moved;
+    MoveGroup(grabbed, center + RE::NiPoint3{ 0.0f, 300.0f, 0.0f }, -1.2f, false, moved);
+
+    auto* history = Actions::ActionHistoryRepository::GetSingleton();
+    history->Clear();
+    history->AddMultiTransform(ToSingleTransforms(grabbed, moved));
+
+    auto undone = history->Undo();
+    REQUIRE(undone.has_value());
+    REQUIRE(std::holds_alternative<Actions::MultiTransformAction>(*undone));
+    const auto& action = std::get<Actions::MultiTransformAction>(*undone);
+    REQUIRE(action.transforms.size() == grabbed.size());
+    REQUIRE(history->CanRedo());
+
+    Apply(world, action, false);
+    for (const auto& obj : grabbed) {
+        REQUIRE(obj.ref->GetPosition().x == obj.initialTransform.translate.x);
+        REQUIRE(obj.ref->GetPosition().y == obj.initialTransform.translate.y);
+        REQUIRE(obj.ref->GetAngle().z == obj.initialEulerAngles.z);
+    }
+
+    auto redone = history->Redo();
+    REQUIRE(redone.has_value());
+    Apply(world, std::get<Actions::MultiTransformAction>(*redone), true);
+    for (size_t i = 0; i < grabbed.size(); ++i) {
+        REQUIRE(grabbed[i].ref->GetPosition().y == moved[i].transform.translate.y);
+        REQUIRE(grabbed[i].ref->GetAngle().z == moved[i].eulerAngles.z);
+    }
+    REQUIRE_FALSE(history->CanRedo());
+
+    history->Clear();
+}
+
+TEST_CASE("WorldQuery benchmarks at 10k references", "[.benchmark]") {
+    SimulatedWorld world({ .referenceCount = 10000 });
+    auto* player = PlacePlayer({ 0, 0, 100 });
+    auto* tes = RE::TES::GetSingleton();
+    std::vector<RE::TESObjectREFR*> found;
+    found.reserve(1024);
+
+    BENCHMARK("sphere scan r=100 near player") {
+        found.clear();
+        CollectInSphere(tes, player, { 200, 0, 100 }, 100.0f, AcceptAll, found);
+        return found.size();
+    };
+
+    BENCHMARK("sphere scan r=1000 near player") {
+        found.clear();
+        CollectInSphere(tes, player, { 200, 0, 100 }, 1000.0f, AcceptAll, found);
+        return found.size();
+    };
+
+    // Touching search around the 50 references nearest the origin
+    std::vector<RE::TESObjectREFR*> selection = world.GetReferences();
+    std::partial_sort(selection.begin(), selection.begin() + 50, selection.end(), [](auto* a, auto* b) {
+        return DistanceSquared(a->GetPosition(), {}) < DistanceSquared(b->GetPosition(), {});
+    });
+    selection.resize(50);
+
+    std::vector<WorldAABB> aabbs;
+    std::unordered_set<RE::FormID> excluded;
+    for (auto* ref : selection) {
+        WorldAABB aabb;
+        GetWorldAABB(ref, aabb);
+        aabb.Expand(5.0f);
+        aabbs.push_back(aabb);
+        excluded.insert(ref->GetFormID());
+    }
+
+    TouchingParams params;
+    params.maxResults = 10000;
+    BENCHMARK("touching search, 50 selected") {
+        found.clear();
+        CollectTouching(world.GetCell(), {}, aabbs, excluded, params, found);
+        return found.size();
+    };
+
+    const float invSqrt2 = 1.0f / std::sqrt(2.0f);
+    BENCHMARK("pick across the cell") {
+        return world.Pick({ -4096, -4096, 100 }, { invSqrt2, invSqrt2, 0 }, 20000.0f).has_value();
+    };
+
+    // A remote grab of every reference: one frame of transforms, and its undo history
+    RE::NiPoint3 center;
+    const auto grabbed = GrabAll(world.GetReferences(), center);
+    std::vector<Grab::ComputedObjectTransform> moved;
+    moved.reserve(grabbed.size());
+
+    BENCHMARK("grab transforms, 10k objects") {
+        MoveGroup(grabbed, center + RE::NiPoint3{ 50.0f, 0.0f, 0.0f }, 0.3f, true, moved);
+        return moved.size();
+    };
+
+    const RE::NiPoint3 up{ 0.0f, 0.0f, 1.0f };
+    BENCHMARK("grab ground-snap transforms, 10k objects") {
+        moved.clear();
+        for (const auto& obj : grabbed) {
+            moved.push_back(Grab::GrabTransformMath::GroundSnapped(obj.initialTransform, obj.initialEulerAngles,
+                                                                   obj.initialTransform.translate, up, 0.3f, false, 15.0f));
+        }
+        return moved.size();
+    };
+
+    MoveGroup(grabbed, center + RE::NiPoint3{ 50.0f, 0.0f, 0.0f }, 0.3f, false, moved);
+    const auto transforms = ToSingleTransforms(grabbed, moved);
+    auto* history = Actions::ActionHistoryRepository::GetSingleton();
+
+    BENCHMARK("record 10k-object grab") {
+        history->Clear();
+        auto copy = transforms;
+        history->AddMultiTransform(std::move(copy));
+        return history->Count();
+    };
+
+    history->Clear();
+    history->AddMultiTransform(std::vector<Actions::SingleTransform>(transforms));
+    BENCHMARK("undo+redo+apply 10k-object grab") {
+        auto undone = history->Undo();
+        Apply(world, std::get<Actions::MultiTransformAction>(*undone), false);
+        auto redone = history->Redo();
+        Apply(world, std::get<Actions::MultiTransformAction>(*redone), true);
+        return history->Count();
+    };
+    history->Clear();
+}
@@ -0,0 +1,155 @@
+#include "persistence/CellBinaryConverter.h"
+#include "util/MappedFile.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// =============================================================================
+// VREditorCellConvert - converts cell files between INI and .vrcb
+// =============================================================================
+// Usage:
+//   VREditorCellConvert [-v] <file|folder>... [-o <output>]
+//   VREditorCellConvert --info <file.vrcb>...
+//
+// *_AddedObjects.ini and *_SWAP.ini files become .vrcb files next to them;
+// .vrcb files become INI files (<name>.ini). A folder converts every cell INI in
+// it. -o names the output of a single input file. Existing outputs are replaced.
+// -v shows the plugin's log output (warnings and errors only by default).
+//
+// Built against TestStubs.h like the tests and benchmarks - no game required.
+
+namespace fs = std::filesystem;
+using namespace Persistence;
+
+namespace {
+    int Usage()
+    {
+        std::fputs("usage: VREditorCellConvert [-v] <file|folder>... [-o <output>]\n"
+                   "       VREditorCellConvert --info <file.vrcb>...\n",
+                   stderr);
+        return 2;
+    }
+
+    bool IsBinary(const fs::path& path)
+    {
+        return path.extension() == CellBinary::kFileExtension;
+    }
+
+    bool Convert(const fs::path& input, fs::path output)
+    {
+        std::string error;
+        bool converted = false;
+        if (IsBinary(input)) {
+            if (output.empty()) {
+                output = fs::path(input).replace_extension(".ini");
+            }
+            converted = CellBinary::ConvertBinaryToIni(input, output, &error);
+        } else {
+            if (output.empty()) {
+                output = CellBinary::GetBinaryPath(input);
+            }
+            converted = CellBinary::ConvertIniToBinary(input, output, &error);
+        }
+
+        if (!converted) {
+            std::fprintf(stderr, "%s: %s\n", input.string().c_str(), error.c_str());
+            return false;
+        }
+
+        // The AddedObjects INI writer writes nothing for a cell without entries
+        std::error_code ec;
+        if (!fs::exists(output, ec)) {
+            std::printf("%s: no entries, nothing written\n", input.string().c_str());
+            return true;
+        }
+        std::printf("%s -> %s (%ju -> %ju bytes)\n", input.string().c_str(), output.string().c_str(),
+                    static_cast<uintmax_t>(fs::file_size(input, ec)), static_cast<uintmax_t>(fs::file_size(output, ec)));
+        return true;
+    }
+
+    bool PrintInfo(const fs::path& input)
+    {
+        Util::MappedFile file;
+        if (!file.Open(input)) {
+            std::fprintf(stderr, "%s: cannot open file\n", input.string().c_str());
+            return false;
+        }
+
+        std::string error;
+        auto view = CellBinary::View::Open(file.GetBytes(), &error);
+        if (!view) {
+            std::fprintf(stderr, "%s: %s\n", input.string().c_str(), error.c_str());
+            return false;
+        }
+
+        const bool addedObjects = view->GetKind() == CellBinary::FileKind::AddedObjects;
+        std::printf("%s\n  kind: %s\n  cell: %.*s (%.*s)\n  rows: %zu\n  size: %zu bytes\n",
+                    input.string().c_str(), addedObjects ? "AddedObjects" : "Transforms",
+                    static_cast<int>(view->GetCellEditorId().size()), view->GetCellEditorId().data(),
+                    static_cast<int>(view->GetCellFormKey().size()), view->GetCellFormKey().data(),
+                    view->GetRowCount(), file.GetBytes().size());
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<fs::path> inputs;
+    fs::path output;
+    bool info = false;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--info") {
+            info = true;
+        } else if (arg == "-v") {
+            verbose = true;
+        } else if (arg == "-o") {
+            if (++i == argc) {
+                return Usage();
+            }
+            output = argv[i];
+        } else if (arg.starts_with('-')) {
+            return Usage();
+        } else {
+            inputs.emplace_back(arg);
+        }
+    }
+
+    if (inputs.empty() || (!output.empty() && (inputs.size() != 1 || fs::is_directory(inputs[0])))) {
+        return Usage();
+    }
+
+    if (!verbose) {
+        spdlog::set_level(spdlog::level::warn);
+    }
+
+    // Folders expand to the cell INI files they contain
+    std::vector<fs::path> files;
+    for (const auto& input : inputs) {
+        if (!fs::is_directory(input)) {
+            files.push_back(input);
+            continue;
+        }
+        for (const auto& entry : fs::directory_iterator(input)) {
+            if (entry.is_regular_file() && CellBinary::GetIniKind(entry.path())) {
+                files.push_back(entry.path());
+            }
+        }
+    }
+
+    size_t failed = 0;
+    for (const auto& file : files) {
+        const bool ok = info ? PrintInfo(file) : Convert(file, output);
+        if (!ok) {
+            failed++;
+        }
+    }
+
+    return failed == 0 ? 0 : 1;
+}
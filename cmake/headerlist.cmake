@@ -1,6 +1,7 @@
 set(headers ${headers}
 	include/InGamePatcherAPI.h
 	src/api/VREditorPapyrusAPI.h
+	src/api/SelectionEventQueue.h
 	src/PCH.h
     src/log.h
     src/HealthCheck.h
@@ -9,17 +10,27 @@ set(headers ${headers}
     src/EditModeManager.h
     src/EditModeInputManager.h
     src/EditModeTransitioner.h
+    src/EditModeWarmup.h
     src/EditModeStateManager.h
     src/TutorialManager.h
+    src/util/FrameArena.h
     src/util/InputManager.h
+    src/util/InputRecorder.h
+    src/util/InputTrace.h
+    src/util/JobSystem.h
     src/util/MessageBoxUtil.h
     src/util/MenuChecker.h
+    src/util/MappedFile.h
     src/util/NotificationManager.h
     src/util/PositioningUtil.h
     src/util/Raycast.h
+    src/util/SimdMath.h
+    src/util/Profiler.h
+    src/util/AllocationCounter.h
     src/util/SelectionLogger.h
     src/util/ActionLogger.h
     src/util/TouchingObjectsFinder.h
+    src/util/WorldQuery.h
     src/util/VRNodes.h
     src/util/UUID.h
     src/visuals/RaycastRenderer.h
@@ -30,6 +41,8 @@ set(headers ${headers}
     src/actions/DeleteHandler.h
     src/actions/SnapToGroundHandler.h
     src/actions/CopyHandler.h
+    src/actions/ArrayLayout.h
+    src/actions/ArrayDuplicateHandler.h
     src/selection/SelectionState.h
     src/selection/HoverStateManager.h
     src/selection/SphereHoverStateManager.h
@@ -40,8 +53,10 @@ set(headers ${headers}
     src/ui/SelectionMenuHelpers.h
     src/ui/MenuStateManager.h
     src/ui/MenuViewportManager.h
+    src/ui/MenuElementPool.h
     src/grab/TransformSmoother.h
     src/grab/RemoteGrabController.h
+    src/grab/GrabTransformMath.h
     src/grab/RemoteSelectionController.h
     src/grab/RemoteNPCPlacementManager.h
     src/grab/DeferredCollisionUpdateManager.h
@@ -49,14 +64,22 @@ set(headers ${headers}
     src/interfaces/ThreeDUIInterface001.h
     src/persistence/FormKeyUtil.h
     src/persistence/EntryMetadata.h
+    src/persistence/IniLineFormat.h
     src/persistence/ChangedObjectRegistry.h
+    src/persistence/ExportBuilder.h
     src/persistence/SaveGameDataManager.h
+    src/persistence/StringPool.h
     src/persistence/BaseObjectSwapperParser.h
     src/persistence/BaseObjectSwapperExporter.h
     src/persistence/AddedObjectsParser.h
     src/persistence/AddedObjectsSpawner.h
+    src/persistence/BaseFormMetadataCache.h
     src/persistence/AddedObjectsExporter.h
     src/persistence/CreatedObjectTracker.h
+    src/persistence/CellResetJob.h
+    src/persistence/CellExportWriter.h
+    src/persistence/CellBinaryFormat.h
+    src/persistence/CellBinaryConverter.h
     src/gallery/GalleryItem.h
     src/gallery/GalleryManager.h
     src/gallery/GalleryPlacementUtil.h
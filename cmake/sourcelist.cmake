@@ -4,19 +4,26 @@ set(sources ${sources}
     src/api/InGamePatcherAPI.cpp
     src/api/VREditorPapyrusAPI.cpp
     src/api/VRBuilderNativePapyrusAPI.cpp
+    src/api/SelectionEventQueue.cpp
     src/FrameCallbackDispatcher.cpp
     src/ui/MenuStateManager.cpp
     src/EditModeManager.cpp
     src/EditModeInputManager.cpp
     src/EditModeTransitioner.cpp
+    src/EditModeWarmup.cpp
     src/EditModeStateManager.cpp
     src/TutorialManager.cpp
     src/util/InputManager.cpp
+    src/util/InputRecorder.cpp
     src/util/MessageBoxUtil.cpp
     src/util/MenuChecker.cpp
+    src/util/JobSystem.cpp
+    src/util/MappedFile.cpp
     src/util/NotificationManager.cpp
     src/util/PositioningUtil.cpp
     src/util/Raycast.cpp
+    src/util/AllocationCounter.cpp
+    src/util/Profiler.cpp
     src/util/SelectionLogger.cpp
     src/util/ActionLogger.cpp
     src/util/TouchingObjectsFinder.cpp
@@ -26,6 +33,8 @@ set(sources ${sources}
     src/visuals/ObjectHighlighter.cpp
     src/actions/ActionHistoryRepository.cpp
     src/actions/UndoRedoController.cpp
+    src/actions/CopyHandler.cpp
+    src/actions/ArrayDuplicateHandler.cpp
     src/selection/SelectionState.cpp
     src/selection/HoverStateManager.cpp
     src/selection/SphereHoverStateManager.cpp
@@ -49,13 +58,20 @@ set(sources ${sources}
     src/persistence/FormKeyUtil.cpp
     src/persistence/EntryMetadata.cpp
     src/persistence/ChangedObjectRegistry.cpp
+    src/persistence/ExportBuilder.cpp
     src/persistence/SaveGameDataManager.cpp
+    src/persistence/StringPool.cpp
     src/persistence/BaseObjectSwapperParser.cpp
     src/persistence/BaseObjectSwapperExporter.cpp
     src/persistence/AddedObjectsParser.cpp
     src/persistence/AddedObjectsSpawner.cpp
+    src/persistence/BaseFormMetadataCache.cpp
     src/persistence/AddedObjectsExporter.cpp
     src/persistence/CreatedObjectTracker.cpp
+    src/persistence/CellResetJob.cpp
+    src/persistence/CellExportWriter.cpp
+    src/persistence/CellBinaryFormat.cpp
+    src/persistence/CellBinaryConverter.cpp
     src/gallery/GalleryManager.cpp
     src/gallery/GalleryPlacementUtil.cpp
     src/config/ConfigStorage.cpp
@@ -52,7 +52,9 @@
 // =============================================================================
 
 // Current API version - increment when adding new functions
-constexpr uint32_t IGP_API_VERSION = 1;
+// v2: IGP_CopySelection, IGP_GetSelectionGeneration
+// v3: Selection event queue, batch and per-object selection change callbacks
+constexpr uint32_t IGP_API_VERSION = 3;
 
 // =============================================================================
 // Types
@@ -75,6 +77,32 @@ typedef void (*IGP_EditModeCallback)(bool isEntering);
 // isSelected: true if object was selected, false if deselected
 typedef void (*IGP_SelectionCallback)(uint32_t formID, bool isSelected);
 
+// All selection changes of one frame, merged into net added/removed sets (API v3+)
+// Arrays are sorted by FormID. An object added and removed within the same frame
+// appears in neither array.
+// Pointer lifetime: added/removed stay valid until the next frame update - copy
+// them if you need to keep them longer.
+struct IGP_SelectionChangeEvent {
+    uint32_t structSize;            // sizeof(IGP_SelectionChangeEvent)
+    uint32_t sequence;              // Event sequence number (1-based, increments per event)
+    uint32_t generation;            // IGP_GetSelectionGeneration() value after this event
+    const uint32_t* added;          // FormIDs that became selected
+    uint32_t addedCount;
+    const uint32_t* removed;        // FormIDs that became deselected
+    uint32_t removedCount;
+    bool cleared;                   // True if the selection ended this frame empty
+};
+
+// Result of IGP_ReadSelectionEvent
+enum IGP_EventReadResult : uint32_t {
+    IGP_EventRead_OK = 0,           // outEvent filled, cursor advanced
+    IGP_EventRead_Empty = 1,        // No new events since cursor
+    IGP_EventRead_Overflow = 2,     // Events were dropped - resync with IGP_CopySelection, then keep reading
+};
+
+// Callback receiving one coalesced event per frame in which the selection changed (API v3+)
+typedef void (*IGP_SelectionBatchCallback)(const IGP_SelectionChangeEvent* event);
+
 // =============================================================================
 // Function Pointer Types (for GetProcAddress usage)
 // =============================================================================
@@ -93,6 +121,10 @@ typedef uint32_t (*IGP_GetSelectionCountFn)();
 typedef uint32_t (*IGP_GetSelectedFormIDFn)(uint32_t index);
 typedef bool (*IGP_IsFormSelectedFn)(uint32_t formID);
 typedef uint32_t (*IGP_GetHoveredFormIDFn)();
+typedef uint32_t (*IGP_CopySelectionFn)(uint32_t* buffer, uint32_t capacity);
+typedef uint32_t (*IGP_GetSelectionGenerationFn)();
+typedef IGP_EventReadResult (*IGP_ReadSelectionEventFn)(uint32_t* cursor, IGP_SelectionChangeEvent* outEvent);
+typedef uint32_t (*IGP_GetSelectionEventCursorFn)();
 
 // Selection Control
 typedef bool (*IGP_SelectFormFn)(uint32_t formID);
@@ -104,6 +136,10 @@ typedef void (*IGP_RegisterEditModeCallbackFn)(IGP_EditModeCallback callback);
 typedef void (*IGP_UnregisterEditModeCallbackFn)(IGP_EditModeCallback callback);
 typedef void (*IGP_RegisterSelectionCallbackFn)(IGP_SelectionCallback callback);
 typedef void (*IGP_UnregisterSelectionCallbackFn)(IGP_SelectionCallback callback);
+typedef void (*IGP_RegisterSelectionBatchCallbackFn)(IGP_SelectionBatchCallback callback);
+typedef void (*IGP_UnregisterSelectionBatchCallbackFn)(IGP_SelectionBatchCallback callback);
+typedef void (*IGP_RegisterSelectionChangeCallbackFn)(IGP_SelectionCallback callback);
+typedef void (*IGP_UnregisterSelectionChangeCallbackFn)(IGP_SelectionCallback callback);
 
 // =============================================================================
 // API Function Declarations
@@ -163,6 +199,45 @@ IGP_API bool IGP_IsFormSelected(uint32_t formID);
 // Returns 0 if nothing is hovered or not in selection mode
 IGP_API uint32_t IGP_GetHoveredFormID();
 
+// Copy the FormIDs of all selected objects into buffer in one call (API v2+)
+// Writes at most `capacity` FormIDs and returns the TOTAL selection count, so a
+// return value > capacity means the buffer was too small. Pass buffer = nullptr
+// to query the count only. The copy is a consistent snapshot of one selection
+// state, unlike looping over IGP_GetSelectedFormID.
+// Returns 0 if not in edit mode or nothing selected
+IGP_API uint32_t IGP_CopySelection(uint32_t* buffer, uint32_t capacity);
+
+// Get the selection generation counter (API v2+)
+// Increments every time the selection changes. Cache the value alongside your
+// last IGP_CopySelection result and skip re-reading while it is unchanged.
+// Safe to call from any thread. Wraps around after 2^32 changes.
+IGP_API uint32_t IGP_GetSelectionGeneration();
+
+// -----------------------------------------------------------------------------
+// Selection Event Queue (API v3+)
+// -----------------------------------------------------------------------------
+// Selection changes are merged per frame and kept in a bounded ring buffer of the
+// last 64 events. Each consumer keeps its own cursor and drains at its own pace:
+//
+//   uint32_t cursor = IGP_GetSelectionEventCursor();   // start from "now"
+//   ...
+//   IGP_SelectionChangeEvent ev{};
+//   while (true) {
+//       auto r = IGP_ReadSelectionEvent(&cursor, &ev);
+//       if (r == IGP_EventRead_Empty) break;
+//       if (r == IGP_EventRead_Overflow) { /* resync via IGP_CopySelection */ continue; }
+//       // use ev.added / ev.removed
+//   }
+
+// Read the next event after *cursor. Start with cursor = 0 (or the value from
+// IGP_GetSelectionEventCursor to skip history). On Overflow the cursor is moved
+// to just before the oldest retained event and outEvent is left untouched.
+// Call from the main thread - event arrays are overwritten by later frames.
+IGP_API IGP_EventReadResult IGP_ReadSelectionEvent(uint32_t* cursor, IGP_SelectionChangeEvent* outEvent);
+
+// Sequence number of the most recent event (0 if none). Use as a starting cursor.
+IGP_API uint32_t IGP_GetSelectionEventCursor();
+
 // -----------------------------------------------------------------------------
 // Selection Control
 // -----------------------------------------------------------------------------
@@ -195,11 +270,31 @@ IGP_API void IGP_UnregisterEditModeCallback(IGP_EditModeCallback callback);
 
 // Register a callback for selection change events
 // The callback will be invoked on the main game thread
+// Only reports changes made through IGP_SelectForm, IGP_DeselectForm and
+// IGP_ClearSelection (formID 0). For every selection change, including in-game
+// ones, use IGP_RegisterSelectionChangeCallback, the batch callback or the event queue.
 IGP_API void IGP_RegisterSelectionCallback(IGP_SelectionCallback callback);
 
 // Unregister a previously registered selection callback
 IGP_API void IGP_UnregisterSelectionCallback(IGP_SelectionCallback callback);
 
+// Register a callback that receives one coalesced event per frame (API v3+)
+// Invoked on the main game thread at frame end, only in frames where the selection changed
+IGP_API void IGP_RegisterSelectionBatchCallback(IGP_SelectionBatchCallback callback);
+
+// Unregister a previously registered batch selection callback
+IGP_API void IGP_UnregisterSelectionBatchCallback(IGP_SelectionBatchCallback callback);
+
+// Register a per-object callback for every selection change, whatever caused it (API v3+)
+// Invoked on the main game thread at frame end with that frame's NET changes:
+// once per deselected object, then once per selected object. When the selection
+// ended the frame empty, the deselections are reported once as formID 0.
+// A box select of N objects means N calls - prefer the batch callback for those.
+IGP_API void IGP_RegisterSelectionChangeCallback(IGP_SelectionCallback callback);
+
+// Unregister a previously registered selection change callback
+IGP_API void IGP_UnregisterSelectionChangeCallback(IGP_SelectionCallback callback);
+
 // =============================================================================
 // Helper for Loading API at Runtime
 // =============================================================================
@@ -221,6 +316,10 @@ namespace InGamePatcherAPI {
     inline IGP_GetSelectedFormIDFn GetSelectedFormID = nullptr;
     inline IGP_IsFormSelectedFn IsFormSelected = nullptr;
     inline IGP_GetHoveredFormIDFn GetHoveredFormID = nullptr;
+    inline IGP_CopySelectionFn CopySelection = nullptr;
+    inline IGP_GetSelectionGenerationFn GetSelectionGeneration = nullptr;
+    inline IGP_ReadSelectionEventFn ReadSelectionEvent = nullptr;
+    inline IGP_GetSelectionEventCursorFn GetSelectionEventCursor = nullptr;
     inline IGP_SelectFormFn SelectForm = nullptr;
     inline IGP_DeselectFormFn DeselectForm = nullptr;
     inline IGP_ClearSelectionFn ClearSelection = nullptr;
@@ -228,6 +327,10 @@ namespace InGamePatcherAPI {
     inline IGP_UnregisterEditModeCallbackFn UnregisterEditModeCallback = nullptr;
     inline IGP_RegisterSelectionCallbackFn RegisterSelectionCallback = nullptr;
     inline IGP_UnregisterSelectionCallbackFn UnregisterSelectionCallback = nullptr;
+    inline IGP_RegisterSelectionBatchCallbackFn RegisterSelectionBatchCallback = nullptr;
+    inline IGP_UnregisterSelectionBatchCallbackFn UnregisterSelectionBatchCallback = nullptr;
+    inline IGP_RegisterSelectionChangeCallbackFn RegisterSelectionChangeCallback = nullptr;
+    inline IGP_UnregisterSelectionChangeCallbackFn UnregisterSelectionChangeCallback = nullptr;
 
     // Attempts to load the In-Game Patcher DLL and populate function pointers
     // Returns true if DLL was found and API version is compatible
@@ -254,6 +357,10 @@ namespace InGamePatcherAPI {
         GetSelectedFormID = (IGP_GetSelectedFormIDFn)GetProcAddress(hDLL, "IGP_GetSelectedFormID");
         IsFormSelected = (IGP_IsFormSelectedFn)GetProcAddress(hDLL, "IGP_IsFormSelected");
         GetHoveredFormID = (IGP_GetHoveredFormIDFn)GetProcAddress(hDLL, "IGP_GetHoveredFormID");
+        CopySelection = (IGP_CopySelectionFn)GetProcAddress(hDLL, "IGP_CopySelection");
+        GetSelectionGeneration = (IGP_GetSelectionGenerationFn)GetProcAddress(hDLL, "IGP_GetSelectionGeneration");
+        ReadSelectionEvent = (IGP_ReadSelectionEventFn)GetProcAddress(hDLL, "IGP_ReadSelectionEvent");
+        GetSelectionEventCursor = (IGP_GetSelectionEventCursorFn)GetProcAddress(hDLL, "IGP_GetSelectionEventCursor");
         SelectForm = (IGP_SelectFormFn)GetProcAddress(hDLL, "IGP_SelectForm");
         DeselectForm = (IGP_DeselectFormFn)GetProcAddress(hDLL, "IGP_DeselectForm");
         ClearSelection = (IGP_ClearSelectionFn)GetProcAddress(hDLL, "IGP_ClearSelection");
@@ -261,6 +368,10 @@ namespace InGamePatcherAPI {
         UnregisterEditModeCallback = (IGP_UnregisterEditModeCallbackFn)GetProcAddress(hDLL, "IGP_UnregisterEditModeCallback");
         RegisterSelectionCallback = (IGP_RegisterSelectionCallbackFn)GetProcAddress(hDLL, "IGP_RegisterSelectionCallback");
         UnregisterSelectionCallback = (IGP_UnregisterSelectionCallbackFn)GetProcAddress(hDLL, "IGP_UnregisterSelectionCallback");
+        RegisterSelectionBatchCallback = (IGP_RegisterSelectionBatchCallbackFn)GetProcAddress(hDLL, "IGP_RegisterSelectionBatchCallback");
+        UnregisterSelectionBatchCallback = (IGP_UnregisterSelectionBatchCallbackFn)GetProcAddress(hDLL, "IGP_UnregisterSelectionBatchCallback");
+        RegisterSelectionChangeCallback = (IGP_RegisterSelectionChangeCallbackFn)GetProcAddress(hDLL, "IGP_RegisterSelectionChangeCallback");
+        UnregisterSelectionChangeCallback = (IGP_UnregisterSelectionChangeCallbackFn)GetProcAddress(hDLL, "IGP_UnregisterSelectionChangeCallback");
 
         return true;
     }
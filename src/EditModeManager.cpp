@@ -4,7 +4,9 @@
 #include "config/ConfigOptions.h"
 #include "interfaces/higgsinterface001.h"
 #include "util/SkyrimNetInterface.h"
+#include "EditModeWarmup.h"
 #include <spdlog/spdlog.h>
+#include <chrono>
 
 EditModeManager* EditModeManager::GetSingleton()
 {
@@ -64,6 +66,8 @@ void EditModeManager::Enter()
     }
 
     spdlog::info("EditModeManager: Entering edit mode");
+    const auto enterStart = std::chrono::steady_clock::now();
+
     DisableHiggs();
     EnableSkyrimNetHotkeys();
     m_isInEditMode = true;
@@ -73,6 +77,10 @@ void EditModeManager::Enter()
 
     // Notify state manager to enter initial state (Remote Selection Mode)
     EditModeStateManager::GetSingleton()->OnEditModeEnter();
+
+    const float enterMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - enterStart).count();
+    spdlog::info("EditModeManager: Entered edit mode in {:.2f} ms (warm-up {})", enterMs,
+        EditModeWarmup::GetSingleton()->IsComplete() ? "complete" : "pending");
 }
 
 void EditModeManager::Exit()
@@ -37,6 +37,9 @@ void EditModeTransitioner::Initialize()
         spdlog::warn("EditModeTransitioner: InputManager not initialized");
     }
 
+    // Keeps the prefilter's bounds cache fresh off the trigger path (not edit-mode only)
+    FrameCallbackDispatcher::GetSingleton()->Register(this, false);
+
     m_initialized = true;
     spdlog::info("EditModeTransitioner initialized");
 }
@@ -52,6 +55,14 @@ void EditModeTransitioner::Shutdown()
         InputManager::GetSingleton()->RemoveVrButtonCallback(m_triggerCallbackId);
         m_triggerCallbackId = InputManager::InvalidCallbackId;
     }
+    FrameCallbackDispatcher::GetSingleton()->Unregister(this);
+
+    if (m_prefilterChecks > 0) {
+        spdlog::info("EditModeTransitioner: Raycast prefilter skipped {} of {} raycasts ({} run on a stale cache)",
+            m_prefilterChecks - m_prefilterPasses, m_prefilterChecks, m_prefilterStale);
+    }
+    m_nearbyBounds.clear();
+    m_hasBoundsCache = false;
 
     m_initialized = false;
     spdlog::info("EditModeTransitioner shutdown");
@@ -59,8 +70,11 @@ void EditModeTransitioner::Shutdown()
 
 void EditModeTransitioner::OnFrameUpdate(float deltaTime)
 {
-    // Currently no per-frame logic needed
-    // The detection happens on trigger press
+    // The detection happens on trigger press - here the bounds cache is kept fresh,
+    // so the press never has to fall back to the ray because the cache aged
+    if (!IsBoundsCacheFresh()) {
+        RebuildNearbyBounds();
+    }
 }
 
 bool EditModeTransitioner::IsHandInsideObject(bool isLeft)
@@ -76,6 +90,11 @@ bool EditModeTransitioner::IsHandInsideObject(bool isLeft)
     RE::NiPoint3 hmdPos = hmd->world.translate;
     RE::NiPoint3 handPos = hand->world.translate;
 
+    // Hand in open space - no reference's bound contains it, skip the Havok ray
+    if (!IsHandNearAnyBound(handPos)) {
+        return false;
+    }
+
     // Calculate direction and distance from HMD to hand
     RE::NiPoint3 hmdToHand = handPos - hmdPos;
     float distance = std::sqrt(hmdToHand.x * hmdToHand.x +
@@ -107,6 +126,122 @@ bool EditModeTransitioner::IsHandInsideObject(bool isLeft)
     return true;
 }
 
+bool EditModeTransitioner::IsHandNearAnyBound(const RE::NiPoint3& handPos)
+{
+    // Went stale this frame (OnFrameUpdate has not run yet) - rebuilding now would
+    // cost more than the ray it saves
+    if (!IsBoundsCacheFresh()) {
+        RecordPrefilterResult(true, true);
+        return true;
+    }
+
+    bool passed = false;
+    for (const auto& bound : m_nearbyBounds) {
+        const float dx = handPos.x - bound.center.x;
+        const float dy = handPos.y - bound.center.y;
+        const float dz = handPos.z - bound.center.z;
+        if (dx * dx + dy * dy + dz * dz <= bound.radiusSquared) {
+            passed = true;
+            break;
+        }
+    }
+
+    // Landscape is not a reference - a hand pushed into the ground has no bound to be in
+    if (!passed && IsHandBelowLand(handPos)) {
+        passed = true;
+    }
+
+    RecordPrefilterResult(passed);
+    return passed;
+}
+
+bool EditModeTransitioner::IsHandBelowLand(const RE::NiPoint3& handPos) const
+{
+    auto* tes = RE::TES::GetSingleton();
+    float landHeight = 0.0f;
+    // False in interiors and outside the loaded land
+    return tes && tes->GetLandHeight(handPos, landHeight) && handPos.z <= landHeight + kBoundMargin;
+}
+
+bool EditModeTransitioner::IsBoundsCacheFresh() const
+{
+    auto* player = RE::PlayerCharacter::GetSingleton();
+    if (!player || !m_hasBoundsCache) {
+        return false;
+    }
+
+    auto* cell = player->GetParentCell();
+    if ((cell ? cell->GetFormID() : 0) != m_boundsCacheCellId) {
+        return false;
+    }
+
+    const float age = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_boundsCacheTime).count();
+    const RE::NiPoint3 moved = player->GetPosition() - m_boundsCachePlayerPos;
+    const float movedSquared = moved.x * moved.x + moved.y * moved.y + moved.z * moved.z;
+    return age < kBoundsCacheLifetime && movedSquared < kBoundsCacheMoveDistance * kBoundsCacheMoveDistance;
+}
+
+void EditModeTransitioner::RebuildNearbyBounds()
+{
+    auto* player = RE::PlayerCharacter::GetSingleton();
+    auto* tes = RE::TES::GetSingleton();
+    if (!player || !tes) {
+        return;
+    }
+
+    const RE::NiPoint3 playerPos = player->GetPosition();
+    auto* cell = player->GetParentCell();
+
+    // Refs are found by origin, but kept by bound: a large ref (a house, a cliff)
+    // whose origin is far away can still reach the player
+    m_nearbyBounds.clear();
+    tes->ForEachReferenceInRange(player, kNearbyBoundsRadius + kMaxBoundRadius, [&](RE::TESObjectREFR* ref) -> RE::BSContainer::ForEachResult {
+        if (!ref || ref == player || ref->IsDisabled()) {
+            return RE::BSContainer::ForEachResult::kContinue;
+        }
+
+        auto* node3D = ref->Get3D();
+        if (!node3D || node3D->worldBound.radius <= 0.0f) {
+            return RE::BSContainer::ForEachResult::kContinue;
+        }
+
+        const float radius = node3D->worldBound.radius + kBoundMargin;
+        const RE::NiPoint3 offset = node3D->worldBound.center - playerPos;
+        const float reach = kNearbyBoundsRadius + radius;
+        if (offset.x * offset.x + offset.y * offset.y + offset.z * offset.z > reach * reach) {
+            return RE::BSContainer::ForEachResult::kContinue;
+        }
+
+        m_nearbyBounds.push_back({ node3D->worldBound.center, radius * radius });
+        return RE::BSContainer::ForEachResult::kContinue;
+    });
+
+    m_boundsCachePlayerPos = playerPos;
+    m_boundsCacheCellId = cell ? cell->GetFormID() : 0;
+    m_boundsCacheTime = std::chrono::steady_clock::now();
+    m_hasBoundsCache = true;
+
+    spdlog::trace("EditModeTransitioner: Cached {} nearby bounds", m_nearbyBounds.size());
+}
+
+void EditModeTransitioner::RecordPrefilterResult(bool passed, bool stale)
+{
+    m_prefilterChecks++;
+    if (passed) {
+        m_prefilterPasses++;
+    }
+    if (stale) {
+        m_prefilterStale++;
+    }
+
+    if (m_prefilterChecks % kPrefilterLogInterval == 0) {
+        const float skipped = 100.0f * static_cast<float>(m_prefilterChecks - m_prefilterPasses) /
+                              static_cast<float>(m_prefilterChecks);
+        spdlog::debug("EditModeTransitioner: Raycast prefilter skipped {:.1f}% of {} trigger checks ({} raycasts run, {} on a stale cache)",
+            skipped, m_prefilterChecks, m_prefilterPasses, m_prefilterStale);
+    }
+}
+
 bool EditModeTransitioner::OnTriggerPressed(bool isLeft, bool isReleased, vr::EVRButtonId buttonId)
 {
     // Only care about trigger press, not release
@@ -3,6 +3,7 @@
 #include "IFrameUpdateListener.h"
 #include "util/InputManager.h"
 #include <chrono>
+#include <vector>
 
 // Handles transitioning into/out of edit mode
 // Detection: Player shoves hand inside an object and double-taps trigger
@@ -11,6 +12,15 @@
 // 1. Cast ray from HMD to hand - if hits wall before reaching hand, suspect we're inside object
 // 2. Cast reverse ray from hand to HMD - if doesn't hit anything, confirm (backface culling)
 // 3. If both checks pass and trigger is double-tapped, toggle edit mode
+//
+// Prefilter: most gameplay trigger pulls happen in open space. Before casting the
+// Havok ray the hand is tested against the world bounding spheres of references
+// whose bounds reach near the player, and against the land height, and the ray
+// only runs when the hand is inside one of them or below the ground. The spheres
+// are cached and refreshed from OnFrameUpdate whenever the cache goes stale (old,
+// or the player moved or changed cells), so a press finds it fresh and the
+// rebuild never adds to the trigger press it would have saved. Only a press in
+// the frame the cache went stale falls back to the ray.
 class EditModeTransitioner : public IFrameUpdateListener
 {
 public:
@@ -35,6 +45,24 @@ private:
     // Returns true if hand appears to be inside geometry
     bool IsHandInsideObject(bool isLeft);
 
+    // Cheap test run before the raycast - false if the hand is outside every
+    // nearby reference's bounding sphere and above the land
+    bool IsHandNearAnyBound(const RE::NiPoint3& handPos);
+
+    // Hand at or below the landscape height (exteriors only)
+    bool IsHandBelowLand(const RE::NiPoint3& handPos) const;
+
+    // False if m_nearbyBounds is older than kBoundsCacheLifetime, or the player
+    // moved more than kBoundsCacheMoveDistance or changed cells since the build
+    bool IsBoundsCacheFresh() const;
+
+    // Collect the bounds of references that reach within kNearbyBoundsRadius of the player
+    void RebuildNearbyBounds();
+
+    // Log prefilter statistics every kPrefilterLogInterval checks
+    // stale: the ray ran because the cache was stale, not because of a bound
+    void RecordPrefilterResult(bool passed, bool stale = false);
+
     // Input callback for trigger press
     bool OnTriggerPressed(bool isLeft, bool isReleased, vr::EVRButtonId buttonId);
 
@@ -51,4 +79,37 @@ private:
 
     // Track which hand was used for last trigger (for double-tap to work)
     bool m_lastTriggerIsLeft = false;
+
+    // ===== Raycast prefilter =====
+
+    struct BoundSphere {
+        RE::NiPoint3 center;
+        float radiusSquared = 0.0f;
+    };
+
+    // References searched around the player - well beyond arm's reach so the
+    // cache survives some walking
+    static constexpr float kNearbyBoundsRadius = 600.0f;
+
+    // Largest bound radius looked for beyond kNearbyBoundsRadius - refs are
+    // searched by origin, so bigger ones centered further away are missed
+    static constexpr float kMaxBoundRadius = 2000.0f;
+    static constexpr float kBoundsCacheMoveDistance = 200.0f;
+    static constexpr float kBoundsCacheLifetime = 2.0f;  // seconds - refresh period while standing still
+
+    // Slack added to each bound radius (hand node sits at the palm, not the fingertips)
+    static constexpr float kBoundMargin = 10.0f;
+
+    static constexpr uint32_t kPrefilterLogInterval = 50;
+
+    // Spheres, not refs - nothing to dangle when references unload
+    std::vector<BoundSphere> m_nearbyBounds;
+    RE::NiPoint3 m_boundsCachePlayerPos;
+    RE::FormID m_boundsCacheCellId = 0;
+    std::chrono::steady_clock::time_point m_boundsCacheTime;
+    bool m_hasBoundsCache = false;
+
+    uint32_t m_prefilterChecks = 0;
+    uint32_t m_prefilterPasses = 0;
+    uint32_t m_prefilterStale = 0;  // Passes caused by a stale cache
 };
@@ -0,0 +1,113 @@
+#include "EditModeWarmup.h"
+#include "EditModeManager.h"
+#include "FrameCallbackDispatcher.h"
+#include "grab/SphereSelectionController.h"
+#include "ui/MenuStateManager.h"
+#include "ui/SelectionMenu.h"
+#include "ui/GalleryMenu.h"
+#include "util/MenuChecker.h"
+#include "log.h"
+#include <chrono>
+
+EditModeWarmup* EditModeWarmup::GetSingleton()
+{
+    static EditModeWarmup instance;
+    return &instance;
+}
+
+void EditModeWarmup::Start()
+{
+    if (IsComplete() || m_isRegistered) {
+        return;
+    }
+
+    m_delayFrames = kStartDelayFrames;
+
+    // Not edit-mode only - the whole point is to run before edit mode is entered
+    FrameCallbackDispatcher::GetSingleton()->Register(this, false);
+    m_isRegistered = true;
+
+    spdlog::info("EditModeWarmup: Started ({} steps)", kStepCount);
+}
+
+void EditModeWarmup::OnFrameUpdate(float deltaTime)
+{
+    if (IsComplete()) {
+        Unregister();
+        return;
+    }
+
+    if (m_delayFrames > 0) {
+        m_delayFrames--;
+        return;
+    }
+
+    // Only idle gameplay frames - never while the user is editing (menus may be
+    // open) or while a loading/game-stopping menu is up
+    if (EditModeManager::GetSingleton()->IsInEditMode() || MenuChecker::IsGameStopped() ||
+        deltaTime > kMaxIdleFrameTime) {
+        return;
+    }
+
+    const auto& step = kSteps[m_nextStep];
+    const auto start = std::chrono::steady_clock::now();
+    const bool ok = step.run();
+    const float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    m_totalMs += ms;
+    m_nextStep++;
+
+    if (ok) {
+        spdlog::info("EditModeWarmup: {} ready in {:.2f} ms", step.name, ms);
+    } else {
+        // Left to the lazy path on first use - which will log its own error
+        spdlog::warn("EditModeWarmup: {} failed after {:.2f} ms", step.name, ms);
+    }
+
+    if (IsComplete()) {
+        spdlog::info("EditModeWarmup: Complete ({:.2f} ms of work)", m_totalMs);
+        Unregister();
+    }
+}
+
+void EditModeWarmup::Unregister()
+{
+    if (m_isRegistered) {
+        FrameCallbackDispatcher::GetSingleton()->Unregister(this);
+        m_isRegistered = false;
+    }
+}
+
+bool EditModeWarmup::CreateSelectionMenu()
+{
+    return MenuStateManager::GetSingleton()->EnsureSelectionMenuReady();
+}
+
+bool EditModeWarmup::PrewarmSelectionMenu()
+{
+    if (!MenuStateManager::GetSingleton()->IsSelectionMenuReady()) {
+        return false;
+    }
+    SelectionMenu::GetSingleton()->PrewarmElements();
+    return true;
+}
+
+bool EditModeWarmup::CreateGalleryMenu()
+{
+    return MenuStateManager::GetSingleton()->EnsureGalleryMenuReady();
+}
+
+bool EditModeWarmup::PrewarmGalleryMenu()
+{
+    if (!MenuStateManager::GetSingleton()->IsGalleryMenuReady()) {
+        return false;
+    }
+    GalleryMenu::GetSingleton()->PrewarmElements();
+    return true;
+}
+
+bool EditModeWarmup::PrewarmSphereSelection()
+{
+    Grab::SphereSelectionController::GetSingleton()->Prewarm();
+    return true;
+}
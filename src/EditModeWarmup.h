@@ -0,0 +1,70 @@
+#pragma once
+
+#include "IFrameUpdateListener.h"
+#include <cstddef>
+#include <iterator>
+
+// =============================================================================
+// EditModeWarmup - Builds edit-mode resources ahead of the first entry
+// =============================================================================
+// Menus, 3DUI elements and scan buffers are created lazily, which used to make
+// the first edit-mode entry (and the first menu open) of a session hitch.
+// Start() is called on PostLoadGame/NewGame; the warm-up then runs one step per
+// idle frame (no game-stopping menu open, not in edit mode, frame not already
+// slow), so the work is spread out and never stacks on the load screen.
+//
+// Every step goes through the same lazy paths the menus use (EnsureXxxReady,
+// pooled elements), so entering edit mode before warm-up finishes is still safe -
+// it just pays for whatever has not been built yet.
+class EditModeWarmup : public IFrameUpdateListener
+{
+public:
+    static EditModeWarmup* GetSingleton();
+
+    // Begin warming up (no-op once complete - resources survive game loads)
+    void Start();
+
+    bool IsComplete() const { return m_nextStep >= kStepCount; }
+
+    // IFrameUpdateListener interface
+    void OnFrameUpdate(float deltaTime) override;
+
+private:
+    EditModeWarmup() = default;
+    ~EditModeWarmup() = default;
+    EditModeWarmup(const EditModeWarmup&) = delete;
+    EditModeWarmup& operator=(const EditModeWarmup&) = delete;
+
+    struct Step {
+        const char* name;
+        bool (*run)();
+    };
+
+    static bool CreateSelectionMenu();
+    static bool PrewarmSelectionMenu();
+    static bool CreateGalleryMenu();
+    static bool PrewarmGalleryMenu();
+    static bool PrewarmSphereSelection();
+
+    static constexpr Step kSteps[] = {
+        { "SelectionMenu roots", &CreateSelectionMenu },
+        { "SelectionMenu elements", &PrewarmSelectionMenu },
+        { "GalleryMenu roots", &CreateGalleryMenu },
+        { "GalleryMenu elements", &PrewarmGalleryMenu },
+        { "Sphere selection", &PrewarmSphereSelection },
+    };
+    static constexpr size_t kStepCount = std::size(kSteps);
+
+    // Frames to wait after Start() - lets the post-load frames settle first
+    static constexpr int kStartDelayFrames = 60;
+
+    // Frames slower than this are not idle - wait for the next one
+    static constexpr float kMaxIdleFrameTime = 1.0f / 45.0f;
+
+    void Unregister();
+
+    size_t m_nextStep = 0;
+    int m_delayFrames = 0;
+    float m_totalMs = 0.0f;
+    bool m_isRegistered = false;
+};
@@ -1,7 +1,12 @@
 #include "FrameCallbackDispatcher.h"
 #include "EditModeManager.h"
+#include "util/AllocationCounter.h"
+#include "util/FrameArena.h"
+#include "util/InputRecorder.h"
+#include "util/Profiler.h"
 #include "log.h"
 #include <algorithm>
+#include <typeinfo>
 
 FrameCallbackDispatcher* FrameCallbackDispatcher::GetSingleton()
 {
@@ -78,15 +83,27 @@ void FrameCallbackDispatcher::OnMainThreadUpdate()
     instance->m_lastUpdateTime = now;
     instance->m_hasLastUpdateTime = true;
 
+    // A replay substitutes the recorded frame (controller states, poses and delta
+    // time); a recording captures the live one before listeners see it
+    if (auto* replay = InputReplay::GetSingleton(); replay->IsActive()) {
+        deltaTime = replay->AdvanceFrame(deltaTime);
+    }
+    InputRecorder::GetSingleton()->RecordFrame(deltaTime);
+
     instance->Update(deltaTime);
 }
 
 void FrameCallbackDispatcher::Update(float deltaTime)
 {
+    PROFILE_FUNCTION();
     bool inEditMode = IsInEditMode();
 
+    // New frame: last frame's scratch containers are released
+    Util::FrameArena::GetSingleton()->Reset();
+    Util::AllocationCounter::ResetThreadCount();
+
     // Make a copy before iterating (callbacks may modify the list)
-    auto listenersCopy = m_listeners;
+    Util::FrameVector<ListenerEntry> listenersCopy(m_listeners.begin(), m_listeners.end(), Util::FrameArena::Get());
 
     for (const auto& entry : listenersCopy) {
         if (!entry.listener) continue;
@@ -96,8 +113,22 @@ void FrameCallbackDispatcher::Update(float deltaTime)
             continue;
         }
 
+        // One zone per listener, named after its class
+        PROFILE_ZONE_DYNAMIC(typeid(*entry.listener).name());
         entry.listener->OnFrameUpdate(deltaTime);
     }
+
+    if constexpr (Util::AllocationCounter::kEnabled) {
+        // Edit mode should settle at zero heap allocations per frame - report
+        // whenever the count changes rather than every frame
+        const uint64_t heapAllocations = Util::AllocationCounter::GetThreadCount();
+        if (inEditMode && heapAllocations != m_lastFrameHeapAllocations) {
+            LOG_DEBUG("FrameCallbackDispatcher: {} heap allocations this frame (frame arena {} bytes, {} overflowed)",
+                heapAllocations, Util::FrameArena::GetSingleton()->GetBytesUsed(),
+                Util::FrameArena::GetSingleton()->GetOverflowCount());
+        }
+        m_lastFrameHeapAllocations = heapAllocations;
+    }
 }
 
 void FrameCallbackDispatcher::Register(IFrameUpdateListener* listener, bool onlyInEditMode)
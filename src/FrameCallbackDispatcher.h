@@ -3,6 +3,7 @@
 #include "IFrameUpdateListener.h"
 #include <vector>
 #include <chrono>
+#include <cstdint>
 
 // Dispatches per-frame updates to registered listeners
 // Hooks into the game's main thread update loop
@@ -32,6 +33,10 @@ public:
 
     size_t GetRegisteredCount() const { return m_listeners.size(); }
 
+    // Heap allocations made on the main thread during the last Update (debug
+    // builds; always 0 in release - see Util::AllocationCounter)
+    uint64_t GetLastFrameHeapAllocations() const { return m_lastFrameHeapAllocations; }
+
 private:
     FrameCallbackDispatcher() = default;
     ~FrameCallbackDispatcher() = default;
@@ -56,4 +61,5 @@ private:
     std::chrono::steady_clock::time_point m_lastUpdateTime;
     bool m_hasLastUpdateTime = false;
     bool m_initialized = false;
+    uint64_t m_lastFrameHeapAllocations = 0;
 };
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "../util/UUID.h"
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/N/NiTransform.h>
 #include <RE/F/FormTypes.h>
+#else
+#include "TestStubs.h"
+#endif
 #include <variant>
 #include <vector>
 
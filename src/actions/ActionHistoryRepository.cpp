@@ -2,7 +2,9 @@
 #include "../log.h"
 #include "../persistence/ChangedObjectRegistry.h"
 #include "../persistence/FormKeyUtil.h"
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/A/Actor.h>
+#endif
 
 namespace Actions {
 
@@ -75,6 +77,37 @@ namespace {
         return form && form->As<RE::Actor>() != nullptr;
     }
 
+    // Collect registry updates for a group of transforms (see UpdateCurrentTransforms)
+    // useChangedTransform: true = use changedTransform (add/redo), false = use initialTransform (undo)
+    std::vector<Persistence::ChangedObjectRegistry::TransformUpdate> BuildTransformUpdates(
+        const std::vector<SingleTransform>& transforms, bool useChangedTransform) {
+        std::vector<Persistence::ChangedObjectRegistry::TransformUpdate> updates;
+        updates.reserve(transforms.size());
+        for (const auto& st : transforms) {
+            if (auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(st.formId)) {
+                std::string formKey = Persistence::FormKeyUtil::BuildFormKey(ref);
+                if (!formKey.empty()) {
+                    const auto& transform = useChangedTransform ? st.changedTransform : st.initialTransform;
+                    const auto& euler = useChangedTransform ? st.changedEulerAngles : st.initialEulerAngles;
+                    updates.push_back({ std::move(formKey), transform, euler, GetLocationName(ref) });
+                }
+            }
+        }
+        return updates;
+    }
+
+    // Register every object of a transform group with the registry in one batch
+    void RegisterTransformGroup(const std::vector<SingleTransform>& transforms, const Util::ActionId& actionId) {
+        std::vector<std::pair<RE::TESObjectREFR*, RE::NiTransform>> objects;
+        objects.reserve(transforms.size());
+        for (const auto& st : transforms) {
+            if (auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(st.formId)) {
+                objects.emplace_back(ref, st.initialTransform);
+            }
+        }
+        Persistence::ChangedObjectRegistry::GetSingleton()->RegisterIfNewBatch(objects, actionId);
+    }
+
     // Helper to register changed objects from an action with the ChangedObjectRegistry
     // Only TransformAction, MultiTransformAction, and DeleteAction modify object state
     // SelectionAction is skipped - it doesn't change the object itself
@@ -92,12 +125,8 @@ namespace {
                     }
                 }
             } else if constexpr (std::is_same_v<T, MultiTransformAction>) {
-                // Multi-transform - register each object
-                for (const auto& st : act.transforms) {
-                    if (auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(st.formId)) {
-                        registry->RegisterIfNew(ref, st.initialTransform, actionId);
-                    }
-                }
+                // Multi-transform - register all objects under a single registry lock
+                RegisterTransformGroup(act.transforms, actionId);
             } else if constexpr (std::is_same_v<T, DeleteAction>) {
                 // Delete - register each deleted object with base form info
                 for (const auto& del : act.deletedObjects) {
@@ -126,20 +155,13 @@ namespace {
                         std::string formKey = Persistence::FormKeyUtil::BuildFormKey(ref);
                         if (!formKey.empty()) {
                             const auto& transform = useChangedTransform ? act.changedTransform : act.initialTransform;
-                            registry->UpdateCurrentTransform(formKey, transform, GetLocationName(ref));
+                            const auto& euler = useChangedTransform ? act.changedEulerAngles : act.initialEulerAngles;
+                            registry->UpdateCurrentTransform(formKey, transform, euler, GetLocationName(ref));
                         }
                     }
                 }
             } else if constexpr (std::is_same_v<T, MultiTransformAction>) {
-                for (const auto& st : act.transforms) {
-                    if (auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(st.formId)) {
-                        std::string formKey = Persistence::FormKeyUtil::BuildFormKey(ref);
-                        if (!formKey.empty()) {
-                            const auto& transform = useChangedTransform ? st.changedTransform : st.initialTransform;
-                            registry->UpdateCurrentTransform(formKey, transform, GetLocationName(ref));
-                        }
-                    }
-                }
+                registry->UpdateCurrentTransforms(BuildTransformUpdates(act.transforms, useChangedTransform));
             }
             // DeleteAction: No transform to update (object is deleted/restored)
             // SelectionAction: No transform changes
@@ -205,7 +227,7 @@ Util::ActionId ActionHistoryRepository::AddTransform(RE::FormID formId,
             // Update current transform for BOS export
             std::string formKey = Persistence::FormKeyUtil::BuildFormKey(ref);
             if (!formKey.empty()) {
-                registry->UpdateCurrentTransform(formKey, changed, GetLocationName(ref));
+                registry->UpdateCurrentTransform(formKey, changed, changedEuler, GetLocationName(ref));
             }
         }
     }
@@ -228,19 +250,11 @@ Util::ActionId ActionHistoryRepository::AddMultiTransform(std::vector<SingleTran
     MultiTransformAction action(std::move(transforms));
     Util::ActionId id = action.actionId;
 
-    // Register each transformed object with persistence and update current transforms
-    auto* registry = Persistence::ChangedObjectRegistry::GetSingleton();
-    for (const auto& st : action.transforms) {
-        if (auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(st.formId)) {
-            registry->RegisterIfNew(ref, st.initialTransform, id);
-
-            // Update current transform for BOS export
-            std::string formKey = Persistence::FormKeyUtil::BuildFormKey(ref);
-            if (!formKey.empty()) {
-                registry->UpdateCurrentTransform(formKey, st.changedTransform, GetLocationName(ref));
-            }
-        }
-    }
+    // Register all transformed objects with persistence and update current transforms
+    // in bulk - one registry lock per pass instead of two per object
+    RegisterTransformGroup(action.transforms, id);
+    Persistence::ChangedObjectRegistry::GetSingleton()->UpdateCurrentTransforms(
+        BuildTransformUpdates(action.transforms, true));  // true = use changedTransform
 
     spdlog::trace("ActionHistoryRepository: Added multi-transform action {} ({} objects)",
         id.ToString(), action.transforms.size());
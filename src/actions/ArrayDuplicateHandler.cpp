@@ -0,0 +1,278 @@
+#include "ArrayDuplicateHandler.h"
+#include "CopyHandler.h"
+#include "../EditModeManager.h"
+#include "../FrameCallbackDispatcher.h"
+#include "../selection/SelectionState.h"
+#include "../util/RotationMath.h"
+#include "../log.h"
+#include <fmt/format.h>
+#include <algorithm>
+
+namespace Actions {
+
+namespace {
+    // Ghosts are visual only - without this the cloned collision objects could be
+    // picked up by the next Havok update of the parent node
+    void StripCollision(RE::NiAVObject* object)
+    {
+        if (!object) return;
+
+        object->collisionObject.reset();
+
+        if (auto* node = object->AsNode()) {
+            for (auto& child : node->GetChildren()) {
+                StripCollision(child.get());
+            }
+        }
+    }
+}
+
+ArrayDuplicateHandler* ArrayDuplicateHandler::GetSingleton()
+{
+    static ArrayDuplicateHandler instance;
+    return &instance;
+}
+
+bool ArrayDuplicateHandler::PreviewLinear(const ArrayLayout::LinearParams& params)
+{
+    if (!CaptureSelection()) {
+        return false;
+    }
+    return ApplyPlacements(ArrayLayout::ComputeLinear(m_sourcePlacements, params));
+}
+
+bool ArrayDuplicateHandler::PreviewRadial(const ArrayLayout::RadialParams& params)
+{
+    if (!CaptureSelection()) {
+        return false;
+    }
+    return ApplyPlacements(ArrayLayout::ComputeRadial(m_sourcePlacements, params));
+}
+
+bool ArrayDuplicateHandler::PreviewRadialAroundSelection(int count, float totalAngle, bool rotateCopies)
+{
+    if (!CaptureSelection()) {
+        return false;
+    }
+
+    ArrayLayout::RadialParams params;
+    params.count = count;
+    params.pivot = ArrayLayout::Centroid(m_sourcePlacements);
+    params.totalAngle = totalAngle;
+    params.rotateCopies = rotateCopies;
+    return ApplyPlacements(ArrayLayout::ComputeRadial(m_sourcePlacements, params));
+}
+
+bool ArrayDuplicateHandler::CaptureSelection()
+{
+    auto* selectionState = Selection::SelectionState::GetSingleton();
+    const uint32_t generation = selectionState->GetGeneration();
+
+    // Same selection as the running preview - keep the ghosts, only the layout changes
+    if (!m_sources.empty() && generation == m_selectionGeneration) {
+        return true;
+    }
+
+    ClearGhosts();
+    m_sources.clear();
+    m_sourcePlacements.clear();
+    m_placements.clear();
+
+    for (const auto& info : selectionState->GetSelection()) {
+        auto* ref = info.ref;
+        if (!ref || ref->As<RE::Actor>()) continue;
+
+        auto* node3D = ref->Get3D();
+        if (!node3D) continue;
+
+        m_sources.push_back({ ref->GetFormID(), node3D->world.scale });
+        m_sourcePlacements.push_back({ ref->GetPosition(), ref->GetAngle() });
+    }
+
+    if (m_sources.empty()) {
+        spdlog::info("ArrayDuplicateHandler: No objects selected that can be arrayed");
+        return false;
+    }
+
+    m_selectionGeneration = generation;
+    return true;
+}
+
+bool ArrayDuplicateHandler::ApplyPlacements(std::vector<ArrayLayout::Placement>&& placements)
+{
+    if (placements.empty()) {
+        Cancel();
+        return false;
+    }
+
+    if (placements.size() > kMaxCopies) {
+        RE::DebugNotification(fmt::format("Array too large ({} copies, max {})", placements.size(), kMaxCopies).c_str());
+        spdlog::warn("ArrayDuplicateHandler: Rejected array of {} copies", placements.size());
+        return false;
+    }
+
+    m_placements = std::move(placements);
+    UpdateGhosts();
+    Register();
+
+    spdlog::trace("ArrayDuplicateHandler: Previewing {} copies of {} objects ({} ghosts)",
+        m_placements.size(), m_sources.size(), m_ghosts.size());
+    return true;
+}
+
+bool ArrayDuplicateHandler::Commit()
+{
+    if (m_placements.empty()) {
+        spdlog::info("ArrayDuplicateHandler: Nothing to commit");
+        return false;
+    }
+
+    auto* copyHandler = CopyHandler::GetSingleton();
+    if (copyHandler->IsBusy()) {
+        RE::DebugNotification("Duplication already in progress");
+        return false;
+    }
+
+    const size_t sourceCount = m_sources.size();
+    std::vector<CopyHandler::CopyRequest> requests;
+    requests.reserve(m_placements.size());
+
+    for (size_t i = 0; i < m_placements.size(); ++i) {
+        const auto& source = m_sources[i % sourceCount];
+        auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(source.formId);
+
+        CopyHandler::CopyRequest request;
+        if (CopyHandler::MakeRequest(ref, m_placements[i].position, m_placements[i].angle, source.scale, request)) {
+            requests.push_back(request);
+        }
+    }
+
+    spdlog::info("ArrayDuplicateHandler: Committing array of {} copies ({} objects)",
+        requests.size(), sourceCount);
+
+    // Ghosts go first - the copies replace them visually over the next frames
+    Cancel();
+    return copyHandler->Submit(std::move(requests), "Arrayed");
+}
+
+void ArrayDuplicateHandler::Cancel()
+{
+    ClearGhosts();
+    m_sources.clear();
+    m_sourcePlacements.clear();
+    m_placements.clear();
+    Unregister();
+}
+
+void ArrayDuplicateHandler::OnFrameUpdate(float)
+{
+    if (m_placements.empty()) {
+        return;
+    }
+
+    // The preview belongs to the selection it was built from
+    if (!EditModeManager::GetSingleton()->IsInEditMode() ||
+        Selection::SelectionState::GetSingleton()->GetGeneration() != m_selectionGeneration) {
+        spdlog::info("ArrayDuplicateHandler: Selection changed - preview dropped");
+        Cancel();
+    }
+}
+
+void ArrayDuplicateHandler::UpdateGhosts()
+{
+    const size_t wanted = std::min(m_placements.size(), kMaxGhosts);
+    const size_t sourceCount = m_sources.size();
+
+    // Shrink: detach ghosts past the new count
+    while (m_ghosts.size() > wanted) {
+        auto& ghost = m_ghosts.back();
+        if (ghost.parent && ghost.node) {
+            ghost.parent->DetachChild(ghost.node.get());
+        }
+        m_ghosts.pop_back();
+    }
+
+    // Grow: ghost i always shows source i % sourceCount, matching the placement order
+    while (m_ghosts.size() < wanted) {
+        Ghost ghost;
+        if (!CreateGhost(m_sources[m_ghosts.size() % sourceCount], ghost)) {
+            // Keep the slot so indices stay aligned with placements
+            spdlog::trace("ArrayDuplicateHandler: No ghost for copy {}", m_ghosts.size());
+        }
+        m_ghosts.push_back(std::move(ghost));
+    }
+
+    for (size_t i = 0; i < m_ghosts.size(); ++i) {
+        PlaceGhost(m_ghosts[i], m_placements[i], m_sources[i % sourceCount].scale);
+    }
+}
+
+bool ArrayDuplicateHandler::CreateGhost(const Source& source, Ghost& outGhost) const
+{
+    auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(source.formId);
+    auto* node3D = ref ? ref->Get3D() : nullptr;
+    auto* parent = node3D ? node3D->parent : nullptr;
+    if (!parent) {
+        return false;
+    }
+
+    auto copy = node3D->CreateDeepCopy();
+    auto* clone = copy ? RE::netimmerse_cast<RE::NiAVObject*>(copy.get()) : nullptr;
+    if (!clone) {
+        return false;
+    }
+
+    StripCollision(clone);
+
+    outGhost.parent.reset(parent);
+    outGhost.node.reset(clone);
+    parent->AttachChild(clone, true);
+    return true;
+}
+
+void ArrayDuplicateHandler::PlaceGhost(const Ghost& ghost, const ArrayLayout::Placement& placement, float scale)
+{
+    if (!ghost.parent || !ghost.node) {
+        return;
+    }
+
+    RE::NiTransform world;
+    world.translate = placement.position;
+    world.rotate = Util::RotationMath::EulerToMatrix(placement.angle);
+    world.scale = scale;
+
+    // Ghosts live under the source's parent - convert the world placement to local space
+    ghost.node->local = ghost.parent->world.Invert() * world;
+
+    RE::NiUpdateData updateData;
+    ghost.node->Update(updateData);
+}
+
+void ArrayDuplicateHandler::ClearGhosts()
+{
+    for (auto& ghost : m_ghosts) {
+        if (ghost.parent && ghost.node) {
+            ghost.parent->DetachChild(ghost.node.get());
+        }
+    }
+    m_ghosts.clear();
+}
+
+void ArrayDuplicateHandler::Register()
+{
+    if (!m_isRegistered) {
+        // Not edit-mode only - OnFrameUpdate must see edit mode exit to drop the ghosts
+        FrameCallbackDispatcher::GetSingleton()->Register(this, false);
+        m_isRegistered = true;
+    }
+}
+
+void ArrayDuplicateHandler::Unregister()
+{
+    if (m_isRegistered) {
+        FrameCallbackDispatcher::GetSingleton()->Unregister(this);
+        m_isRegistered = false;
+    }
+}
+
+} // namespace Actions
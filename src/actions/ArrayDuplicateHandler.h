@@ -0,0 +1,101 @@
+#pragma once
+
+#include "ArrayLayout.h"
+#include "../IFrameUpdateListener.h"
+#include <RE/Skyrim.h>
+#include <cstdint>
+#include <vector>
+
+namespace Actions {
+
+// ArrayDuplicateHandler: Duplicates the selection into a linear or radial array
+//
+// Flow:
+// 1. PreviewLinear / PreviewRadial - capture the selection, compute all copy
+//    placements with ArrayLayout (one vectorized pass) and show ghost clones of the
+//    selected objects' 3D at those placements. Calling a Preview again with new
+//    parameters moves, adds or removes ghosts - nothing is created in the world yet.
+// 2. Commit - turn the placements into CopyHandler requests. CopyHandler creates the
+//    references through its frame-budgeted queue and records them as one CopyAction,
+//    so the whole array is a single undo step.
+// 3. Cancel - remove the ghosts.
+//
+// Ghosts are deep copies of the source 3D attached next to the source node (same
+// parent), with collision stripped so they never enter the Havok world. The preview
+// is dropped automatically when the selection changes or edit mode is exited.
+class ArrayDuplicateHandler : public IFrameUpdateListener
+{
+public:
+    static ArrayDuplicateHandler* GetSingleton();
+
+    // Preview count copies of each selected object, copy k offset by offset * k
+    bool PreviewLinear(const ArrayLayout::LinearParams& params);
+
+    // Preview count copies of each selected object rotated around params.pivot
+    bool PreviewRadial(const ArrayLayout::RadialParams& params);
+
+    // Radial preview around the centre of the selection
+    bool PreviewRadialAroundSelection(int count, float totalAngle, bool rotateCopies);
+
+    // Create the previewed copies; returns false if there is nothing to commit
+    // or CopyHandler is still busy with an earlier copy
+    bool Commit();
+
+    // Remove the preview without creating anything
+    void Cancel();
+
+    bool IsPreviewing() const { return !m_placements.empty(); }
+
+    // IFrameUpdateListener interface - drops stale previews
+    void OnFrameUpdate(float deltaTime) override;
+
+    // Copies per array (all sources together) - keeps a mistyped count from
+    // queueing thousands of references
+    static constexpr size_t kMaxCopies = 1024;
+
+    // Ghosts shown in the preview; larger arrays preview their first kMaxGhosts copies
+    static constexpr size_t kMaxGhosts = 256;
+
+private:
+    ArrayDuplicateHandler() = default;
+    ~ArrayDuplicateHandler() = default;
+    ArrayDuplicateHandler(const ArrayDuplicateHandler&) = delete;
+    ArrayDuplicateHandler& operator=(const ArrayDuplicateHandler&) = delete;
+
+    struct Source {
+        RE::FormID formId = 0;
+        float scale = 1.0f;
+    };
+
+    struct Ghost {
+        RE::NiPointer<RE::NiNode> parent;  // Keeps the parent alive until we detach
+        RE::NiPointer<RE::NiAVObject> node;
+    };
+
+    // Capture the current selection as array sources (skips actors and refs without 3D)
+    // Keeps the existing ghosts when the selection has not changed since the last preview
+    bool CaptureSelection();
+
+    // Validate and store new placements, then sync the ghosts to them
+    bool ApplyPlacements(std::vector<ArrayLayout::Placement>&& placements);
+
+    void UpdateGhosts();
+    bool CreateGhost(const Source& source, Ghost& outGhost) const;
+    static void PlaceGhost(const Ghost& ghost, const ArrayLayout::Placement& placement, float scale);
+    void ClearGhosts();
+
+    void Register();
+    void Unregister();
+
+    std::vector<Source> m_sources;
+    std::vector<ArrayLayout::Placement> m_sourcePlacements;
+    uint32_t m_selectionGeneration = 0;
+
+    // Copy-major: m_placements[k * m_sources.size() + i] is copy k+1 of source i
+    std::vector<ArrayLayout::Placement> m_placements;
+    std::vector<Ghost> m_ghosts;
+
+    bool m_isRegistered = false;
+};
+
+} // namespace Actions
@@ -0,0 +1,197 @@
+#pragma once
+
+#if !defined(TEST_ENVIRONMENT)
+#include "RE/Skyrim.h"
+#else
+#include "TestStubs.h"
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Actions::ArrayLayout {
+
+// ArrayLayout: Pure placement math for the array duplicate tool
+//
+// Every copy k (1..count) of every source object is described by one step:
+//   position' = Rz(step.yaw) * (position - pivot) + pivot + step.translate
+//   angle'    = angle + (0, 0, step.yaw)      (only when rotateCopies is set)
+// Linear arrays use yaw 0 and a growing translation, radial arrays a growing yaw
+// around the pivot and no translation. The steps are computed once, then applied
+// to all sources in structure-of-arrays loops without branches so the compiler can
+// vectorize the pass over the selection.
+//
+// No game calls in here - the layout is unit tested (Tests/test_array_layout.cpp).
+
+constexpr float kPi = 3.14159265358979323846f;
+constexpr float kTwoPi = 2.0f * kPi;
+
+// Upper bound on copies per source - guards against typos like 1000 instead of 10
+constexpr int kMaxCount = 256;
+
+// Position and euler angle (radians, as TESObjectREFR::GetAngle) of one object
+struct Placement {
+    RE::NiPoint3 position;
+    RE::NiPoint3 angle;
+};
+
+// count copies, copy k offset by offset * k from the source
+struct LinearParams {
+    int count = 0;
+    RE::NiPoint3 offset;
+};
+
+// count copies rotated around a vertical axis through pivot
+// totalAngle (radians) is the arc covered by the last copy; a full circle (2*pi)
+// spreads the copies evenly so the last one does not land on the source
+struct RadialParams {
+    int count = 0;
+    RE::NiPoint3 pivot;
+    float totalAngle = kTwoPi;
+    bool rotateCopies = true;  // Turn each copy to face along the circle
+};
+
+// Transform shared by copy k of every source
+struct Step {
+    RE::NiPoint3 translate;
+    float yaw = 0.0f;
+};
+
+inline int ClampCount(int count)
+{
+    return count < 0 ? 0 : (count > kMaxCount ? kMaxCount : count);
+}
+
+// Wrap an angle to [0, 2*pi) - the range the game stores reference angles in
+inline float WrapAngle(float angle)
+{
+    float wrapped = std::fmod(angle, kTwoPi);
+    if (wrapped < 0.0f) {
+        wrapped += kTwoPi;
+    }
+    return wrapped >= kTwoPi ? 0.0f : wrapped;
+}
+
+inline bool IsFullCircle(float totalAngle)
+{
+    return std::abs(std::abs(totalAngle) - kTwoPi) < 1e-4f;
+}
+
+// Angle between two neighbouring copies
+inline float RadialStepAngle(const RadialParams& params)
+{
+    const int count = ClampCount(params.count);
+    if (count == 0) {
+        return 0.0f;
+    }
+    // Full circle: count copies plus the source share the circle evenly
+    return IsFullCircle(params.totalAngle)
+        ? params.totalAngle / static_cast<float>(count + 1)
+        : params.totalAngle / static_cast<float>(count);
+}
+
+inline std::vector<Step> LinearSteps(const LinearParams& params)
+{
+    const int count = ClampCount(params.count);
+    std::vector<Step> steps(static_cast<size_t>(count));
+    for (int k = 0; k < count; ++k) {
+        const float factor = static_cast<float>(k + 1);
+        steps[k].translate = RE::NiPoint3(params.offset.x * factor, params.offset.y * factor, params.offset.z * factor);
+    }
+    return steps;
+}
+
+inline std::vector<Step> RadialSteps(const RadialParams& params)
+{
+    const int count = ClampCount(params.count);
+    const float stepAngle = RadialStepAngle(params);
+    std::vector<Step> steps(static_cast<size_t>(count));
+    for (int k = 0; k < count; ++k) {
+        steps[k].yaw = stepAngle * static_cast<float>(k + 1);
+    }
+    return steps;
+}
+
+// Apply steps to all sources
+// Result is copy-major: result[k * sources.size() + i] is copy k+1 of sources[i]
+// rotateCopies=false keeps the sources' angles (positions still follow the yaw)
+inline std::vector<Placement> Apply(const std::vector<Placement>& sources, const std::vector<Step>& steps,
+                                    const RE::NiPoint3& pivot, bool rotateCopies)
+{
+    const size_t n = sources.size();
+    std::vector<Placement> result(n * steps.size());
+    if (n == 0 || steps.empty()) {
+        return result;
+    }
+
+    // Sources relative to the pivot, split into component arrays
+    std::vector<float> rx(n), ry(n), rz(n);
+    for (size_t i = 0; i < n; ++i) {
+        rx[i] = sources[i].position.x - pivot.x;
+        ry[i] = sources[i].position.y - pivot.y;
+        rz[i] = sources[i].position.z - pivot.z;
+    }
+
+    std::vector<float> outX(n), outY(n), outZ(n);
+    const float yawFactor = rotateCopies ? 1.0f : 0.0f;
+
+    for (size_t k = 0; k < steps.size(); ++k) {
+        const Step& step = steps[k];
+        const float c = std::cos(step.yaw);
+        const float s = std::sin(step.yaw);
+        const float tx = pivot.x + step.translate.x;
+        const float ty = pivot.y + step.translate.y;
+        const float tz = pivot.z + step.translate.z;
+
+        // Branch-free inner loops over contiguous floats
+        for (size_t i = 0; i < n; ++i) {
+            outX[i] = c * rx[i] - s * ry[i] + tx;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            outY[i] = s * rx[i] + c * ry[i] + ty;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            outZ[i] = rz[i] + tz;
+        }
+
+        Placement* out = result.data() + k * n;
+        const float yaw = step.yaw * yawFactor;
+        for (size_t i = 0; i < n; ++i) {
+            out[i].position = RE::NiPoint3(outX[i], outY[i], outZ[i]);
+            out[i].angle = RE::NiPoint3(sources[i].angle.x, sources[i].angle.y,
+                                        WrapAngle(sources[i].angle.z + yaw));
+        }
+    }
+
+    return result;
+}
+
+inline std::vector<Placement> ComputeLinear(const std::vector<Placement>& sources, const LinearParams& params)
+{
+    // Zero yaw - rotateCopies is irrelevant, angles are copied (and wrapped)
+    return Apply(sources, LinearSteps(params), RE::NiPoint3(), false);
+}
+
+inline std::vector<Placement> ComputeRadial(const std::vector<Placement>& sources, const RadialParams& params)
+{
+    return Apply(sources, RadialSteps(params), params.pivot, params.rotateCopies);
+}
+
+// Mean position of the sources - the default pivot for radial arrays
+inline RE::NiPoint3 Centroid(const std::vector<Placement>& sources)
+{
+    if (sources.empty()) {
+        return RE::NiPoint3();
+    }
+    float x = 0.0f, y = 0.0f, z = 0.0f;
+    for (const auto& source : sources) {
+        x += source.position.x;
+        y += source.position.y;
+        z += source.position.z;
+    }
+    const float inv = 1.0f / static_cast<float>(sources.size());
+    return RE::NiPoint3(x * inv, y * inv, z * inv);
+}
+
+} // namespace Actions::ArrayLayout
@@ -0,0 +1,335 @@
+#include "CopyHandler.h"
+#include "../FrameCallbackDispatcher.h"
+#include <fmt/format.h>
+#include <unordered_map>
+
+namespace Actions {
+
+bool CopyHandler::MakeRequest(RE::TESObjectREFR* ref, const RE::NiPoint3& position,
+                              const RE::NiPoint3& angle, float scale, CopyRequest& outRequest)
+{
+    if (!ref) {
+        return false;
+    }
+
+    // Skip actors - copying them causes issues with AI, scripts, and quests
+    if (ref->As<RE::Actor>()) {
+        spdlog::info("CopyHandler: Skipping actor {:08X} (actors cannot be duplicated)", ref->GetFormID());
+        return false;
+    }
+
+    auto* baseObj = ref->GetBaseObject();
+    if (!baseObj) {
+        spdlog::warn("CopyHandler: Object {:08X} has no base object, skipping", ref->GetFormID());
+        return false;
+    }
+
+    auto* cell = ref->GetParentCell();
+    if (!cell || !cell->IsAttached()) {
+        spdlog::warn("CopyHandler: Object {:08X} is not in a loaded cell, skipping", ref->GetFormID());
+        return false;
+    }
+
+    outRequest.originalFormId = ref->GetFormID();
+    outRequest.baseObject = baseObj;
+    outRequest.position = position;
+    outRequest.angle = angle;
+    outRequest.scale = scale;
+    return true;
+}
+
+bool CopyHandler::CopySelection()
+{
+    auto* selectionState = Selection::SelectionState::GetSingleton();
+    const auto& selection = selectionState->GetSelection();
+
+    if (selection.empty()) {
+        spdlog::info("CopyHandler: No objects selected to copy");
+        return false;
+    }
+
+    // Stage 1: prefetch and validate everything before creating anything
+    std::vector<CopyRequest> requests;
+    requests.reserve(selection.size());
+
+    for (const auto& info : selection) {
+        if (!info.ref) continue;
+
+        // Get original transform (including scale)
+        RE::NiPoint3 position = info.ref->GetPosition();
+        float originalScale = 1.0f;
+        if (auto* node3D = info.ref->Get3D()) {
+            originalScale = node3D->world.scale;
+        }
+
+        // Apply offset so copy doesn't overlap original
+        // Offset along X-axis for visibility
+        position.x += kCopyOffset;
+
+        CopyRequest request;
+        if (MakeRequest(info.ref, position, info.ref->GetAngle(), originalScale, request)) {
+            requests.push_back(request);
+        }
+    }
+
+    return Submit(std::move(requests));
+}
+
+bool CopyHandler::Submit(std::vector<CopyRequest>&& requests, std::string_view label)
+{
+    if (m_active) {
+        RE::DebugNotification("Duplication already in progress");
+        spdlog::info("CopyHandler: Ignoring copy request - {} copies still pending",
+            m_requests.size() - m_nextIndex);
+        return false;
+    }
+
+    if (requests.empty()) {
+        spdlog::info("CopyHandler: Nothing to copy");
+        return false;
+    }
+
+    if (!RE::TESDataHandler::GetSingleton()) {
+        spdlog::error("CopyHandler: TESDataHandler not available");
+        return false;
+    }
+
+    Reset();
+    m_active = true;
+    m_label = label;
+    m_requests = std::move(requests);
+
+    // Generate action ID upfront - registry entries and the CopyAction share it
+    m_actionId = Util::UUID::Generate();
+
+    m_copies.reserve(m_requests.size());
+    m_registryRecords.reserve(m_requests.size());
+    m_createdRefs.reserve(m_requests.size());
+
+    // Small copies finish within this frame's budget - no need to involve the dispatcher
+    if (CreateSlice()) {
+        Commit();
+        return true;
+    }
+
+    RE::DebugNotification(fmt::format("Duplicating {} objects...", m_requests.size()).c_str());
+    spdlog::info("CopyHandler: Started staged copy of {} objects", m_requests.size());
+
+    if (!m_isRegistered) {
+        // Keep going outside edit mode - the copies must be committed for undo either way
+        FrameCallbackDispatcher::GetSingleton()->Register(this, false);
+        m_isRegistered = true;
+    }
+    return true;
+}
+
+void CopyHandler::OnFrameUpdate(float deltaTime)
+{
+    if (!m_active) {
+        return;
+    }
+
+    if (CreateSlice()) {
+        Commit();
+        return;
+    }
+
+    m_progressTimer += deltaTime;
+    if (m_progressTimer >= kProgressIntervalSeconds) {
+        m_progressTimer = 0.0f;
+        RE::DebugNotification(fmt::format("Duplicating... {}/{}", m_nextIndex, m_requests.size()).c_str());
+    }
+}
+
+bool CopyHandler::CreateSlice()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    const size_t sliceBegin = m_createdRefs.size();
+
+    size_t created = 0;
+    while (m_nextIndex < m_requests.size() && created < kCreatesPerFrame) {
+        const auto& request = m_requests[m_nextIndex++];
+        created++;
+
+        auto* newRef = CreateCopy(request);
+        if (!newRef) {
+            m_failedCount++;
+            continue;
+        }
+
+        // Build transform for recording
+        RE::NiTransform transform;
+        if (auto* node = newRef->Get3D()) {
+            transform = node->world;
+        } else {
+            transform.translate = request.position;
+            transform.scale = request.scale;
+        }
+
+        SingleCopy copy;
+        copy.originalFormId = request.originalFormId;
+        copy.createdFormId = newRef->GetFormID();
+        copy.transform = transform;
+        m_copies.push_back(copy);
+
+        m_registryRecords.push_back({ newRef, request.baseObject->GetFormID(), transform });
+        m_createdRefs.push_back(newRef);
+
+        spdlog::trace("CopyHandler: Created copy {:08X} of {:08X} at ({:.1f}, {:.1f}, {:.1f})",
+            copy.createdFormId, request.originalFormId,
+            request.position.x, request.position.y, request.position.z);
+
+        if (std::chrono::steady_clock::now() - start >= kFrameBudget) {
+            break;
+        }
+    }
+
+    RegisterCreated(sliceBegin);
+
+    return m_nextIndex >= m_requests.size();
+}
+
+void CopyHandler::RegisterCreated(size_t begin)
+{
+    if (begin >= m_createdRefs.size()) {
+        return;
+    }
+
+    // Register with ChangedObjectRegistry as created objects (for INI export)
+    const std::vector<Persistence::ChangedObjectRegistry::CreatedObjectRecord> records(
+        m_registryRecords.begin() + begin, m_registryRecords.end());
+    Persistence::ChangedObjectRegistry::GetSingleton()->RegisterCreatedObjects(records, m_actionId);
+
+    // Register with CreatedObjectTracker for runtime spawning/despawning
+    // Copies usually share a handful of cells - build each cell's form key once
+    std::unordered_map<RE::TESObjectCELL*, std::string> cellFormKeys;
+    std::vector<Persistence::CreatedObjectTracker::PendingAdd> trackerRecords;
+    trackerRecords.reserve(m_createdRefs.size() - begin);
+    for (size_t i = begin; i < m_createdRefs.size(); ++i) {
+        auto* cell = m_createdRefs[i]->GetParentCell();
+        if (!cell) continue;
+
+        auto [it, inserted] = cellFormKeys.try_emplace(cell);
+        if (inserted) {
+            it->second = Persistence::FormKeyUtil::BuildFormKey(cell);
+        }
+        if (!it->second.empty()) {
+            trackerRecords.push_back({ m_createdRefs[i], m_registryRecords[i].baseFormId, it->second });
+        }
+    }
+    Persistence::CreatedObjectTracker::GetSingleton()->AddBatch(trackerRecords);
+}
+
+RE::TESObjectREFR* CopyHandler::CreateCopy(const CopyRequest& request)
+{
+    // The original may have been unloaded or deleted since the request was made
+    auto* original = RE::TESForm::LookupByID<RE::TESObjectREFR>(request.originalFormId);
+    auto* cell = original ? original->GetParentCell() : nullptr;
+    if (!cell || !cell->IsAttached()) {
+        spdlog::warn("CopyHandler: Original {:08X} is no longer loaded, skipping copy", request.originalFormId);
+        return nullptr;
+    }
+
+    // Create the copy using TESDataHandler
+    auto newRefHandle = RE::TESDataHandler::GetSingleton()->CreateReferenceAtLocation(
+        request.baseObject,
+        request.position,
+        request.angle,
+        cell,
+        original->GetWorldspace(),
+        nullptr,  // a_alreadyCreatedRef
+        nullptr,  // a_primitive
+        RE::ObjectRefHandle(),  // a_linkedRoomRefHandle
+        true,     // a_forcePersist - let game handle persistence
+        true      // a_arg11
+    );
+
+    auto newRef = newRefHandle.get();
+    if (!newRef) {
+        spdlog::error("CopyHandler: Failed to create copy of {:08X}", request.originalFormId);
+        return nullptr;
+    }
+
+    // Apply the original object's scale to the copy
+    if (request.scale != 1.0f) {
+        newRef->SetScale(request.scale);
+    }
+
+    return newRef.get();
+}
+
+void CopyHandler::Commit()
+{
+    auto* selectionState = Selection::SelectionState::GetSingleton();
+
+    if (!m_copies.empty()) {
+        // The copies were registered slice by slice in CreateSlice
+        // Record action for undo (with the pre-generated actionId)
+        CopyAction action(std::move(m_copies));
+        action.actionId = m_actionId;  // Use the same ID we registered with
+        ActionHistoryRepository::GetSingleton()->Add(std::move(action));
+
+        // Unhighlight old selection (use FormID for physics objects)
+        for (const auto& info : selectionState->GetSelection()) {
+            if (info.formId != 0) {
+                ObjectHighlighter::UnhighlightByFormId(info.formId);
+            }
+        }
+
+        // Select the new copies in one step
+        // Note: ObjectHighlighter automatically defers highlight if 3D isn't ready yet
+        selectionState->ReplaceSelection(m_createdRefs);
+    }
+
+    const size_t createdCount = m_createdRefs.size();
+    if (createdCount == 1) {
+        std::string objName = "object";
+        if (auto* fullName = m_registryRecords[0].ref->GetBaseObject()->As<RE::TESFullName>()) {
+            if (const char* name = fullName->GetFullName(); name && name[0] != '\0') {
+                objName = name;
+            }
+        }
+        RE::DebugNotification(fmt::format("{} {}", m_label, objName).c_str());
+    } else if (createdCount > 1) {
+        RE::DebugNotification(fmt::format("{} {} objects", m_label, createdCount).c_str());
+    }
+    if (m_failedCount > 0) {
+        RE::DebugNotification(fmt::format("{} objects could not be copied", m_failedCount).c_str());
+    }
+
+    spdlog::info("CopyHandler: Copied {} objects ({} failed), now selected", createdCount, m_failedCount);
+
+    Reset();
+}
+
+void CopyHandler::Abort()
+{
+    if (!m_active) {
+        return;
+    }
+
+    // The copies created so far stay registered: they are persistent refs either way
+    spdlog::info("CopyHandler: Aborted staged copy ({} of {} created)", m_createdRefs.size(), m_requests.size());
+    Reset();
+}
+
+void CopyHandler::Reset()
+{
+    m_active = false;
+    m_label.clear();
+    m_requests.clear();
+    m_nextIndex = 0;
+    m_copies.clear();
+    m_registryRecords.clear();
+    m_createdRefs.clear();
+    m_failedCount = 0;
+    m_progressTimer = 0.0f;
+
+    if (m_isRegistered) {
+        FrameCallbackDispatcher::GetSingleton()->Unregister(this);
+        m_isRegistered = false;
+    }
+}
+
+} // namespace Actions
@@ -2,6 +2,7 @@
 
 #include "Action.h"
 #include "ActionHistoryRepository.h"
+#include "../IFrameUpdateListener.h"
 #include "../selection/SelectionState.h"
 #include "../visuals/ObjectHighlighter.h"
 #include "../persistence/ChangedObjectRegistry.h"
@@ -13,6 +14,9 @@
 #include <RE/T/TESBoundObject.h>
 #include <RE/T/TESFullName.h>
 #include <RE/M/Misc.h>
+#include <chrono>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace Actions {
@@ -20,7 +24,20 @@ namespace Actions {
 // CopyHandler: Handles duplication of selected objects
 // Records copies to undo history for undo/redo support
 // Registers created objects with ChangedObjectRegistry for persistence tracking
-class CopyHandler
+//
+// Duplication runs as a staged pipeline so large builds don't hitch:
+// 1. Prefetch - resolve and validate every base object up front (actors, missing
+//    bases, unloaded cells are rejected before anything is created)
+// 2. Create   - CreateReferenceAtLocation for at most kCreatesPerFrame copies per
+//    frame (and at most kFrameBudget of wall time). Each frame's copies are
+//    registered with ChangedObjectRegistry and CreatedObjectTracker in one batch
+//    each right away: they are forcePersist refs, so a save taken mid-copy
+//    stores them and they must be exported and tracked like any other copy
+// 3. Commit   - record one CopyAction and replace the selection with the copies
+//    in a single step
+//
+// Requests that fit in one frame's budget complete synchronously inside Submit().
+class CopyHandler : public IFrameUpdateListener
 {
 public:
     static CopyHandler* GetSingleton()
@@ -29,169 +46,83 @@ public:
         return &instance;
     }
 
+    // One reference to create - the copy's placement is already resolved
+    struct CopyRequest {
+        RE::FormID originalFormId = 0;
+        RE::TESBoundObject* baseObject = nullptr;
+        RE::NiPoint3 position;
+        RE::NiPoint3 angle;          // Radians
+        float scale = 1.0f;
+    };
+
     // Duplicate all currently selected objects
     // Places copies slightly offset from originals
-    // Returns true if any objects were copied
-    bool CopySelection()
-    {
-        auto* selectionState = Selection::SelectionState::GetSingleton();
-        auto selection = selectionState->GetSelection();
-
-        if (selection.empty()) {
-            spdlog::info("CopyHandler: No objects selected to copy");
-            return false;
-        }
-
-        std::vector<SingleCopy> copiedObjects;
-        copiedObjects.reserve(selection.size());
-
-        std::vector<RE::FormID> newSelectionFormIds;
-        newSelectionFormIds.reserve(selection.size());
-
-        auto* dataHandler = RE::TESDataHandler::GetSingleton();
-        if (!dataHandler) {
-            spdlog::error("CopyHandler: TESDataHandler not available");
-            return false;
-        }
-
-        // Generate action ID upfront for registry registration
-        Util::ActionId actionId = Util::UUID::Generate();
-
-        auto* registry = Persistence::ChangedObjectRegistry::GetSingleton();
-
-        for (const auto& info : selection) {
-            if (!info.ref) continue;
-
-            // Skip actors - copying them causes issues with AI, scripts, and quests
-            if (info.ref->As<RE::Actor>()) {
-                spdlog::info("CopyHandler: Skipping actor {:08X} (actors cannot be duplicated)", info.formId);
-                continue;
-            }
-
-            auto* baseObj = info.ref->GetBaseObject();
-            if (!baseObj) {
-                spdlog::warn("CopyHandler: Object {:08X} has no base object, skipping", info.formId);
-                continue;
-            }
-
-            // Get original transform (including scale)
-            RE::NiPoint3 position = info.ref->GetPosition();
-            RE::NiPoint3 angle = info.ref->GetAngle();
-            float originalScale = 1.0f;
-            if (auto* node3D = info.ref->Get3D()) {
-                originalScale = node3D->world.scale;
-            }
-
-            // Apply offset so copy doesn't overlap original
-            // Offset along X-axis for visibility
-            position.x += kCopyOffset;
-
-            // Create the copy using TESDataHandler
-            auto newRefHandle = dataHandler->CreateReferenceAtLocation(
-                baseObj,
-                position,
-                angle,
-                info.ref->GetParentCell(),
-                info.ref->GetWorldspace(),
-                nullptr,  // a_alreadyCreatedRef
-                nullptr,  // a_primitive
-                RE::ObjectRefHandle(),  // a_linkedRoomRefHandle
-                true,     // a_forcePersist - let game handle persistence
-                true      // a_arg11
-            );
-
-            auto newRef = newRefHandle.get();
-            if (!newRef) {
-                spdlog::error("CopyHandler: Failed to create copy of {:08X}", info.formId);
-                continue;
-            }
-
-            // Apply the original object's scale to the copy
-            if (originalScale != 1.0f) {
-                newRef->SetScale(originalScale);
-                spdlog::info("CopyHandler: Applied scale {:.2f} to copy {:08X}", originalScale, newRef->GetFormID());
-            }
-
-            // Build transform for recording
-            RE::NiTransform transform;
-            if (auto* node = newRef->Get3D()) {
-                transform = node->world;
-            } else {
-                transform.translate = position;
-                transform.scale = originalScale;
-            }
-
-            // Register with ChangedObjectRegistry as a created object (for INI export)
-            registry->RegisterCreatedObject(newRef.get(), baseObj->GetFormID(), transform, actionId);
-
-            // Register with CreatedObjectTracker for runtime spawning/despawning
-            auto* cell = info.ref->GetParentCell();
-            std::string cellFormKey = cell ? Persistence::FormKeyUtil::BuildFormKey(cell) : "";
-            if (!cellFormKey.empty()) {
-                Persistence::CreatedObjectTracker::GetSingleton()->Add(newRef.get(), baseObj->GetFormID(), cellFormKey);
-            }
-
-            // Record for undo
-            SingleCopy copy;
-            copy.originalFormId = info.formId;
-            copy.createdFormId = newRef->GetFormID();
-            copy.transform = transform;
-            copiedObjects.push_back(copy);
-            newSelectionFormIds.push_back(copy.createdFormId);
-
-            spdlog::info("CopyHandler: Created copy {:08X} of {:08X} at ({:.1f}, {:.1f}, {:.1f})",
-                copy.createdFormId, info.formId, position.x, position.y, position.z);
-
-            // Debug notification with object name
-            std::string objName = "object";
-            if (auto* fullName = baseObj->As<RE::TESFullName>()) {
-                if (const char* name = fullName->GetFullName(); name && name[0] != '\0') {
-                    objName = name;
-                }
-            }
-            std::string notification = "Copied " + objName;
-            RE::DebugNotification(notification.c_str());
-        }
-
-        if (copiedObjects.empty()) {
-            return false;
-        }
-
-        // Record action for undo (with the pre-generated actionId)
-        CopyAction action(std::move(copiedObjects));
-        action.actionId = actionId;  // Use the same ID we registered with
-        ActionHistoryRepository::GetSingleton()->Add(std::move(action));
-
-        // Unhighlight old selection (use FormID for physics objects)
-        for (const auto& info : selection) {
-            if (info.formId != 0) {
-                ObjectHighlighter::UnhighlightByFormId(info.formId);
-            }
-        }
-
-        // Clear old selection and select the new copies
-        // Note: ObjectHighlighter automatically defers highlight if 3D isn't ready yet
-        selectionState->ClearAll();
-        for (auto formId : newSelectionFormIds) {
-            if (auto* form = RE::TESForm::LookupByID(formId)) {
-                if (auto* ref = form->AsReference()) {
-                    selectionState->AddToSelection(ref);
-                }
-            }
-        }
-
-        spdlog::info("CopyHandler: Copied {} objects, now selected", newSelectionFormIds.size());
-        return true;
-    }
+    // Returns true if the copy was started (may complete over the next frames)
+    bool CopySelection();
+
+    // Create the requested copies through the staged pipeline
+    // label is used in notifications ("Copied 12 objects")
+    // Returns false if nothing valid was requested or a copy is already running
+    bool Submit(std::vector<CopyRequest>&& requests, std::string_view label = "Copied");
+
+    // Build a request that places a copy of ref at the given transform
+    // Returns false (and logs why) if ref cannot be duplicated
+    static bool MakeRequest(RE::TESObjectREFR* ref, const RE::NiPoint3& position,
+                            const RE::NiPoint3& angle, float scale, CopyRequest& outRequest);
+
+    bool IsBusy() const { return m_active; }
+
+    // Drop a running copy without recording undo (game load - created refs are gone anyway)
+    void Abort();
+
+    // IFrameUpdateListener interface - runs the create stage
+    void OnFrameUpdate(float deltaTime) override;
 
     // Offset applied to copies so they don't overlap originals
     static constexpr float kCopyOffset = 50.0f;
 
+    // Create-stage budget
+    static constexpr size_t kCreatesPerFrame = 16;
+    static constexpr std::chrono::microseconds kFrameBudget{ 3000 };
+
+    // Minimum time between progress notifications
+    static constexpr float kProgressIntervalSeconds = 1.5f;
+
 private:
     CopyHandler() = default;
     ~CopyHandler() = default;
     CopyHandler(const CopyHandler&) = delete;
     CopyHandler& operator=(const CopyHandler&) = delete;
+
+    // Create the next budgeted slice of copies; returns true when all are created
+    bool CreateSlice();
+
+    // Create one copy; returns nullptr on failure
+    RE::TESObjectREFR* CreateCopy(const CopyRequest& request);
+
+    // Register the copies created since index begin of m_createdRefs
+    void RegisterCreated(size_t begin);
+
+    // Record undo, update selection
+    void Commit();
+
+    void Reset();
+
+    bool m_active = false;
+    bool m_isRegistered = false;
+    std::string m_label;
+
+    std::vector<CopyRequest> m_requests;
+    size_t m_nextIndex = 0;
+    Util::ActionId m_actionId;
+
+    // Results of the create stage, consumed by Commit()
+    std::vector<SingleCopy> m_copies;
+    std::vector<Persistence::ChangedObjectRegistry::CreatedObjectRecord> m_registryRecords;
+    std::vector<RE::TESObjectREFR*> m_createdRefs;
+    size_t m_failedCount = 0;
+
+    float m_progressTimer = 0.0f;
 };
 
 } // namespace Actions
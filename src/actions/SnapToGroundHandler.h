@@ -6,6 +6,7 @@
 #include "../visuals/ObjectHighlighter.h"
 #include "../util/Raycast.h"
 #include "../util/PositioningUtil.h"
+#include "../util/SimdMath.h"
 #include "../util/VRNodes.h"
 #include "../log.h"
 #include <vector>
@@ -217,28 +218,7 @@ private:
     // Build rotation matrix from Euler angles (Skyrim's ZYX order)
     RE::NiMatrix3 EulerToMatrix(const RE::NiPoint3& angles)
     {
-        float cx = std::cos(angles.x);
-        float sx = std::sin(angles.x);
-        float cy = std::cos(angles.y);
-        float sy = std::sin(angles.y);
-        float cz = std::cos(angles.z);
-        float sz = std::sin(angles.z);
-
-        RE::NiMatrix3 result;
-        // ZYX rotation order: first Z (yaw), then Y (roll), then X (pitch)
-        result.entry[0][0] = cy * cz;
-        result.entry[0][1] = -cy * sz;
-        result.entry[0][2] = sy;
-
-        result.entry[1][0] = sx * sy * cz + cx * sz;
-        result.entry[1][1] = -sx * sy * sz + cx * cz;
-        result.entry[1][2] = -sx * cy;
-
-        result.entry[2][0] = -cx * sy * cz + sx * sz;
-        result.entry[2][1] = cx * sy * sz + sx * cz;
-        result.entry[2][2] = cx * cy;
-
-        return result;
+        return Util::SimdMath::EulerToMatrix(angles);
     }
 
     // Apply transform to object using the pre-computed Euler angles (lossless)
@@ -6,6 +6,7 @@
 #include "../util/NotificationManager.h"
 #include "../util/PositioningUtil.h"
 #include "../persistence/ChangedObjectRegistry.h"
+#include "../util/Profiler.h"
 #include "../log.h"
 #include <cmath>
 
@@ -183,6 +184,7 @@ bool UndoRedoController::CheckDoubleTap(vr::EVRButtonId buttonId)
 
 void UndoRedoController::PerformUndo()
 {
+    PROFILE_FUNCTION();
     auto* repo = ActionHistoryRepository::GetSingleton();
     auto* notif = NotificationManager::GetSingleton();
 
@@ -303,6 +305,7 @@ void UndoRedoController::PerformUndo()
 
 void UndoRedoController::PerformRedo()
 {
+    PROFILE_FUNCTION();
     auto* repo = ActionHistoryRepository::GetSingleton();
     auto* notif = NotificationManager::GetSingleton();
 
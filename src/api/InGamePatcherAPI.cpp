@@ -9,6 +9,7 @@
 #include "../EditModeStateManager.h"
 #include "../selection/SelectionState.h"
 #include "../selection/HoverStateManager.h"
+#include "SelectionEventQueue.h"
 #include "../log.h"
 
 #include <RE/Skyrim.h>
@@ -27,6 +28,8 @@ namespace {
     std::mutex g_callbackMutex;
     std::vector<IGP_EditModeCallback> g_editModeCallbacks;
     std::vector<IGP_SelectionCallback> g_selectionCallbacks;
+    std::vector<IGP_SelectionCallback> g_selectionChangeCallbacks;
+    std::vector<IGP_SelectionBatchCallback> g_selectionBatchCallbacks;
 }
 
 // Called by EditModeManager when mode changes
@@ -39,7 +42,7 @@ void NotifyEditModeCallbacks(bool isEntering) {
     }
 }
 
-// Called by SelectionState when selection changes
+// Called by the IGP selection control functions when they change the selection
 void NotifySelectionCallbacks(uint32_t formID, bool isSelected) {
     std::lock_guard<std::mutex> lock(g_callbackMutex);
     for (auto callback : g_selectionCallbacks) {
@@ -49,6 +52,29 @@ void NotifySelectionCallbacks(uint32_t formID, bool isSelected) {
     }
 }
 
+// Called by SelectionEventQueue once per frame with the coalesced changes
+void NotifySelectionChangeCallbacks(const IGP_SelectionChangeEvent* event) {
+    std::lock_guard<std::mutex> lock(g_callbackMutex);
+    for (auto callback : g_selectionChangeCallbacks) {
+        if (event->cleared) {
+            callback(0, false);
+        } else {
+            for (uint32_t i = 0; i < event->removedCount; ++i) callback(event->removed[i], false);
+        }
+        for (uint32_t i = 0; i < event->addedCount; ++i) callback(event->added[i], true);
+    }
+}
+
+// Called by SelectionEventQueue once per frame with the coalesced changes
+void NotifySelectionBatchCallbacks(const IGP_SelectionChangeEvent* event) {
+    std::lock_guard<std::mutex> lock(g_callbackMutex);
+    for (auto callback : g_selectionBatchCallbacks) {
+        if (callback) {
+            callback(event);
+        }
+    }
+}
+
 // =============================================================================
 // Version & Info
 // =============================================================================
@@ -197,6 +223,40 @@ IGP_API uint32_t IGP_GetHoveredFormID() {
     return hovered->GetFormID();
 }
 
+IGP_API uint32_t IGP_CopySelection(uint32_t* buffer, uint32_t capacity) {
+    if (!IGP_IsInEditMode()) {
+        return 0;
+    }
+
+    auto* selection = Selection::SelectionState::GetSingleton();
+    if (!selection) {
+        return 0;
+    }
+
+    return selection->CopyFormIds(buffer, capacity);
+}
+
+IGP_API uint32_t IGP_GetSelectionGeneration() {
+    auto* selection = Selection::SelectionState::GetSingleton();
+    if (!selection) {
+        return 0;
+    }
+
+    return selection->GetGeneration();
+}
+
+// =============================================================================
+// Selection Event Queue
+// =============================================================================
+
+IGP_API IGP_EventReadResult IGP_ReadSelectionEvent(uint32_t* cursor, IGP_SelectionChangeEvent* outEvent) {
+    return API::SelectionEventQueue::GetSingleton()->Read(cursor, outEvent);
+}
+
+IGP_API uint32_t IGP_GetSelectionEventCursor() {
+    return API::SelectionEventQueue::GetSingleton()->GetLatestSequence();
+}
+
 // =============================================================================
 // Selection Control
 // =============================================================================
@@ -333,3 +393,59 @@ IGP_API void IGP_UnregisterSelectionCallback(IGP_SelectionCallback callback) {
         SKSE::log::debug("IGP: Unregistered selection callback");
     }
 }
+
+IGP_API void IGP_RegisterSelectionBatchCallback(IGP_SelectionBatchCallback callback) {
+    if (!callback) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_callbackMutex);
+
+    auto it = std::find(g_selectionBatchCallbacks.begin(), g_selectionBatchCallbacks.end(), callback);
+    if (it == g_selectionBatchCallbacks.end()) {
+        g_selectionBatchCallbacks.push_back(callback);
+        SKSE::log::debug("IGP: Registered selection batch callback");
+    }
+}
+
+IGP_API void IGP_UnregisterSelectionBatchCallback(IGP_SelectionBatchCallback callback) {
+    if (!callback) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_callbackMutex);
+
+    auto it = std::find(g_selectionBatchCallbacks.begin(), g_selectionBatchCallbacks.end(), callback);
+    if (it != g_selectionBatchCallbacks.end()) {
+        g_selectionBatchCallbacks.erase(it);
+        SKSE::log::debug("IGP: Unregistered selection batch callback");
+    }
+}
+
+IGP_API void IGP_RegisterSelectionChangeCallback(IGP_SelectionCallback callback) {
+    if (!callback) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_callbackMutex);
+
+    auto it = std::find(g_selectionChangeCallbacks.begin(), g_selectionChangeCallbacks.end(), callback);
+    if (it == g_selectionChangeCallbacks.end()) {
+        g_selectionChangeCallbacks.push_back(callback);
+        SKSE::log::debug("IGP: Registered selection change callback");
+    }
+}
+
+IGP_API void IGP_UnregisterSelectionChangeCallback(IGP_SelectionCallback callback) {
+    if (!callback) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_callbackMutex);
+
+    auto it = std::find(g_selectionChangeCallbacks.begin(), g_selectionChangeCallbacks.end(), callback);
+    if (it != g_selectionChangeCallbacks.end()) {
+        g_selectionChangeCallbacks.erase(it);
+        SKSE::log::debug("IGP: Unregistered selection change callback");
+    }
+}
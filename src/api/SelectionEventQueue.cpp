@@ -0,0 +1,200 @@
+#include "SelectionEventQueue.h"
+#include "../selection/SelectionState.h"
+#include "../FrameCallbackDispatcher.h"
+#include "../log.h"
+#include <algorithm>
+
+// Defined in InGamePatcherAPI.cpp
+void NotifySelectionChangeCallbacks(const IGP_SelectionChangeEvent* event);
+void NotifySelectionBatchCallbacks(const IGP_SelectionChangeEvent* event);
+
+namespace API {
+
+SelectionEventQueue* SelectionEventQueue::GetSingleton()
+{
+    static SelectionEventQueue instance;
+    return &instance;
+}
+
+void SelectionEventQueue::Initialize()
+{
+    if (m_initialized) {
+        spdlog::warn("SelectionEventQueue already initialized");
+        return;
+    }
+
+    // Flush even outside edit mode - exiting edit mode clears the selection
+    FrameCallbackDispatcher::GetSingleton()->Register(this, false);
+
+    m_initialized = true;
+    spdlog::info("SelectionEventQueue initialized (capacity {} events)", kCapacity);
+}
+
+void SelectionEventQueue::Shutdown()
+{
+    if (!m_initialized) {
+        return;
+    }
+
+    FrameCallbackDispatcher::GetSingleton()->Unregister(this);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pendingAdded.clear();
+    m_pendingRemoved.clear();
+    m_hasPending = false;
+
+    m_initialized = false;
+    spdlog::info("SelectionEventQueue shutdown");
+}
+
+void SelectionEventQueue::AccumulateAdded(RE::FormID formId)
+{
+    // Removed then re-added within the same frame - net no change
+    if (m_pendingRemoved.erase(formId) == 0) {
+        m_pendingAdded.insert(formId);
+    }
+}
+
+void SelectionEventQueue::AccumulateRemoved(RE::FormID formId)
+{
+    // Added then removed within the same frame - net no change
+    if (m_pendingAdded.erase(formId) == 0) {
+        m_pendingRemoved.insert(formId);
+    }
+}
+
+void SelectionEventQueue::Record(const std::vector<Selection::SelectionInfo>& oldSelection,
+                                 const std::vector<Selection::SelectionInfo>& newSelection,
+                                 uint32_t generation)
+{
+    std::vector<RE::FormID> added;
+    std::vector<RE::FormID> removed;
+    const bool cleared = newSelection.empty() && !oldSelection.empty();
+
+    if (cleared) {
+        removed.reserve(oldSelection.size());
+        for (const auto& info : oldSelection) {
+            removed.push_back(info.formId);
+        }
+    } else if (newSelection.size() == oldSelection.size() + 1 &&
+               std::equal(oldSelection.begin(), oldSelection.end(), newSelection.begin())) {
+        // Fast path - AddToSelection appends a single entry
+        added.push_back(newSelection.back().formId);
+    } else {
+        std::unordered_set<RE::FormID> oldIds;
+        std::unordered_set<RE::FormID> newIds;
+        oldIds.reserve(oldSelection.size());
+        newIds.reserve(newSelection.size());
+        for (const auto& info : oldSelection) oldIds.insert(info.formId);
+        for (const auto& info : newSelection) newIds.insert(info.formId);
+
+        for (const auto& info : newSelection) {
+            if (!oldIds.contains(info.formId)) added.push_back(info.formId);
+        }
+        for (const auto& info : oldSelection) {
+            if (!newIds.contains(info.formId)) removed.push_back(info.formId);
+        }
+    }
+
+    if (added.empty() && removed.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto formId : added) AccumulateAdded(formId);
+    for (auto formId : removed) AccumulateRemoved(formId);
+    m_pendingGeneration = generation;
+    m_pendingCleared = newSelection.empty();
+    m_hasPending = true;
+}
+
+void SelectionEventQueue::OnFrameUpdate(float)
+{
+    Flush();
+}
+
+void SelectionEventQueue::Flush()
+{
+    IGP_SelectionChangeEvent event{};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_hasPending) {
+            return;
+        }
+        m_hasPending = false;
+
+        if (m_pendingAdded.empty() && m_pendingRemoved.empty()) {
+            return;  // Everything cancelled out within the frame
+        }
+
+        uint32_t sequence = m_nextSequence++;
+        Slot& slot = m_ring[sequence % kCapacity];
+        slot.sequence = sequence;
+        slot.generation = m_pendingGeneration;
+        slot.cleared = m_pendingCleared && !m_pendingRemoved.empty();
+
+        slot.added.assign(m_pendingAdded.begin(), m_pendingAdded.end());
+        slot.removed.assign(m_pendingRemoved.begin(), m_pendingRemoved.end());
+        std::sort(slot.added.begin(), slot.added.end());
+        std::sort(slot.removed.begin(), slot.removed.end());
+
+        m_pendingAdded.clear();
+        m_pendingRemoved.clear();
+
+        FillEvent(slot, &event);
+    }
+
+    // Slot contents stay valid until the next flush (next frame), and callbacks
+    // run on the main thread, so the event can be handed out without the lock held
+    NotifySelectionBatchCallbacks(&event);
+    NotifySelectionChangeCallbacks(&event);
+
+    spdlog::trace("SelectionEventQueue: Flushed event {} (+{} / -{}, gen {})",
+        event.sequence, event.addedCount, event.removedCount, event.generation);
+}
+
+void SelectionEventQueue::FillEvent(const Slot& slot, IGP_SelectionChangeEvent* outEvent)
+{
+    outEvent->structSize = sizeof(IGP_SelectionChangeEvent);
+    outEvent->sequence = slot.sequence;
+    outEvent->generation = slot.generation;
+    outEvent->cleared = slot.cleared;
+    outEvent->added = slot.added.data();
+    outEvent->addedCount = static_cast<uint32_t>(slot.added.size());
+    outEvent->removed = slot.removed.data();
+    outEvent->removedCount = static_cast<uint32_t>(slot.removed.size());
+}
+
+IGP_EventReadResult SelectionEventQueue::Read(uint32_t* cursor, IGP_SelectionChangeEvent* outEvent)
+{
+    if (!cursor || !outEvent) {
+        return IGP_EventRead_Empty;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const uint32_t latest = m_nextSequence - 1;
+    if (*cursor >= latest) {
+        return IGP_EventRead_Empty;
+    }
+
+    const uint32_t oldest = latest >= kCapacity ? latest - static_cast<uint32_t>(kCapacity) + 1 : 1;
+    if (*cursor + 1 < oldest) {
+        // Consumer fell behind - skip to the oldest retained event
+        *cursor = oldest - 1;
+        return IGP_EventRead_Overflow;
+    }
+
+    const uint32_t next = *cursor + 1;
+    FillEvent(m_ring[next % kCapacity], outEvent);
+    *cursor = next;
+    return IGP_EventRead_OK;
+}
+
+uint32_t SelectionEventQueue::GetLatestSequence()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_nextSequence - 1;
+}
+
+} // namespace API
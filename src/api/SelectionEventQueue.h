@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../IFrameUpdateListener.h"
+#include "InGamePatcherAPI.h"
+#include <RE/Skyrim.h>
+#include <array>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace Selection {
+    struct SelectionInfo;
+}
+
+namespace API {
+
+// SelectionEventQueue: Coalesces selection changes into one event per frame for API consumers
+//
+// SelectionState reports every mutation via Record(). Changes are accumulated as a net
+// added/removed set (adding then removing the same object within a frame cancels out).
+// At frame end the pending set is flushed into a bounded ring buffer of events that
+// consumers read with their own cursor (IGP_ReadSelectionEvent), and handed once to
+// every registered batch callback.
+//
+// Callbacks registered with IGP_RegisterSelectionChangeCallback get the same flushed
+// event one object at a time. Legacy IGP_SelectionCallbacks are not fed from here -
+// they only report changes made through the IGP selection control functions.
+//
+// When a consumer falls more than kCapacity events behind, the oldest events are gone;
+// the read reports overflow and the consumer should resync with IGP_CopySelection.
+//
+class SelectionEventQueue : public IFrameUpdateListener
+{
+public:
+    static constexpr size_t kCapacity = 64;
+
+    static SelectionEventQueue* GetSingleton();
+
+    void Initialize();
+    void Shutdown();
+
+    bool IsInitialized() const { return m_initialized; }
+
+    // IFrameUpdateListener interface - flushes the pending frame's changes
+    void OnFrameUpdate(float deltaTime) override;
+
+    // Called by SelectionState on every selection mutation
+    void Record(const std::vector<Selection::SelectionInfo>& oldSelection,
+                const std::vector<Selection::SelectionInfo>& newSelection,
+                uint32_t generation);
+
+    // Read the event following *cursor (see IGP_ReadSelectionEvent)
+    IGP_EventReadResult Read(uint32_t* cursor, IGP_SelectionChangeEvent* outEvent);
+
+    // Sequence number of the most recently flushed event (0 if none yet)
+    uint32_t GetLatestSequence();
+
+private:
+    SelectionEventQueue() = default;
+    ~SelectionEventQueue() = default;
+    SelectionEventQueue(const SelectionEventQueue&) = delete;
+    SelectionEventQueue& operator=(const SelectionEventQueue&) = delete;
+
+    struct Slot {
+        uint32_t sequence = 0;
+        uint32_t generation = 0;
+        bool cleared = false;
+        std::vector<uint32_t> added;     // Reused between events - keeps its capacity
+        std::vector<uint32_t> removed;
+    };
+
+    void AccumulateAdded(RE::FormID formId);
+    void AccumulateRemoved(RE::FormID formId);
+    void Flush();
+    static void FillEvent(const Slot& slot, IGP_SelectionChangeEvent* outEvent);
+
+    std::mutex m_mutex;
+    std::array<Slot, kCapacity> m_ring;
+    uint32_t m_nextSequence = 1;
+
+    // Pending (not yet flushed) net changes for the current frame
+    std::unordered_set<RE::FormID> m_pendingAdded;
+    std::unordered_set<RE::FormID> m_pendingRemoved;
+    uint32_t m_pendingGeneration = 0;
+    bool m_pendingCleared = false;
+    bool m_hasPending = false;
+
+    bool m_initialized = false;
+};
+
+} // namespace API
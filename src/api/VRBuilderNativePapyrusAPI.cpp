@@ -1,19 +1,19 @@
 #include "VRBuilderNativePapyrusAPI.h"
 #include "../EditModeManager.h"
 #include "../util/PositioningUtil.h"
+#include "../util/RotationMath.h"
+#include "../actions/ActionHistoryRepository.h"
+#include "../selection/SelectionState.h"
 #include "../visuals/ObjectHighlighter.h"
 #include "../ui/SelectionMenu.h"
 #include "../ui/GalleryMenu.h"
-#include "../persistence/AddedObjectsParser.h"
-#include "../persistence/AddedObjectsSpawner.h"
-#include "../persistence/BaseObjectSwapperParser.h"
-#include "../persistence/ChangedObjectRegistry.h"
-#include "../persistence/CreatedObjectTracker.h"
-#include "../persistence/FormKeyUtil.h"
+#include "../persistence/CellResetJob.h"
+#include "../actions/ArrayDuplicateHandler.h"
+#include "../grab/DeferredCollisionUpdateManager.h"
+#include "../util/InputRecorder.h"
+#include "../util/Profiler.h"
 #include "../log.h"
-#include <fmt/format.h>
-#include <RE/P/PlayerCharacter.h>
-#include <filesystem>
+#include <unordered_map>
 #include <vector>
 
 namespace API {
@@ -44,151 +44,231 @@ bool IsInEditMode(RE::StaticFunctionTag*)
 
 void ResetCurrentCellEdits(RE::StaticFunctionTag*)
 {
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (!player) {
-        spdlog::warn("VRBuilderNativePapyrusAPI: ResetCurrentCellEdits - player not found");
-        return;
+    // Spread over several frames - cells with thousands of edits would otherwise freeze the game
+    Persistence::CellResetJob::GetSingleton()->Start();
+}
+
+void CancelResetCurrentCellEdits(RE::StaticFunctionTag*)
+{
+    Persistence::CellResetJob::GetSingleton()->Cancel();
+}
+
+bool IsResettingCellEdits(RE::StaticFunctionTag*)
+{
+    return Persistence::CellResetJob::GetSingleton()->IsRunning();
+}
+
+namespace {
+    constexpr float kDegToRad = 3.14159265358979323846f / 180.0f;
+
+    // Parallel component arrays must be empty (unchanged) or match the ref count
+    bool IsValidComponent(const std::vector<float>& values, size_t count)
+    {
+        return values.empty() || values.size() == count;
     }
 
-    auto* cell = player->GetParentCell();
-    if (!cell) {
-        spdlog::warn("VRBuilderNativePapyrusAPI: ResetCurrentCellEdits - cell not found");
-        return;
+    bool IsValidComponent(const std::vector<float>& x, const std::vector<float>& y,
+                          const std::vector<float>& z, size_t count)
+    {
+        const bool allEmpty = x.empty() && y.empty() && z.empty();
+        const bool allSized = x.size() == count && y.size() == count && z.size() == count;
+        return allEmpty || allSized;
     }
 
-    std::string cellFormKey = Persistence::FormKeyUtil::BuildFormKey(cell);
-    std::string cellEditorId = cell->GetFormEditorID() ? cell->GetFormEditorID() : "";
+    // Current transform of a reference - the live 3D node if loaded, else the reference data
+    RE::NiTransform GetCurrentTransform(RE::TESObjectREFR* ref)
+    {
+        if (auto* node = ref->Get3D()) {
+            return node->world;
+        }
 
-    std::string cellName;
-    if (const char* name = cell->GetName(); name && name[0] != '\0') {
-        cellName = name;
-    } else if (!cellEditorId.empty()) {
-        cellName = cellEditorId;
-    } else {
-        cellName = fmt::format("{:08X}", cell->GetFormID());
+        RE::NiTransform transform;
+        transform.translate = ref->GetPosition();
+        transform.rotate = Util::RotationMath::EulerToMatrix(ref->GetAngle());
+        transform.scale = ref->GetScale();
+        return transform;
     }
+}
 
-    RE::DebugNotification(fmt::format("VR Editor: Resetting {}...", cellName).c_str());
+std::int32_t SetTransforms(RE::StaticFunctionTag*,
+                           std::vector<RE::TESObjectREFR*> refs,
+                           std::vector<float> posX, std::vector<float> posY, std::vector<float> posZ,
+                           std::vector<float> angleX, std::vector<float> angleY, std::vector<float> angleZ,
+                           std::vector<float> scales)
+{
+    const size_t count = refs.size();
+    if (count == 0) {
+        return 0;
+    }
 
-    auto* registry = Persistence::ChangedObjectRegistry::GetSingleton();
-    auto entries = registry->ExtractEntriesForCell(cellFormKey);
+    if (!IsValidComponent(posX, posY, posZ, count) ||
+        !IsValidComponent(angleX, angleY, angleZ, count) ||
+        !IsValidComponent(scales, count)) {
+        spdlog::warn("VRBuilderNativePapyrusAPI: SetTransforms - array lengths do not match {} refs "
+            "(pos {}/{}/{}, angle {}/{}/{}, scale {})", count,
+            posX.size(), posY.size(), posZ.size(), angleX.size(), angleY.size(), angleZ.size(), scales.size());
+        return 0;
+    }
 
-    size_t resetCount = 0;
-    std::vector<std::string> createdFormKeys;
+    const bool hasPositions = !posX.empty();
+    const bool hasAngles = !angleX.empty();
+    const bool hasScales = !scales.empty();
 
-    for (auto& [formKey, data] : entries) {
-        if (data.saveData.wasCreated) {
-            createdFormKeys.push_back(formKey);
-            continue;
-        }
+    // A ref listed more than once gets its last transform, applied once
+    std::unordered_map<RE::TESObjectREFR*, size_t> lastIndex;
+    lastIndex.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        lastIndex[refs[i]] = i;
+    }
+
+    std::vector<Actions::SingleTransform> transforms;
+    std::vector<RE::TESObjectREFR*> appliedRefs;
+    transforms.reserve(count);
+    appliedRefs.reserve(count);
+
+    auto* collision = Grab::DeferredCollisionUpdateManager::GetSingleton();
 
-        RE::FormID runtimeFormId = Persistence::FormKeyUtil::ResolveToRuntimeFormID(formKey);
-        if (runtimeFormId == 0) {
+    for (size_t i = 0; i < count; ++i) {
+        auto* ref = refs[i];
+        if (!ref || ref->IsDeleted() || lastIndex[ref] != i) {
             continue;
         }
 
-        auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(runtimeFormId);
-        if (!ref) {
+        // NPC moves are not persisted - leave actors to the AI
+        if (ref->As<RE::Actor>()) {
+            spdlog::trace("VRBuilderNativePapyrusAPI: SetTransforms - skipping actor {:08X}", ref->GetFormID());
             continue;
         }
 
-        if (ref->IsDeleted()) {
-            ref->SetDelete(false);
-        }
+        Actions::SingleTransform st;
+        st.formId = ref->GetFormID();
+        st.initialTransform = GetCurrentTransform(ref);
+        st.initialEulerAngles = ref->GetAngle();
 
-        ref->Enable(false);
+        st.changedTransform = st.initialTransform;
+        st.changedEulerAngles = st.initialEulerAngles;
+        if (hasPositions) {
+            st.changedTransform.translate = RE::NiPoint3(posX[i], posY[i], posZ[i]);
+        }
+        if (hasAngles) {
+            st.changedEulerAngles = RE::NiPoint3(angleX[i] * kDegToRad, angleY[i] * kDegToRad, angleZ[i] * kDegToRad);
+            st.changedTransform.rotate = Util::RotationMath::EulerToMatrix(st.changedEulerAngles);
+        }
+        if (hasScales) {
+            st.changedTransform.scale = scales[i];
+        }
 
-        // Apply original transform
-        RE::NiPoint3 angles = PositioningUtil::MatrixToEulerAngles(data.saveData.originalTransform.rotate);
-        PositioningUtil::SetPositionNative(ref, data.saveData.originalTransform.translate);
-        PositioningUtil::SetAngleNative(ref, angles);
-        ref->SetScale(data.saveData.originalTransform.scale);
+        // Same sequence as undo/redo: native setters sync game data and the 3D node
+        PositioningUtil::SetPositionNative(ref, st.changedTransform.translate);
+        PositioningUtil::SetAngleNative(ref, st.changedEulerAngles);
+        if (hasScales) {
+            ref->SetScale(st.changedTransform.scale);
+        }
         ref->Update3DPosition(true);
 
-        // Force Havok to rebuild collision and refresh 3D
-        ref->Disable();
-        ref->Enable(false);
+        // Havok rebuild (Disable/Enable) is spread over the next frames, a slice at a time
+        collision->QueueCollisionRebuild(ref);
 
-        resetCount++;
+        transforms.push_back(st);
+        appliedRefs.push_back(ref);
     }
 
-    // Remove and delete added objects for this cell
-    size_t removedAddedCount = 0;
-    auto* tracker = Persistence::CreatedObjectTracker::GetSingleton();
-    if (tracker) {
-        removedAddedCount = tracker->RemoveForCell(cellFormKey);
+    if (transforms.empty()) {
+        return 0;
     }
 
-    // Ensure any created refs not tracked are deleted
-    for (const auto& formKey : createdFormKeys) {
-        RE::FormID runtimeFormId = Persistence::FormKeyUtil::ResolveToRuntimeFormID(formKey);
-        if (runtimeFormId == 0) {
-            continue;
-        }
-
-        auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(runtimeFormId);
-        if (!ref) {
-            continue;
-        }
+    // One undo step for the whole call; registry registration happens in bulk
+    auto applied = static_cast<std::int32_t>(transforms.size());
+    Actions::ActionHistoryRepository::GetSingleton()->AddMultiTransform(std::move(transforms));
 
-        ref->Disable();
-        ref->SetDelete(true);
+    auto* selectionState = Selection::SelectionState::GetSingleton();
+    for (auto* ref : appliedRefs) {
+        selectionState->RefreshHighlightIfSelected(ref);
     }
 
-    if (removedAddedCount < createdFormKeys.size()) {
-        removedAddedCount = createdFormKeys.size();
-    }
+    spdlog::info("VRBuilderNativePapyrusAPI: SetTransforms applied {} of {} refs ({} collision rebuilds queued)",
+        applied, count, collision->GetQueuedRebuildCount());
+    return applied;
+}
 
-    auto* spawner = Persistence::AddedObjectsSpawner::GetSingleton();
-    if (spawner) {
-        spawner->RemoveCellEntries(cellFormKey);
-    }
+std::int32_t SetPositions(RE::StaticFunctionTag* tag,
+                          std::vector<RE::TESObjectREFR*> refs,
+                          std::vector<float> posX, std::vector<float> posY, std::vector<float> posZ)
+{
+    return SetTransforms(tag, std::move(refs), std::move(posX), std::move(posY), std::move(posZ),
+        {}, {}, {}, {});
+}
 
-    // Remove AddedObjects INI for this cell
-    {
-        auto* parser = Persistence::AddedObjectsParser::GetSingleton();
-        auto fileName = Persistence::AddedObjectsParser::BuildIniFileName(cellEditorId, cellFormKey);
-        auto filePath = parser->GetVREditorFolderPath() / fileName;
-        std::error_code ec;
-        if (std::filesystem::exists(filePath)) {
-            std::filesystem::remove(filePath, ec);
-            if (ec) {
-                spdlog::warn("VRBuilderNativePapyrusAPI: Failed to delete {}", filePath.string());
-            }
-        }
-    }
+bool PreviewLinearArray(RE::StaticFunctionTag*, std::int32_t count, float offsetX, float offsetY, float offsetZ)
+{
+    Actions::ArrayLayout::LinearParams params;
+    params.count = count;
+    params.offset = RE::NiPoint3(offsetX, offsetY, offsetZ);
+    return Actions::ArrayDuplicateHandler::GetSingleton()->PreviewLinear(params);
+}
 
-    // Remove BOS swap/session files for this cell
-    {
-        auto* bos = Persistence::BaseObjectSwapperParser::GetSingleton();
-        auto swapFileName = Persistence::BaseObjectSwapperParser::BuildIniFileName(cellEditorId, cellFormKey);
-        auto sessionFileName = Persistence::BaseObjectSwapperParser::BuildSessionIniFileName(cellEditorId, cellFormKey);
-
-        auto swapPath = bos->GetDataFolderPath() / swapFileName;
-        auto sessionPath = bos->GetVREditorFolderPath() / sessionFileName;
-
-        std::error_code ec;
-        if (std::filesystem::exists(swapPath)) {
-            std::filesystem::remove(swapPath, ec);
-            if (ec) {
-                spdlog::warn("VRBuilderNativePapyrusAPI: Failed to delete {}", swapPath.string());
-            }
-        }
-        if (std::filesystem::exists(sessionPath)) {
-            std::filesystem::remove(sessionPath, ec);
-            if (ec) {
-                spdlog::warn("VRBuilderNativePapyrusAPI: Failed to delete {}", sessionPath.string());
-            }
-        }
+bool PreviewRadialArray(RE::StaticFunctionTag*, std::int32_t count, float totalAngle, bool rotateCopies,
+                        bool useSelectionCenter, float pivotX, float pivotY, float pivotZ)
+{
+    auto* handler = Actions::ArrayDuplicateHandler::GetSingleton();
+    if (useSelectionCenter) {
+        return handler->PreviewRadialAroundSelection(count, totalAngle * kDegToRad, rotateCopies);
     }
 
-    // NOTE: Spriggit export feature removed - no partials to clean up
+    Actions::ArrayLayout::RadialParams params;
+    params.count = count;
+    params.pivot = RE::NiPoint3(pivotX, pivotY, pivotZ);
+    params.totalAngle = totalAngle * kDegToRad;
+    params.rotateCopies = rotateCopies;
+    return handler->PreviewRadial(params);
+}
 
-    std::string message = fmt::format("VR Editor: Reset {} objects", resetCount);
-    if (removedAddedCount > 0) {
-        message += fmt::format(", removed {} added objects", removedAddedCount);
+bool CommitArrayDuplicate(RE::StaticFunctionTag*)
+{
+    return Actions::ArrayDuplicateHandler::GetSingleton()->Commit();
+}
+
+void CancelArrayDuplicate(RE::StaticFunctionTag*)
+{
+    Actions::ArrayDuplicateHandler::GetSingleton()->Cancel();
+}
+
+bool StartProfiler(RE::StaticFunctionTag*)
+{
+    Util::Profiler::Start();
+    if (Util::Profiler::kCompiledIn) {
+        spdlog::info("VRBuilderNativePapyrusAPI: Profiler capture started");
     }
-    RE::DebugNotification(message.c_str());
+    return Util::Profiler::kCompiledIn;
+}
+
+bool DumpProfiler(RE::StaticFunctionTag*)
+{
+    return !Util::Profiler::Dump().empty();
+}
+
+// Recorder and replay state is owned by the main thread (controller callbacks and
+// the frame hook), so these only queue the change
+void StartInputRecording(RE::StaticFunctionTag*)
+{
+    SKSE::GetTaskInterface()->AddTask([] { InputRecorder::GetSingleton()->StartRecording(); });
+}
+
+void StopInputRecording(RE::StaticFunctionTag*)
+{
+    SKSE::GetTaskInterface()->AddTask([] { InputRecorder::GetSingleton()->StopRecording(); });
+}
+
+void StartInputReplay(RE::StaticFunctionTag*, std::string fileName)
+{
+    SKSE::GetTaskInterface()->AddTask([fileName = std::move(fileName)] {
+        InputReplay::GetSingleton()->StartReplay(fileName);
+    });
+}
+
+void StopInputReplay(RE::StaticFunctionTag*)
+{
+    SKSE::GetTaskInterface()->AddTask([] { InputReplay::GetSingleton()->StopReplay(); });
 }
 
 bool Bind(VM* a_vm)
@@ -203,6 +283,20 @@ bool Bind(VM* a_vm)
     a_vm->RegisterFunction("ToggleEditMode"sv, scriptName, ToggleEditMode);
     a_vm->RegisterFunction("IsInEditMode"sv, scriptName, IsInEditMode);
     a_vm->RegisterFunction("ResetCurrentCellEdits"sv, scriptName, ResetCurrentCellEdits);
+    a_vm->RegisterFunction("CancelResetCurrentCellEdits"sv, scriptName, CancelResetCurrentCellEdits);
+    a_vm->RegisterFunction("IsResettingCellEdits"sv, scriptName, IsResettingCellEdits);
+    a_vm->RegisterFunction("SetTransforms"sv, scriptName, SetTransforms);
+    a_vm->RegisterFunction("SetPositions"sv, scriptName, SetPositions);
+    a_vm->RegisterFunction("PreviewLinearArray"sv, scriptName, PreviewLinearArray);
+    a_vm->RegisterFunction("PreviewRadialArray"sv, scriptName, PreviewRadialArray);
+    a_vm->RegisterFunction("CommitArrayDuplicate"sv, scriptName, CommitArrayDuplicate);
+    a_vm->RegisterFunction("CancelArrayDuplicate"sv, scriptName, CancelArrayDuplicate);
+    a_vm->RegisterFunction("StartProfiler"sv, scriptName, StartProfiler);
+    a_vm->RegisterFunction("DumpProfiler"sv, scriptName, DumpProfiler);
+    a_vm->RegisterFunction("StartInputRecording"sv, scriptName, StartInputRecording);
+    a_vm->RegisterFunction("StopInputRecording"sv, scriptName, StopInputRecording);
+    a_vm->RegisterFunction("StartInputReplay"sv, scriptName, StartInputReplay);
+    a_vm->RegisterFunction("StopInputReplay"sv, scriptName, StopInputReplay);
 
     spdlog::info("VRBuilderNativePapyrusAPI: Registered native functions for '{}'", scriptName);
     return true;
@@ -2,6 +2,7 @@
 
 #include <RE/Skyrim.h>
 #include <SKSE/SKSE.h>
+#include <vector>
 
 namespace API {
 
@@ -17,8 +18,68 @@ namespace VRBuilderNativePapyrus {
     bool IsInEditMode(RE::StaticFunctionTag*);
 
     /// Reset all edits for the player's current cell
+    /// Starts a time-sliced job (see Persistence::CellResetJob) and returns immediately
     void ResetCurrentCellEdits(RE::StaticFunctionTag*);
 
+    /// Cancel a running cell reset; objects not yet reset keep their edits
+    void CancelResetCurrentCellEdits(RE::StaticFunctionTag*);
+
+    /// Returns true while a cell reset is in progress
+    bool IsResettingCellEdits(RE::StaticFunctionTag*);
+
+    /// Apply transforms to many references in one native call.
+    /// Arrays are parallel to refs: positions in game units, angles in degrees (as
+    /// ObjectReference.SetAngle). Pass empty arrays to leave that component unchanged.
+    /// Recorded as a single undoable MultiTransformAction. Returns the number of refs moved.
+    /// A ref listed more than once gets its last transform. Collision is rebuilt over
+    /// the following frames (see Grab::DeferredCollisionUpdateManager).
+    std::int32_t SetTransforms(RE::StaticFunctionTag*,
+                               std::vector<RE::TESObjectREFR*> refs,
+                               std::vector<float> posX, std::vector<float> posY, std::vector<float> posZ,
+                               std::vector<float> angleX, std::vector<float> angleY, std::vector<float> angleZ,
+                               std::vector<float> scales);
+
+    /// Position-only shorthand for SetTransforms
+    std::int32_t SetPositions(RE::StaticFunctionTag*,
+                              std::vector<RE::TESObjectREFR*> refs,
+                              std::vector<float> posX, std::vector<float> posY, std::vector<float> posZ);
+
+    /// Preview count copies of the selection, copy k offset by (offsetX, offsetY, offsetZ) * k.
+    /// Call again to adjust; nothing is created until CommitArrayDuplicate.
+    bool PreviewLinearArray(RE::StaticFunctionTag*, std::int32_t count, float offsetX, float offsetY, float offsetZ);
+
+    /// Preview count copies of the selection rotated around a vertical axis.
+    /// totalAngle in degrees (360 = evenly spread full circle). useSelectionCenter=true ignores
+    /// the pivot arguments and rotates around the centre of the selection.
+    bool PreviewRadialArray(RE::StaticFunctionTag*, std::int32_t count, float totalAngle, bool rotateCopies,
+                            bool useSelectionCenter, float pivotX, float pivotY, float pivotZ);
+
+    /// Create the previewed array as a single undoable copy
+    bool CommitArrayDuplicate(RE::StaticFunctionTag*);
+
+    /// Remove the array preview
+    void CancelArrayDuplicate(RE::StaticFunctionTag*);
+
+    /// Start a profiler capture (see Util::Profiler). Returns false when the build has
+    /// no profiler (VREDIT_ENABLE_PROFILER=OFF).
+    bool StartProfiler(RE::StaticFunctionTag*);
+
+    /// Stop the capture and write Chrome trace JSON to the SKSE log folder.
+    /// Returns true if a file was written.
+    bool DumpProfiler(RE::StaticFunctionTag*);
+
+    /// Start recording VR input (see InputRecorder). Takes effect on the main thread.
+    void StartInputRecording(RE::StaticFunctionTag*);
+
+    /// Stop recording and write the trace to the SKSE log folder
+    void StopInputRecording(RE::StaticFunctionTag*);
+
+    /// Replay a recorded input trace. fileName is relative to the SKSE log folder.
+    void StartInputReplay(RE::StaticFunctionTag*, std::string fileName);
+
+    /// Stop a running replay; live input takes over again
+    void StopInputReplay(RE::StaticFunctionTag*);
+
     /// Binds native functions to VRBuilderNative script
     bool Bind(VM* a_vm);
 }
@@ -29,6 +29,14 @@ void RegisterConfigOptions()
     // Default: false (0) - tutorial not yet shown
     config->RegisterIntOption(Options::kTutorialShown, 0);
 
+    // Minimum level written to the log file (0 trace .. 6 off).
+    // Default: 0 (trace)
+    config->RegisterIntOption(Options::kLogLevel, 0);
+
+    // Worker threads for background jobs (0 = automatic).
+    // Default: 0
+    config->RegisterIntOption(Options::kJobWorkerCount, 0);
+
     // =========================================================================
     // [Controls] Section - Input and interaction settings
     // =========================================================================
@@ -73,7 +81,15 @@ void RegisterConfigOptions()
     // Default: false (0) - single file mode is cleaner for users
     config->RegisterIntOption(Options::kSavePerCell, 0);
 
-    spdlog::info("ConfigOptions: Registered {} options", 9);
+    // Export cells in the background when the player leaves them (per-cell mode only).
+    // Default: false (0) - files are only written when saving
+    config->RegisterIntOption(Options::kExportOnCellLeave, 0);
+
+    // Write .vrcb files next to the per-cell _AddedObjects.ini files.
+    // Default: false (0) - INI only
+    config->RegisterIntOption(Options::kWriteBinaryCells, 0);
+
+    spdlog::info("ConfigOptions: Registered {} options", 13);
 }
 
 } // namespace Config
@@ -32,6 +32,22 @@ namespace Options {
     /// Default: false (0) - tutorial not yet shown
     constexpr std::string_view kTutorialShown = "General:bTutorialShown";
 
+    /// Minimum level written to the log file (spdlog numbering).
+    /// 0 trace, 1 debug, 2 info, 3 warn, 4 error, 5 critical, 6 off.
+    /// Levels compiled out by VREDIT_LOG_MIN_LEVEL stay off regardless.
+    /// NOTE: This option has no MCM counterpart - edit the INI directly.
+    /// Type: int
+    /// Default: 0 (trace)
+    constexpr std::string_view kLogLevel = "General:iLogLevel";
+
+    /// Worker threads for background jobs (Util::JobSystem).
+    /// 0 picks a count from the CPU, leaving most cores to the game.
+    /// Read once at startup.
+    /// NOTE: This option has no MCM counterpart - edit the INI directly.
+    /// Type: int
+    /// Default: 0 (automatic)
+    constexpr std::string_view kJobWorkerCount = "General:iJobWorkerCount";
+
     // =========================================================================
     // [Controls] Section - Input and interaction settings
     // =========================================================================
@@ -86,6 +102,25 @@ namespace Options {
     /// Default: false (0) - single file mode
     constexpr std::string_view kSavePerCell = "Persistence:bSavePerCell";
 
+    /// Export a cell's pending changes in the background when the player leaves it,
+    /// so saving only has to write the cell the player is in.
+    /// Only used in per-cell mode (bSavePerCell) - the consolidated files hold every
+    /// cell and are still written at save time.
+    /// Files are written on leaving the cell even if the game is never saved.
+    /// NOTE: This option has no MCM counterpart - edit the INI directly.
+    /// Type: bool (stored as int 0/1)
+    /// Default: false (0)
+    constexpr std::string_view kExportOnCellLeave = "Persistence:bExportOnCellLeave";
+
+    /// Also write a binary .vrcb file next to each cell's _AddedObjects.ini.
+    /// The spawner loads it instead of parsing the INI (faster for large cells);
+    /// the INI stays the master copy - a .vrcb older than its INI is ignored.
+    /// Only used in per-cell mode (bSavePerCell).
+    /// NOTE: This option has no MCM counterpart - edit the INI directly.
+    /// Type: bool (stored as int 0/1)
+    /// Default: false (0)
+    constexpr std::string_view kWriteBinaryCells = "Persistence:bWriteBinaryCells";
+
 } // namespace Options
 
 /// Initialize all config options with their default values.
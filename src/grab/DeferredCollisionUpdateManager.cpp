@@ -4,6 +4,7 @@
 #include "../visuals/ObjectHighlighter.h"
 #include "../log.h"
 #include <algorithm>
+#include <cstdint>
 
 namespace Grab {
 
@@ -30,7 +31,8 @@ void DeferredCollisionUpdateManager::Shutdown()
         return;
     }
 
-    // Force complete all pending updates
+    // Force complete all pending and queued updates
+    ProcessRebuildQueue(SIZE_MAX);
     for (auto& pending : m_pendingObjects) {
         if (pending.ref) {
             spdlog::info("DeferredCollisionUpdateManager: Forcing update on shutdown for {:08X}",
@@ -51,11 +53,11 @@ void DeferredCollisionUpdateManager::Shutdown()
 
 void DeferredCollisionUpdateManager::OnFrameUpdate(float deltaTime)
 {
+    // May hand references the player stands on to m_pendingObjects
+    ProcessRebuildQueue(kRebuildsPerFrame);
+
     if (m_pendingObjects.empty()) {
-        if (m_isRegistered) {
-            FrameCallbackDispatcher::GetSingleton()->Unregister(this);
-            m_isRegistered = false;
-        }
+        UnregisterIfIdle();
         return;
     }
 
@@ -89,7 +91,7 @@ void DeferredCollisionUpdateManager::OnFrameUpdate(float deltaTime)
                         pending.state = PendingState::WaitingCooldown;
                         pending.cooldownTimer = kCooldownSeconds;
                     } else {
-                        spdlog::trace("DeferredCollisionUpdateManager: Player still on {:08X}, continuing to wait",
+                        LOG_TRACE("DeferredCollisionUpdateManager: Player still on {:08X}, continuing to wait",
                             pending.formId);
                     }
                 }
@@ -124,10 +126,7 @@ void DeferredCollisionUpdateManager::OnFrameUpdate(float deltaTime)
         }
     }
 
-    if (m_pendingObjects.empty() && m_isRegistered) {
-        FrameCallbackDispatcher::GetSingleton()->Unregister(this);
-        m_isRegistered = false;
-    }
+    UnregisterIfIdle();
 }
 
 bool DeferredCollisionUpdateManager::RegisterForDeferredUpdate(RE::TESObjectREFR* ref,
@@ -159,7 +158,6 @@ bool DeferredCollisionUpdateManager::RegisterForDeferredUpdate(RE::TESObjectREFR
     }
 
     // Add new pending object
-    bool wasEmpty = m_pendingObjects.empty();
     PendingObject pending;
     pending.ref = ref;
     pending.formId = ref->GetFormID();
@@ -169,11 +167,7 @@ bool DeferredCollisionUpdateManager::RegisterForDeferredUpdate(RE::TESObjectREFR
     pending.cooldownTimer = 0.0f;
 
     m_pendingObjects.push_back(pending);
-
-    if (wasEmpty && !m_isRegistered) {
-        FrameCallbackDispatcher::GetSingleton()->Register(this, false);
-        m_isRegistered = true;
-    }
+    RegisterForFrameUpdates();
 
     spdlog::info("DeferredCollisionUpdateManager: Registered {:08X} for deferred update (player is standing on it)",
         pending.formId);
@@ -203,16 +197,86 @@ void DeferredCollisionUpdateManager::ForceImmediateUpdate(RE::TESObjectREFR* ref
             it->formId);
         PerformCollisionUpdate(it->ref, it->finalTransform);
         m_pendingObjects.erase(it);
-        if (m_pendingObjects.empty() && m_isRegistered) {
-            FrameCallbackDispatcher::GetSingleton()->Unregister(this);
-            m_isRegistered = false;
+        UnregisterIfIdle();
+    }
+}
+
+void DeferredCollisionUpdateManager::QueueCollisionRebuild(RE::TESObjectREFR* ref)
+{
+    if (!ref) return;
+
+    const RE::FormID formId = ref->GetFormID();
+    if (!m_queuedRebuilds.insert(formId).second) {
+        return;
+    }
+
+    m_rebuildQueue.push_back(formId);
+    RegisterForFrameUpdates();
+}
+
+void DeferredCollisionUpdateManager::ProcessRebuildQueue(size_t maxCount)
+{
+    if (m_rebuildQueue.empty()) {
+        return;
+    }
+
+    std::vector<RE::TESObjectREFR*> toggled;
+    toggled.reserve(std::min(maxCount, m_rebuildQueue.size()));
+
+    for (size_t processed = 0; processed < maxCount && !m_rebuildQueue.empty(); ++processed) {
+        const RE::FormID formId = m_rebuildQueue.front();
+        m_rebuildQueue.pop_front();
+        m_queuedRebuilds.erase(formId);
+
+        // Without 3D the collision is built at the new position when it loads
+        auto* ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(formId);
+        if (!ref || ref->IsDeleted() || !ref->Get3D()) {
+            continue;
+        }
+
+        // Player standing on it - toggling now would drop them through the floor
+        if (RegisterForDeferredUpdate(ref, ref->Get3D()->world)) {
+            continue;
         }
+
+        // Remove highlight before Disable/Enable destroys 3D
+        ObjectHighlighter::Unhighlight(ref);
+        ref->Disable();
+        toggled.push_back(ref);
+    }
+
+    auto* selectionState = Selection::SelectionState::GetSingleton();
+    for (auto* ref : toggled) {
+        ref->Enable(false);
+        selectionState->RefreshHighlightIfSelected(ref);
+    }
+
+    if (!toggled.empty()) {
+        LOG_DEBUG("DeferredCollisionUpdateManager: Rebuilt collision for {} queued refs, {} left",
+            toggled.size(), m_rebuildQueue.size());
+    }
+}
+
+void DeferredCollisionUpdateManager::RegisterForFrameUpdates()
+{
+    if (!m_isRegistered) {
+        FrameCallbackDispatcher::GetSingleton()->Register(this, false);
+        m_isRegistered = true;
+    }
+}
+
+void DeferredCollisionUpdateManager::UnregisterIfIdle()
+{
+    if (m_isRegistered && m_pendingObjects.empty() && m_rebuildQueue.empty()) {
+        FrameCallbackDispatcher::GetSingleton()->Unregister(this);
+        m_isRegistered = false;
     }
 }
 
 void DeferredCollisionUpdateManager::ClearAll()
 {
-    // Force all pending updates immediately
+    // Force all queued and pending updates immediately
+    ProcessRebuildQueue(SIZE_MAX);
     for (auto& pending : m_pendingObjects) {
         if (pending.ref) {
             spdlog::info("DeferredCollisionUpdateManager: ClearAll - forcing update for {:08X}",
@@ -255,7 +319,7 @@ bool DeferredCollisionUpdateManager::IsPlayerStandingOn(RE::TESObjectREFR* ref)
     auto* supportBody = charController->supportBody.get();
 
     if (supportBody == objectRigidBody) {
-        spdlog::trace("DeferredCollisionUpdateManager: Player supportBody matches {:08X}",
+        LOG_TRACE("DeferredCollisionUpdateManager: Player supportBody matches {:08X}",
             ref->GetFormID());
         return true;
     }
@@ -332,7 +396,7 @@ bool DeferredCollisionUpdateManager::IsNPCStandingOn(RE::TESObjectREFR* ref) con
 
             // Check if this NPC is standing on our object
             if (IsActorStandingOn(actor, objectRigidBody)) {
-                spdlog::trace("DeferredCollisionUpdateManager: NPC {:08X} is standing on {:08X}",
+                LOG_TRACE("DeferredCollisionUpdateManager: NPC {:08X} is standing on {:08X}",
                     actor->GetFormID(), ref->GetFormID());
                 foundNPC = true;
                 return RE::BSContainer::ForEachResult::kStop;
@@ -2,6 +2,8 @@
 
 #include "../IFrameUpdateListener.h"
 #include <RE/Skyrim.h>
+#include <deque>
+#include <unordered_set>
 #include <vector>
 #include <cstdint>
 
@@ -22,6 +24,11 @@ namespace Grab {
 //
 // Detection: Uses bhkCharacterController::supportBody to check what rigid body
 // the player is currently standing on, comparing it to the object's collision body.
+//
+// Batch edits (e.g. the SetTransforms Papyrus native) queue their rebuilds with
+// QueueCollisionRebuild instead of toggling every reference at once. At most
+// kRebuildsPerFrame queued references are rebuilt per frame, disabled together
+// and then enabled together like a CellResetJob slice.
 
 class DeferredCollisionUpdateManager : public IFrameUpdateListener
 {
@@ -44,10 +51,19 @@ public:
     // Check if an object is currently pending deferred update
     bool IsPendingUpdate(RE::TESObjectREFR* ref) const;
 
+    // Queue a Disable/Enable collision rebuild, run over the next frames within
+    // the per-frame budget. Queuing a reference that is already queued is a no-op;
+    // one the player is standing on is handed to RegisterForDeferredUpdate when
+    // its turn comes.
+    void QueueCollisionRebuild(RE::TESObjectREFR* ref);
+
+    size_t GetQueuedRebuildCount() const { return m_rebuildQueue.size(); }
+
     // Force immediate update for an object (e.g., on shutdown or cell unload)
     void ForceImmediateUpdate(RE::TESObjectREFR* ref);
 
     // Clear all pending updates (e.g., on edit mode exit)
+    // Pending and queued rebuilds are performed immediately
     void ClearAll();
 
     // Check if player is currently standing on the given object
@@ -92,11 +108,22 @@ private:
     // Perform the actual Disable/Enable toggle
     void PerformCollisionUpdate(RE::TESObjectREFR* ref, const RE::NiTransform& transform);
 
+    // Rebuild up to maxCount queued references (all of them for SIZE_MAX)
+    void ProcessRebuildQueue(size_t maxCount);
+
+    void RegisterForFrameUpdates();
+    void UnregisterIfIdle();
+
     // Configuration
     static constexpr std::uint32_t kCheckIntervalFrames = 200;  // Check every 90 frames
     static constexpr float kCooldownSeconds = 1.0f;            // Wait 1 second after player leaves
+    static constexpr size_t kRebuildsPerFrame = 32;            // Same slice size as CellResetJob
 
     std::vector<PendingObject> m_pendingObjects;
+
+    // Queued rebuilds by FormID - a reference may be gone by the time its turn comes
+    std::deque<RE::FormID> m_rebuildQueue;
+    std::unordered_set<RE::FormID> m_queuedRebuilds;
     bool m_initialized = false;
     bool m_isRegistered = false;
 };
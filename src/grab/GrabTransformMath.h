@@ -0,0 +1,158 @@
+#pragma once
+
+#if !defined(TEST_ENVIRONMENT)
+#include "RE/Skyrim.h"
+#else
+#include "TestStubs.h"
+#endif
+
+#include "../util/RotationMath.h"
+#include "../util/SimdMath.h"
+
+#include <cmath>
+
+namespace Grab {
+
+// Result of a transform calculation for a single grabbed object
+struct ComputedObjectTransform {
+    RE::NiTransform transform;     // Final visual transform (position + rotation matrix)
+    RE::NiPoint3 eulerAngles;      // Lossless Euler angles for game data
+    bool groundSnapped = false;    // True if object was snapped to ground
+};
+
+namespace GrabTransformMath {
+
+// GrabTransformMath: Per-object transform math of a remote grab
+//
+// RemoteGrabTransformCalculator owns the ground raycast; everything it does
+// before and after the ray lives here, header-only, so a grab of thousands of
+// references can be computed and checked headless (Tests/test_world_query.cpp).
+// Objects orbit the group center by the smoothed Z angle; their own rotation is
+// R_z(-delta) * R_initial so the original orientation is kept exactly.
+
+// Snap an angle (radians) to a grid (degrees)
+inline float SnapAngleToWorldGrid(float angleRad, float gridDegrees)
+{
+    float gridRad = gridDegrees * (3.14159265f / 180.0f);
+    return std::round(angleRad / gridRad) * gridRad;
+}
+
+// Rotated offset (orbital motion around center), height unchanged
+inline RE::NiPoint3 RotatedOffset(const RE::NiPoint3& offset, float angle)
+{
+    RE::NiPoint3 rotated = Util::RotationMath::RotatePointAroundZ(
+        RE::NiPoint3{offset.x, offset.y, 0},
+        RE::NiPoint3{0, 0, 0},
+        angle
+    );
+    rotated.z = offset.z;
+    return rotated;
+}
+
+// Position before ground snap - also the ground raycast origin
+inline RE::NiPoint3 FloatingPosition(const RE::NiPoint3& offset, const RE::NiPoint3& centerPos, float smoothedAngle)
+{
+    RE::NiPoint3 rotatedOffset = RotatedOffset(offset, smoothedAngle);
+
+    return RE::NiPoint3{
+        centerPos.x + rotatedOffset.x,
+        centerPos.y + rotatedOffset.y,
+        centerPos.z + rotatedOffset.z
+    };
+}
+
+// Final world yaw, snapped to the grid when enabled
+inline float FinalYaw(const RE::NiPoint3& initialEulerAngles, float smoothedAngle,
+                      bool rotationGridEnabled, float rotationGridDegrees)
+{
+    float finalZ = initialEulerAngles.z - smoothedAngle;
+    if (rotationGridEnabled) {
+        finalZ = SnapAngleToWorldGrid(finalZ, rotationGridDegrees);
+    }
+    return finalZ;
+}
+
+// Transform of an object carried at floatingPos (no ground under it, or snap off)
+inline ComputedObjectTransform Floating(
+    const RE::NiTransform& initialTransform,
+    const RE::NiPoint3& initialEulerAngles,
+    const RE::NiPoint3& floatingPos,
+    float smoothedAngle,
+    bool rotationGridEnabled,
+    float rotationGridDegrees)
+{
+    ComputedObjectTransform result;
+    result.groundSnapped = false;
+
+    result.transform.scale = initialTransform.scale;
+    result.transform.translate = floatingPos;
+
+    // When rotation grid is enabled, snap the FINAL world rotation to the grid
+    // This ensures objects align to cardinal axes (0°, 15°, 30°, etc.) regardless of their initial orientation
+    const float finalZ = FinalYaw(initialEulerAngles, smoothedAngle, rotationGridEnabled, rotationGridDegrees);
+
+    // Compute the effective delta needed to achieve the (possibly snapped) final rotation
+    const float effectiveDelta = initialEulerAngles.z - finalZ;
+
+    // Apply Z rotation via matrix multiplication to preserve original orientation exactly
+    // This avoids lossy Matrix->Euler->Matrix round-trip that causes rotation snapping
+    // R_new = R_z(-effectiveDelta) * R_original
+    // Note: Use NEGATIVE delta to rotate objects in the intuitive direction
+    const RE::NiMatrix3 deltaRotation = Util::SimdMath::RotationAroundZ(-effectiveDelta);
+    result.transform.rotate = Util::SimdMath::Multiply(deltaRotation, initialTransform.rotate);
+
+    // Lossless Euler angles for game data update
+    result.eulerAngles = RE::NiPoint3{
+        initialEulerAngles.x,    // Pitch unchanged
+        initialEulerAngles.y,    // Roll unchanged
+        finalZ                   // Yaw: snapped to world grid if enabled
+    };
+
+    return result;
+}
+
+// Transform of an object snapped to a ground hit: at the hit point, tilted to
+// the surface normal, yaw kept
+inline ComputedObjectTransform GroundSnapped(
+    const RE::NiTransform& initialTransform,
+    const RE::NiPoint3& initialEulerAngles,
+    const RE::NiPoint3& hitPoint,
+    const RE::NiPoint3& hitNormal,
+    float smoothedAngle,
+    bool rotationGridEnabled,
+    float rotationGridDegrees)
+{
+    ComputedObjectTransform result;
+    result.groundSnapped = true;
+
+    result.transform.scale = initialTransform.scale;
+    result.transform.translate = hitPoint;
+
+    // Normalize surface normal
+    RE::NiPoint3 normal = hitNormal;
+    float len = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+    if (len > 0.001f) {
+        normal.x /= len;
+        normal.y /= len;
+        normal.z /= len;
+    } else {
+        // Default to world up if normal is invalid
+        normal = {0.0f, 0.0f, 1.0f};
+    }
+
+    const float finalYaw = FinalYaw(initialEulerAngles, smoothedAngle, rotationGridEnabled, rotationGridDegrees);
+
+    // LOSSLESS EULER PATH: Compute Euler angles directly from surface normal
+    // - Pitch and roll come from the surface normal (how tilted the ground is)
+    // - Yaw is snapped to world grid if enabled
+    result.eulerAngles = Util::RotationMath::SurfaceNormalToEuler(normal, finalYaw);
+
+    // Build rotation matrix from these Euler angles for visual updates
+    result.transform.rotate = Util::RotationMath::EulerToMatrix(result.eulerAngles);
+
+    return result;
+}
+
+} // namespace GrabTransformMath
+
+} // namespace Grab
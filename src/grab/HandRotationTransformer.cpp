@@ -1,6 +1,7 @@
 #include "HandRotationTransformer.h"
 #include "../util/VRNodes.h"
 #include "../util/PositioningUtil.h"
+#include "../util/SimdMath.h"
 #include "../log.h"
 #include <cmath>
 
@@ -88,18 +89,12 @@ RE::NiMatrix3 HandRotationTransformer::GetHandRotation() const
 RE::NiMatrix3 HandRotationTransformer::InvertRotation(const RE::NiMatrix3& m)
 {
     // For rotation matrices, the inverse is the transpose
-    RE::NiMatrix3 result;
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            result.entry[i][j] = m.entry[j][i];
-        }
-    }
-    return result;
+    return Util::SimdMath::InvertRotation(m);
 }
 
 RE::NiMatrix3 HandRotationTransformer::MultiplyRotations(const RE::NiMatrix3& a, const RE::NiMatrix3& b)
 {
-    return PositioningUtil::MultiplyMatrices(a, b);
+    return Util::SimdMath::Multiply(a, b);
 }
 
 } // namespace Grab
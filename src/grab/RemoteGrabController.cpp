@@ -8,10 +8,13 @@
 #include "../util/VRNodes.h"
 #include "../util/PositioningUtil.h"
 #include "../util/RotationMath.h"
+#include "../util/SimdMath.h"
 #include "../visuals/RaycastRenderer.h"
 #include "../visuals/ObjectHighlighter.h"
 #include "../util/ActionLogger.h"
+#include "../util/Profiler.h"
 #include "../log.h"
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -21,6 +24,8 @@ namespace Grab {
 using Util::RotationMath::ExtractZRotation;
 using Util::RotationMath::EulerToMatrix;
 using Util::RotationMath::RotatePointAroundZ;
+using Util::SimdMath::Multiply;
+using Util::SimdMath::RotateAround;
 
 RemoteGrabController* RemoteGrabController::GetSingleton()
 {
@@ -318,7 +323,7 @@ void RemoteGrabController::OnEnter()
 
         // Skip NPCs in multi-selection (only regular objects)
         if (RemoteNPCPlacementManager::IsNPC(sel.ref)) {
-            spdlog::trace("RemoteGrabController::OnEnter: Skipping NPC {:08X} in multi-selection", sel.formId);
+            LOG_TRACE("RemoteGrabController::OnEnter: Skipping NPC {:08X} in multi-selection", sel.formId);
             continue;
         }
 
@@ -433,11 +438,15 @@ void RemoteGrabController::OnEnter()
         m_objects.size(), m_distance);
 
     // Log initial transforms of all grabbed objects
-    Util::ActionLogger::LogHeader("RemoteGrab START", m_objects.size());
-    for (int i = 0; i < static_cast<int>(m_objects.size()); ++i) {
-        const auto& obj = m_objects[i];
-        Util::ActionLogger::LogSnapshot(i + 1, static_cast<int>(m_objects.size()), obj.formId,
-            obj.initialTransform.translate, obj.initialEulerAngles, obj.initialTransform.scale);
+    if (Util::ActionLogger::IsEnabled()) {
+        const int total = static_cast<int>(m_objects.size());
+        Util::ActionLogger::LogHeader("RemoteGrab START", m_objects.size());
+        for (int i = 0; i < std::min(total, Util::ActionLogger::kMaxLoggedObjects); ++i) {
+            const auto& obj = m_objects[i];
+            Util::ActionLogger::LogSnapshot(i + 1, total, obj.formId,
+                obj.initialTransform.translate, obj.initialEulerAngles, obj.initialTransform.scale);
+        }
+        Util::ActionLogger::LogOmitted(total);
     }
 }
 
@@ -496,16 +505,20 @@ void RemoteGrabController::OnExit()
         RestoreCollisionsOnExit();
 
         // Log before/after transforms of all grabbed objects
-        Util::ActionLogger::LogHeader("RemoteGrab END", m_objects.size());
-        for (int i = 0; i < static_cast<int>(m_objects.size()); ++i) {
-            const auto& obj = m_objects[i];
-            if (!obj.ref || !obj.ref->Get3D()) continue;
-            RE::NiPoint3 currentPos = obj.ref->Get3D()->world.translate;
-            RE::NiPoint3 currentEuler = obj.ref->GetAngle();
-            float currentScale = obj.ref->Get3D()->world.scale;
-            Util::ActionLogger::LogChange(i + 1, static_cast<int>(m_objects.size()), obj.formId,
-                obj.initialTransform.translate, obj.initialEulerAngles, obj.initialTransform.scale,
-                currentPos, currentEuler, currentScale);
+        if (Util::ActionLogger::IsEnabled()) {
+            const int total = static_cast<int>(m_objects.size());
+            Util::ActionLogger::LogHeader("RemoteGrab END", m_objects.size());
+            for (int i = 0; i < std::min(total, Util::ActionLogger::kMaxLoggedObjects); ++i) {
+                const auto& obj = m_objects[i];
+                if (!obj.ref || !obj.ref->Get3D()) continue;
+                RE::NiPoint3 currentPos = obj.ref->Get3D()->world.translate;
+                RE::NiPoint3 currentEuler = obj.ref->GetAngle();
+                float currentScale = obj.ref->Get3D()->world.scale;
+                Util::ActionLogger::LogChange(i + 1, total, obj.formId,
+                    obj.initialTransform.translate, obj.initialEulerAngles, obj.initialTransform.scale,
+                    currentPos, currentEuler, currentScale);
+            }
+            Util::ActionLogger::LogOmitted(total);
         }
 
         // Record actions for undo
@@ -542,6 +555,7 @@ void RemoteGrabController::OnExit()
 
 void RemoteGrabController::OnFrameUpdate(float deltaTime)
 {
+    PROFILE_FUNCTION();
     if (!m_isActive) {
         return;
     }
@@ -805,7 +819,7 @@ void RemoteGrabController::UpdateAllObjects(const RE::NiPoint3& centerPos, const
     if (m_rotationTransformer.IsActive()) {
         // Add current gesture's rotation on top of accumulated
         RE::NiMatrix3 currentDelta = m_rotationTransformer.GetRotationDelta();
-        totalLeftHandRotation = PositioningUtil::MultiplyMatrices(currentDelta, totalLeftHandRotation);
+        totalLeftHandRotation = Multiply(currentDelta, totalLeftHandRotation);
 
         RE::NiPoint3 currentEuler = m_rotationTransformer.GetEulerDelta();
         totalLeftHandEuler.x += currentEuler.x;
@@ -841,26 +855,11 @@ void RemoteGrabController::UpdateAllObjects(const RE::NiPoint3& centerPos, const
         // Apply left-hand rotation if any (group rotation around center)
         if (hasLeftHandRotation) {
             // Rotate position around group center (using display center)
-            RE::NiPoint3 offset = {
-                computed.transform.translate.x - displayCenter.x,
-                computed.transform.translate.y - displayCenter.y,
-                computed.transform.translate.z - displayCenter.z
-            };
-            // Matrix * point multiplication
-            RE::NiPoint3 rotatedOffset = {
-                totalLeftHandRotation.entry[0][0] * offset.x + totalLeftHandRotation.entry[0][1] * offset.y + totalLeftHandRotation.entry[0][2] * offset.z,
-                totalLeftHandRotation.entry[1][0] * offset.x + totalLeftHandRotation.entry[1][1] * offset.y + totalLeftHandRotation.entry[1][2] * offset.z,
-                totalLeftHandRotation.entry[2][0] * offset.x + totalLeftHandRotation.entry[2][1] * offset.y + totalLeftHandRotation.entry[2][2] * offset.z
-            };
-            computed.transform.translate = {
-                displayCenter.x + rotatedOffset.x,
-                displayCenter.y + rotatedOffset.y,
-                displayCenter.z + rotatedOffset.z
-            };
+            computed.transform.translate = RotateAround(
+                totalLeftHandRotation, displayCenter, computed.transform.translate);
 
             // Rotate object orientation
-            computed.transform.rotate = PositioningUtil::MultiplyMatrices(
-                totalLeftHandRotation, computed.transform.rotate);
+            computed.transform.rotate = Multiply(totalLeftHandRotation, computed.transform.rotate);
 
             // Add euler angle deltas
             computed.eulerAngles.x += totalLeftHandEuler.x;
@@ -934,25 +933,11 @@ void RemoteGrabController::RecordActions()
         // Apply accumulated left-hand rotation (group rotation around center)
         if (hasLeftHandRotation) {
             // Rotate position around group center
-            RE::NiPoint3 offset = {
-                computed.transform.translate.x - smoothed.translate.x,
-                computed.transform.translate.y - smoothed.translate.y,
-                computed.transform.translate.z - smoothed.translate.z
-            };
-            RE::NiPoint3 rotatedOffset = {
-                totalLeftHandRotation.entry[0][0] * offset.x + totalLeftHandRotation.entry[0][1] * offset.y + totalLeftHandRotation.entry[0][2] * offset.z,
-                totalLeftHandRotation.entry[1][0] * offset.x + totalLeftHandRotation.entry[1][1] * offset.y + totalLeftHandRotation.entry[1][2] * offset.z,
-                totalLeftHandRotation.entry[2][0] * offset.x + totalLeftHandRotation.entry[2][1] * offset.y + totalLeftHandRotation.entry[2][2] * offset.z
-            };
-            computed.transform.translate = {
-                smoothed.translate.x + rotatedOffset.x,
-                smoothed.translate.y + rotatedOffset.y,
-                smoothed.translate.z + rotatedOffset.z
-            };
+            computed.transform.translate = RotateAround(
+                totalLeftHandRotation, smoothed.translate, computed.transform.translate);
 
             // Rotate object orientation
-            computed.transform.rotate = PositioningUtil::MultiplyMatrices(
-                totalLeftHandRotation, computed.transform.rotate);
+            computed.transform.rotate = Multiply(totalLeftHandRotation, computed.transform.rotate);
             computed.eulerAngles.x += totalLeftHandEuler.x;
             computed.eulerAngles.y += totalLeftHandEuler.y;
             computed.eulerAngles.z += totalLeftHandEuler.z;
@@ -981,7 +966,7 @@ void RemoteGrabController::RecordActions()
     }
 
     if (transforms.empty()) {
-        spdlog::trace("RemoteGrabController: No significant movement or scale change, skipping action record");
+        LOG_TRACE("RemoteGrabController: No significant movement or scale change, skipping action record");
         return;
     }
 
@@ -1029,25 +1014,11 @@ void RemoteGrabController::FinalizePositions()
         // Apply accumulated left-hand rotation (group rotation around center)
         if (hasLeftHandRotation) {
             // Rotate position around group center
-            RE::NiPoint3 offset = {
-                computed.transform.translate.x - smoothed.translate.x,
-                computed.transform.translate.y - smoothed.translate.y,
-                computed.transform.translate.z - smoothed.translate.z
-            };
-            RE::NiPoint3 rotatedOffset = {
-                totalLeftHandRotation.entry[0][0] * offset.x + totalLeftHandRotation.entry[0][1] * offset.y + totalLeftHandRotation.entry[0][2] * offset.z,
-                totalLeftHandRotation.entry[1][0] * offset.x + totalLeftHandRotation.entry[1][1] * offset.y + totalLeftHandRotation.entry[1][2] * offset.z,
-                totalLeftHandRotation.entry[2][0] * offset.x + totalLeftHandRotation.entry[2][1] * offset.y + totalLeftHandRotation.entry[2][2] * offset.z
-            };
-            computed.transform.translate = {
-                smoothed.translate.x + rotatedOffset.x,
-                smoothed.translate.y + rotatedOffset.y,
-                smoothed.translate.z + rotatedOffset.z
-            };
+            computed.transform.translate = RotateAround(
+                totalLeftHandRotation, smoothed.translate, computed.transform.translate);
 
             // Rotate object orientation
-            computed.transform.rotate = PositioningUtil::MultiplyMatrices(
-                totalLeftHandRotation, computed.transform.rotate);
+            computed.transform.rotate = Multiply(totalLeftHandRotation, computed.transform.rotate);
             computed.eulerAngles.x += totalLeftHandEuler.x;
             computed.eulerAngles.y += totalLeftHandEuler.y;
             computed.eulerAngles.z += totalLeftHandEuler.z;
@@ -1063,12 +1034,12 @@ void RemoteGrabController::FinalizePositions()
         obj.ref->SetScale(finalScale);
         obj.ref->Update3DPosition(true);
 
-        spdlog::info("RemoteGrabController: Finalized {:08X} with lossless Euler (deltaZ={:.3f}, groundSnapped={}, leftHandRot={}, scale={:.3f})",
+        LOG_INFO("RemoteGrabController: Finalized {:08X} with lossless Euler (deltaZ={:.3f}, groundSnapped={}, leftHandRot={}, scale={:.3f})",
             obj.formId, smoothedAngle, obj.wasGroundSnapped, hasLeftHandRotation, finalScale);
 
         // Check if player is standing on this object - if so, defer the collision update
         if (deferredManager->RegisterForDeferredUpdate(obj.ref, computed.transform)) {
-            spdlog::info("RemoteGrabController: Deferring collision update for {:08X} (player standing on it)",
+            LOG_INFO("RemoteGrabController: Deferring collision update for {:08X} (player standing on it)",
                 obj.formId);
         } else {
             // Disable/Enable cycle forces Havok to rebuild collision at new position
@@ -1093,7 +1064,7 @@ void RemoteGrabController::DisableCollisionsOnEnter()
         // Check if any actor (player or NPC) is standing on this object - if so, keep collision enabled
         // This prevents actors from falling through objects they're standing on
         if (deferredManager->IsAnyActorStandingOn(obj.ref)) {
-            spdlog::info("RemoteGrabController: Keeping collision enabled for {:08X} (actor is standing on it)",
+            LOG_INFO("RemoteGrabController: Keeping collision enabled for {:08X} (actor is standing on it)",
                 obj.formId);
             obj.collisionDisabled = false;
             continue;
@@ -1102,7 +1073,7 @@ void RemoteGrabController::DisableCollisionsOnEnter()
         // No actor is on this object - safe to disable collision during the grab
         if (PositioningUtil::DisableCollision(obj.ref, obj.collisionState)) {
             obj.collisionDisabled = true;
-            spdlog::info("RemoteGrabController: Disabled collision for {:08X} on grab enter",
+            LOG_INFO("RemoteGrabController: Disabled collision for {:08X} on grab enter",
                 obj.formId);
         } else {
             obj.collisionDisabled = false;
@@ -1119,7 +1090,7 @@ void RemoteGrabController::RestoreCollisionsOnExit()
 
         // Restore collision to its original state
         PositioningUtil::RestoreCollision(obj.ref, obj.collisionState);
-        spdlog::info("RemoteGrabController: Restored collision for {:08X} on grab exit",
+        LOG_INFO("RemoteGrabController: Restored collision for {:08X} on grab exit",
             obj.formId);
 
         obj.collisionDisabled = false;
@@ -1236,7 +1207,7 @@ void RemoteGrabController::FinishLeftHandRotation()
 
     // Skip if changes were negligible
     if (rotationMagnitude < 0.02f) {
-        spdlog::trace("RemoteGrabController: FinishLeftHandRotation - negligible changes, skipping undo entry");
+        LOG_TRACE("RemoteGrabController: FinishLeftHandRotation - negligible changes, skipping undo entry");
         m_leftHandStartStates.clear();
         return;
     }
@@ -1270,7 +1241,7 @@ void RemoteGrabController::FinishLeftHandRotation()
     }
 
     if (transforms.empty()) {
-        spdlog::trace("RemoteGrabController: FinishLeftHandRotation - no valid transforms to record");
+        LOG_TRACE("RemoteGrabController: FinishLeftHandRotation - no valid transforms to record");
         m_leftHandStartStates.clear();
         return;
     }
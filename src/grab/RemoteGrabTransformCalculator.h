@@ -1,19 +1,13 @@
 #pragma once
 
 #include <RE/Skyrim.h>
+#include "GrabTransformMath.h"
 
 namespace Grab {
 
 // Forward declaration
 struct RemoteGrabObject;
 
-// Result of a transform calculation for a single grabbed object
-struct ComputedObjectTransform {
-    RE::NiTransform transform;     // Final visual transform (position + rotation matrix)
-    RE::NiPoint3 eulerAngles;      // Lossless Euler angles for game data
-    bool groundSnapped = false;    // True if object was snapped to ground
-};
-
 // Centralizes transform computation for remote-grabbed objects.
 // This logic is used by:
 //   - UpdateAllObjects (per-frame visual updates)
@@ -22,6 +16,7 @@ struct ComputedObjectTransform {
 //
 // By extracting this to a single class, we ensure all three use cases
 // compute identical transforms, preventing drift or inconsistency.
+// The math itself is in GrabTransformMath.h; this class adds the ground raycast.
 class RemoteGrabTransformCalculator
 {
 public:
@@ -66,18 +61,6 @@ private:
         bool rotationGridEnabled,
         float rotationGridDegrees
     );
-
-    // Internal: Calculate floating (non-snapped) transform
-    static ComputedObjectTransform CalculateFloating(
-        const RemoteGrabObject& obj,
-        const RE::NiPoint3& floatingPos,
-        float smoothedAngle,
-        bool rotationGridEnabled,
-        float rotationGridDegrees
-    );
-
-    // Helper: Snap an angle (radians) to a grid (degrees)
-    static float SnapAngleToWorldGrid(float angleRad, float gridDegrees);
 };
 
 } // namespace Grab
@@ -150,7 +150,7 @@ void RemoteSelectionController::OnFrameUpdate(float deltaTime)
 
     // Cast all five rays - central ray for primary target, all rays for retention
     RE::NiPoint3 hitPoint;
-    std::vector<RE::TESObjectREFR*> retentionHits;
+    Util::FrameVector<RE::TESObjectREFR*> retentionHits(Util::FrameArena::Get());
     RE::TESObjectREFR* primaryHit = CastSelectionRays(hitPoint, retentionHits);
 
     // Update hover state via HoverStateManager (handles debounce and highlighting)
@@ -175,7 +175,7 @@ RE::TESObjectREFR* RemoteSelectionController::CastSelectionRay(RE::NiPoint3& out
     return CastSingleRay(origin, direction, outHitPoint);
 }
 
-RE::TESObjectREFR* RemoteSelectionController::CastSelectionRays(RE::NiPoint3& outHitPoint, std::vector<RE::TESObjectREFR*>& retentionHits)
+RE::TESObjectREFR* RemoteSelectionController::CastSelectionRays(RE::NiPoint3& outHitPoint, Util::FrameVector<RE::TESObjectREFR*>& retentionHits)
 {
     retentionHits.clear();
 
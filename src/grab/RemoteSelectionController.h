@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../IFrameUpdateListener.h"
+#include "../util/FrameArena.h"
 #include <RE/Skyrim.h>
 #include <vector>
 
@@ -58,7 +59,7 @@ private:
 
     // Cast all five rays and collect hits for debouncing
     // Returns the central ray hit (primary target), and fills retentionHits with all objects hit by any ray
-    RE::TESObjectREFR* CastSelectionRays(RE::NiPoint3& outHitPoint, std::vector<RE::TESObjectREFR*>& retentionHits);
+    RE::TESObjectREFR* CastSelectionRays(RE::NiPoint3& outHitPoint, Util::FrameVector<RE::TESObjectREFR*>& retentionHits);
 
     // Cast a single ray in the given direction and return the hit object (or nullptr)
     RE::TESObjectREFR* CastSingleRay(const RE::NiPoint3& origin, const RE::NiPoint3& direction, RE::NiPoint3& outHitPoint);
@@ -5,8 +5,10 @@
 #include "../selection/ObjectFilter.h"
 #include "../util/VRNodes.h"
 #include "../util/Raycast.h"
+#include "../util/WorldQuery.h"
 #include "../visuals/RaycastRenderer.h"
 #include "../ui/MenuStateManager.h"
+#include "../util/Profiler.h"
 #include "../log.h"
 #include <cmath>
 
@@ -35,14 +37,6 @@ namespace {
         }
     }
 
-    // Helper to calculate distance between two points
-    float Distance(const RE::NiPoint3& a, const RE::NiPoint3& b) {
-        float dx = a.x - b.x;
-        float dy = a.y - b.y;
-        float dz = a.z - b.z;
-        return std::sqrt(dx * dx + dy * dy + dz * dz);
-    }
-
     // Helper to normalize a vector
     RE::NiPoint3 Normalize(const RE::NiPoint3& v) {
         float len = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
@@ -266,134 +260,40 @@ bool SphereSelectionController::CastPlacementRay(RE::NiPoint3& outHitPoint)
 
 void SphereSelectionController::ScanObjectsInSphere(const RE::NiPoint3& center, float radius)
 {
-    std::vector<RE::TESObjectREFR*> found;
-    auto* tes = RE::TES::GetSingleton();
-    auto* player = RE::PlayerCharacter::GetSingleton();
-
-    if (!tes || !player) {
-        Selection::SphereHoverStateManager::GetSingleton()->SetHoveredObjects(found);
-        return;
-    }
-
-    // Use ForEachReferenceInRange with player as origin and expanded radius
-    // We use 2x radius to ensure we catch objects when sphere center is away from player
-    // Then do fine-grained distance check from actual sphere center
-    float searchRadius = radius * 2.0f + Distance(center, player->GetPosition());
-
-    tes->ForEachReferenceInRange(player, searchRadius, [&](RE::TESObjectREFR* ref) -> RE::BSContainer::ForEachResult {
-        if (!ref) {
-            return RE::BSContainer::ForEachResult::kContinue;
-        }
-
-        // Skip player
-        if (ref == player) {
-            return RE::BSContainer::ForEachResult::kContinue;
-        }
+    PROFILE_FUNCTION();
+    auto& found = m_scanResults;
+    found.clear();
 
-        // Check if selectable
-        if (!IsSelectable(ref)) {
-            return RE::BSContainer::ForEachResult::kContinue;
-        }
-
-        // Check if object passes the selection filter
-        if (!Selection::ObjectFilter::ShouldProcess(ref)) {
-            return RE::BSContainer::ForEachResult::kContinue;
-        }
-
-        // Fine-grained distance check from sphere center
-        float dist = Distance(ref->GetPosition(), center);
-        if (dist <= radius) {
-            found.push_back(ref);
-        }
-
-        return RE::BSContainer::ForEachResult::kContinue;
-    });
+    // Selectable refs near the sphere that pass the selection filter
+    Util::WorldQuery::CollectInSphere(RE::TES::GetSingleton(), RE::PlayerCharacter::GetSingleton(), center, radius,
+        [](RE::TESObjectREFR* ref) { return Selection::ObjectFilter::ShouldProcess(ref); }, found);
 
     // Update hover state manager with found objects
     Selection::SphereHoverStateManager::GetSingleton()->SetHoveredObjects(found);
 
     if (!found.empty()) {
-        spdlog::trace("SphereSelectionController: Found {} objects in sphere", found.size());
+        LOG_TRACE("SphereSelectionController: Found {} objects in sphere", found.size());
     }
 }
 
-bool SphereSelectionController::IsSelectable(RE::TESObjectREFR* ref) const
+void SphereSelectionController::Prewarm()
 {
-    if (!ref) {
-        return false;
-    }
-
-    // Skip disabled references
-    if (ref->IsDisabled()) {
-        return false;
-    }
-
-    // Skip deleted references
-    if (ref->IsDeleted()) {
-        return false;
-    }
-
-    // Check if the reference has 3D loaded (visible in scene)
-    if (!ref->Get3D()) {
-        return false;
-    }
+    EnsureSphereVisual();
 
-    // Get the base object
-    auto* baseObj = ref->GetBaseObject();
-    if (!baseObj) {
-        return false;
-    }
-
-    // Check object type - we want movable objects, not actors
-    // Skip actors (NPCs, creatures) for now - sphere selection is for props/clutter
-    if (ref->As<RE::Actor>()) {
-        return false;
-    }
-
-    // Accept various static/movable object types
-    switch (baseObj->GetFormType()) {
-        case RE::FormType::Static:
-        case RE::FormType::MovableStatic:
-        case RE::FormType::Container:
-        case RE::FormType::Door:
-        case RE::FormType::Light:
-        case RE::FormType::Furniture:
-        case RE::FormType::Activator:
-        case RE::FormType::Tree:
-        case RE::FormType::Flora:
-        case RE::FormType::Misc:
-        case RE::FormType::Weapon:
-        case RE::FormType::Grass:
-        case RE::FormType::Armor:
-        case RE::FormType::Book:
-        case RE::FormType::IdleMarker:
-        case RE::FormType::Ingredient:
-        case RE::FormType::AnimatedObject:
-        case RE::FormType::AlchemyItem:
-        case RE::FormType::Ammo:
-        case RE::FormType::Scroll:
-        case RE::FormType::SoulGem:
-        case RE::FormType::ArtObject:
-        case RE::FormType::VolumetricLighting:
-            return true;
-        default:
-            return false;
-    }
+    m_scanResults.reserve(kScanReserve);
+    Selection::SphereHoverStateManager::GetSingleton()->Reserve(kScanReserve);
 }
 
-void SphereSelectionController::CreateSphereVisual()
+bool SphereSelectionController::EnsureSphereVisual()
 {
-    // If we already have a sphere root, just show it
     if (m_sphereRoot) {
-        m_sphereRoot->SetVisible(true);
-        spdlog::trace("SphereSelectionController: Reusing existing sphere visual");
-        return;
+        return true;
     }
 
     auto* api = P3DUI::GetInterface001();
     if (!api) {
         spdlog::warn("SphereSelectionController: 3DUI interface not available");
-        return;
+        return false;
     }
 
     // Get or create root for sphere - non-interactive, world-positioned
@@ -403,7 +303,7 @@ void SphereSelectionController::CreateSphereVisual()
 
     if (!m_sphereRoot) {
         spdlog::error("SphereSelectionController: Failed to create sphere root");
-        return;
+        return false;
     }
 
     // Configure for world-space positioning (no VR anchor, no facing)
@@ -421,11 +321,25 @@ void SphereSelectionController::CreateSphereVisual()
     m_sphereElement = api->CreateElement(elemCfg);
     if (m_sphereElement) {
         m_sphereRoot->AddChild(m_sphereElement);
-        m_sphereRoot->SetVisible(true);
         spdlog::info("SphereSelectionController: Created sphere visual");
     } else {
         spdlog::error("SphereSelectionController: Failed to create sphere element");
     }
+
+    // Shown by CreateSphereVisual when sphere selection starts
+    m_sphereRoot->SetVisible(false);
+    return true;
+}
+
+void SphereSelectionController::CreateSphereVisual()
+{
+    if (!EnsureSphereVisual()) {
+        return;
+    }
+
+    if (m_sphereElement) {
+        m_sphereRoot->SetVisible(true);
+    }
 }
 
 void SphereSelectionController::UpdateSphereVisual()
@@ -452,7 +366,7 @@ void SphereSelectionController::DestroySphereVisual()
     // GetOrCreateRoot returns the existing root when called again
     if (m_sphereRoot) {
         m_sphereRoot->SetVisible(false);
-        spdlog::trace("SphereSelectionController: Hidden sphere visual");
+        LOG_TRACE("SphereSelectionController: Hidden sphere visual");
     }
 }
 
@@ -4,6 +4,7 @@
 #include "../interfaces/ThreeDUIInterface001.h"
 #include "../util/InputManager.h"
 #include <RE/Skyrim.h>
+#include <vector>
 
 namespace Grab {
 
@@ -38,6 +39,10 @@ public:
     // Called by EditModeStateManager when leaving SphereSelecting state
     void StopSelection();
 
+    // Edit-mode warm-up: create the (hidden) sphere visual and size the scan buffers
+    // ahead of the first sphere selection
+    void Prewarm();
+
     // Check if we currently have objects in the sphere
     bool HasObjectsInSphere() const;
     size_t GetObjectCount() const;
@@ -50,6 +55,7 @@ public:
     static constexpr float kMaxRayDistance = 10000.0f;     // Max distance for placement ray
     static constexpr float kThumbstickDeadzone = 0.3f;    // Deadzone for thumbstick input
     static constexpr float kRadiusScaleSpeed = 50.0f;     // Radius change per second at full thumbstick
+    static constexpr size_t kScanReserve = 512;           // Scan results pre-allocated by Prewarm()
 
 private:
     SphereSelectionController() = default;
@@ -63,10 +69,8 @@ private:
     // Scan for objects within the sphere
     void ScanObjectsInSphere(const RE::NiPoint3& center, float radius);
 
-    // Check if a reference is selectable
-    bool IsSelectable(RE::TESObjectREFR* ref) const;
-
     // Sphere visual management
+    bool EnsureSphereVisual();  // Creates root + element hidden, no-op once created
     void CreateSphereVisual();
     void UpdateSphereVisual();
     void DestroySphereVisual();
@@ -95,6 +99,9 @@ private:
     float m_radius = kDefaultRadius;
     float m_timeSinceLastScan = 0.0f;
 
+    // Reused by ScanObjectsInSphere - cleared, never shrunk
+    std::vector<RE::TESObjectREFR*> m_scanResults;
+
     // 3DUI sphere visual
     P3DUI::Root* m_sphereRoot = nullptr;
     P3DUI::Element* m_sphereElement = nullptr;
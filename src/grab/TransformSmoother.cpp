@@ -1,117 +1,11 @@
 #include "TransformSmoother.h"
+#include "../util/SimdMath.h"
 #include <cmath>
 
 namespace Grab {
 
-// === Quaternion helper for rotation interpolation ===
-// NiMatrix3 uses rotation matrices, but slerp requires quaternions
-
-struct Quat {
-    float w, x, y, z;
-
-    static Quat FromMatrix(const RE::NiMatrix3& m) {
-        Quat q;
-        float trace = m.entry[0][0] + m.entry[1][1] + m.entry[2][2];
-
-        if (trace > 0.0f) {
-            float s = std::sqrt(trace + 1.0f) * 2.0f;
-            q.w = 0.25f * s;
-            q.x = (m.entry[2][1] - m.entry[1][2]) / s;
-            q.y = (m.entry[0][2] - m.entry[2][0]) / s;
-            q.z = (m.entry[1][0] - m.entry[0][1]) / s;
-        } else if (m.entry[0][0] > m.entry[1][1] && m.entry[0][0] > m.entry[2][2]) {
-            float s = std::sqrt(1.0f + m.entry[0][0] - m.entry[1][1] - m.entry[2][2]) * 2.0f;
-            q.w = (m.entry[2][1] - m.entry[1][2]) / s;
-            q.x = 0.25f * s;
-            q.y = (m.entry[0][1] + m.entry[1][0]) / s;
-            q.z = (m.entry[0][2] + m.entry[2][0]) / s;
-        } else if (m.entry[1][1] > m.entry[2][2]) {
-            float s = std::sqrt(1.0f + m.entry[1][1] - m.entry[0][0] - m.entry[2][2]) * 2.0f;
-            q.w = (m.entry[0][2] - m.entry[2][0]) / s;
-            q.x = (m.entry[0][1] + m.entry[1][0]) / s;
-            q.y = 0.25f * s;
-            q.z = (m.entry[1][2] + m.entry[2][1]) / s;
-        } else {
-            float s = std::sqrt(1.0f + m.entry[2][2] - m.entry[0][0] - m.entry[1][1]) * 2.0f;
-            q.w = (m.entry[1][0] - m.entry[0][1]) / s;
-            q.x = (m.entry[0][2] + m.entry[2][0]) / s;
-            q.y = (m.entry[1][2] + m.entry[2][1]) / s;
-            q.z = 0.25f * s;
-        }
-
-        return q;
-    }
-
-    RE::NiMatrix3 ToMatrix() const {
-        RE::NiMatrix3 m;
-        float xx = x * x, yy = y * y, zz = z * z;
-        float xy = x * y, xz = x * z, yz = y * z;
-        float wx = w * x, wy = w * y, wz = w * z;
-
-        m.entry[0][0] = 1.0f - 2.0f * (yy + zz);
-        m.entry[0][1] = 2.0f * (xy - wz);
-        m.entry[0][2] = 2.0f * (xz + wy);
-
-        m.entry[1][0] = 2.0f * (xy + wz);
-        m.entry[1][1] = 1.0f - 2.0f * (xx + zz);
-        m.entry[1][2] = 2.0f * (yz - wx);
-
-        m.entry[2][0] = 2.0f * (xz - wy);
-        m.entry[2][1] = 2.0f * (yz + wx);
-        m.entry[2][2] = 1.0f - 2.0f * (xx + yy);
-
-        return m;
-    }
-
-    Quat Normalize() const {
-        float len = std::sqrt(w*w + x*x + y*y + z*z);
-        if (len < 0.0001f) return Quat{1, 0, 0, 0};
-        return Quat{w/len, x/len, y/len, z/len};
-    }
-
-    float Dot(const Quat& other) const {
-        return w*other.w + x*other.x + y*other.y + z*other.z;
-    }
-
-    static Quat Slerp(const Quat& a, const Quat& b, float t) {
-        Quat result;
-        float dot = a.Dot(b);
-
-        // If dot is negative, negate one quaternion to take shortest path
-        Quat b2 = b;
-        if (dot < 0.0f) {
-            dot = -dot;
-            b2.w = -b2.w;
-            b2.x = -b2.x;
-            b2.y = -b2.y;
-            b2.z = -b2.z;
-        }
-
-        // If quaternions are very close, use linear interpolation
-        if (dot > 0.9995f) {
-            result.w = a.w + t * (b2.w - a.w);
-            result.x = a.x + t * (b2.x - a.x);
-            result.y = a.y + t * (b2.y - a.y);
-            result.z = a.z + t * (b2.z - a.z);
-            return result.Normalize();
-        }
-
-        float theta_0 = std::acos(dot);
-        float theta = theta_0 * t;
-        float sin_theta = std::sin(theta);
-        float sin_theta_0 = std::sin(theta_0);
-
-        float s0 = std::cos(theta) - dot * sin_theta / sin_theta_0;
-        float s1 = sin_theta / sin_theta_0;
-
-        result.w = s0 * a.w + s1 * b2.w;
-        result.x = s0 * a.x + s1 * b2.x;
-        result.y = s0 * a.y + s1 * b2.y;
-        result.z = s0 * a.z + s1 * b2.z;
-
-        return result.Normalize();
-    }
-};
+// Slerp needs quaternions; NiMatrix3 is converted on the way in and out
+using Util::SimdMath::Quat;
 
 // === TransformSmoother Implementation ===
 
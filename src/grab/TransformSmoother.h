@@ -1,8 +1,12 @@
 #pragma once
 
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/N/NiTransform.h>
 #include <RE/N/NiPoint3.h>
 #include <RE/N/NiMatrix3.h>
+#else
+#include "TestStubs.h"
+#endif
 
 namespace Grab {
 
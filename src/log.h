@@ -1,20 +1,116 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+// =============================================================================
+// Gated logging macros
+// =============================================================================
+// LOG_TRACE/LOG_DEBUG/LOG_INFO/... forward to spdlog::trace/debug/info/... but,
+// unlike calling spdlog directly, do not evaluate their arguments when the level
+// is disabled - no fmt formatting, no GetDisplayName() lookups, nothing. Use them
+// in per-frame and per-candidate loops; plain spdlog:: calls are fine elsewhere.
+//
+// Two gates:
+// - VREDIT_LOG_MIN_LEVEL (compile time): levels below it compile to nothing.
+//   Defaults to trace in debug builds and debug in release builds; override with
+//   -DVREDIT_LOG_MIN_LEVEL=<n> (CMake cache variable of the same name).
+// - Log::SetLevel (runtime): one relaxed atomic load per call site.
+//
+// Level numbers match spdlog: 0 trace, 1 debug, 2 info, 3 warn, 4 error, 5 critical, 6 off.
+
+#ifndef VREDIT_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define VREDIT_LOG_MIN_LEVEL 1
+#else
+#define VREDIT_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+namespace Log {
+    enum Level : int {
+        kTrace = 0,
+        kDebug = 1,
+        kInfo = 2,
+        kWarn = 3,
+        kError = 4,
+        kCritical = 5,
+        kOff = 6,
+    };
+
+    inline std::atomic<int> g_runtimeLevel{ kTrace };
+
+    inline bool IsEnabled(int level)
+    {
+        return level >= VREDIT_LOG_MIN_LEVEL && level >= g_runtimeLevel.load(std::memory_order_relaxed);
+    }
+
+    // SetLevel(int) - defined below per environment
+}
+
+#define VREDIT_LOG_AT(lvl, fn, ...)                                      \
+    do {                                                                 \
+        if constexpr ((lvl) >= VREDIT_LOG_MIN_LEVEL) {                   \
+            if (::Log::IsEnabled(lvl)) {                                 \
+                ::spdlog::fn(__VA_ARGS__);                               \
+            }                                                            \
+        }                                                                \
+    } while (false)
+
+#define LOG_TRACE(...) VREDIT_LOG_AT(::Log::kTrace, trace, __VA_ARGS__)
+#define LOG_DEBUG(...) VREDIT_LOG_AT(::Log::kDebug, debug, __VA_ARGS__)
+#define LOG_INFO(...) VREDIT_LOG_AT(::Log::kInfo, info, __VA_ARGS__)
+#define LOG_WARN(...) VREDIT_LOG_AT(::Log::kWarn, warn, __VA_ARGS__)
+#define LOG_ERROR(...) VREDIT_LOG_AT(::Log::kError, error, __VA_ARGS__)
+
 #if !defined(TEST_ENVIRONMENT)
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 
+namespace Log {
+    // Messages buffered between the game threads and the file writer thread.
+    // When full the oldest message is dropped - logging never blocks the caller.
+    inline constexpr size_t kAsyncQueueSize = 8192;
+
+    // Set the runtime level (clamped to trace..off); also applied to spdlog itself
+    // so plain spdlog:: calls follow the same threshold
+    inline void SetLevel(int level)
+    {
+        level = std::clamp(level, static_cast<int>(kTrace), static_cast<int>(kOff));
+        g_runtimeLevel.store(level, std::memory_order_relaxed);
+        spdlog::set_level(static_cast<spdlog::level::level_enum>(level));
+    }
+}
+
 inline void SetupLog() {
     auto logsFolder = SKSE::log::log_directory();
     if (!logsFolder) SKSE::stl::report_and_fail("SKSE log_directory not provided, logs disabled.");
     auto pluginName = SKSE::PluginDeclaration::GetSingleton()->GetName();
     auto logFilePath = *logsFolder / std::format("{}.log", pluginName);
     auto fileLoggerPtr = std::make_shared<spdlog::sinks::basic_file_sink_mt>(logFilePath.string(), true);
-    auto loggerPtr = std::make_shared<spdlog::logger>("log", std::move(fileLoggerPtr));
+
+    // File I/O happens on a single spdlog worker thread
+    spdlog::init_thread_pool(Log::kAsyncQueueSize, 1);
+    auto loggerPtr = std::make_shared<spdlog::async_logger>("log", std::move(fileLoggerPtr), spdlog::thread_pool(),
+        spdlog::async_overflow_policy::overrun_oldest);
     spdlog::set_default_logger(std::move(loggerPtr));
-    spdlog::set_level(spdlog::level::trace);
-    spdlog::flush_on(spdlog::level::trace);
+    Log::SetLevel(Log::kTrace);
+
+    // Flushes run on the worker thread too - warnings and errors reach disk promptly
+    // (crash diagnosis), everything else within a second
+    spdlog::flush_on(spdlog::level::warn);
+    spdlog::flush_every(std::chrono::seconds(1));
 }
 #else
 // Test environment - logging is stubbed in TestStubs.h
+namespace Log {
+    inline void SetLevel(int level)
+    {
+        g_runtimeLevel.store(std::clamp(level, static_cast<int>(kTrace), static_cast<int>(kOff)),
+            std::memory_order_relaxed);
+    }
+}
+
 inline void SetupLog() {}
 #endif
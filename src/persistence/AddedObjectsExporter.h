@@ -16,7 +16,10 @@ namespace Persistence {
 //
 // Integration:
 // - SaveGameDataManager::OnSave() calls ExportPendingCreatedObjects()
-// - ChangedObjectRegistry tracks which objects have wasCreated=true
+// - CellExportWriter calls ExportEntries() from its writer thread for cells the
+//   player has left (bExportOnCellLeave)
+// - ChangedObjectRegistry tracks which objects have wasCreated=true and captures
+//   their export state at edit time; ExportBuilder turns that into entries
 //
 // File Format:
 // - One INI file per cell: VREditor_{CellIdentifier}_AddedObjects.ini
@@ -39,27 +42,11 @@ public:
     // Returns number of entries exported
     size_t ExportEntries(const std::vector<std::pair<std::string, const ChangedObjectRuntimeData*>>& entries);
 
-    // Convert a reference to an AddedObjectEntry
-    // Handles rotation extraction and metadata population
-    static AddedObjectEntry ReferenceToEntry(RE::TESObjectREFR* ref, RE::FormID baseFormId);
-
-    // Convert a stored NiTransform to an AddedObjectEntry
-    // Used when reference is not loaded (cell unloaded)
-    static AddedObjectEntry TransformToEntry(const RE::NiTransform& transform, const std::string& baseFormKey);
-
-    // Populate metadata fields for an entry by looking up the base form
-    static void PopulateEntryMetadata(AddedObjectEntry& entry);
-
 private:
     AddedObjectsExporter() = default;
     ~AddedObjectsExporter() = default;
     AddedObjectsExporter(const AddedObjectsExporter&) = delete;
     AddedObjectsExporter& operator=(const AddedObjectsExporter&) = delete;
-
-    // Group entries by cell FormKey
-    // Returns map of cellFormKey -> (cellEditorId, vector of entries)
-    std::unordered_map<std::string, std::pair<std::string, std::vector<AddedObjectEntry>>>
-    GroupEntriesByCell(const std::vector<std::pair<std::string, const ChangedObjectRuntimeData*>>& entries);
 };
 
 } // namespace Persistence
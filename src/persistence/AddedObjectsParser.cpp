@@ -1,14 +1,17 @@
 #include "AddedObjectsParser.h"
 #include "FormKeyUtil.h"
+#include "IniLineFormat.h"
 #include "../log.h"
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/T/TESDataHandler.h>
 #include <RE/T/TESForm.h>
 #include <RE/T/TESModel.h>
+#endif
+#include <format>
 #include <fstream>
 #include <sstream>
 #include <regex>
 #include <algorithm>
-#include <iomanip>
 #include <cmath>
 
 #ifdef _WIN32
@@ -23,37 +26,40 @@ namespace Persistence {
 
 std::string AddedObjectEntry::ToIniLine() const
 {
-    std::ostringstream ss;
+    std::string line;
+    AppendIniLine(line);
+    return line;
+}
 
+void AddedObjectEntry::AppendIniLine(std::string& out) const
+{
     // Format: baseForm|posA(x,y,z),rotA(rx,ry,rz),scaleA(s)
-    ss << baseFormString << "|";
-
-    // Position
-    ss << "posA(" << AddedObjectsParser::FormatFloat(position.x) << ","
-       << AddedObjectsParser::FormatFloat(position.y) << ","
-       << AddedObjectsParser::FormatFloat(position.z) << ")";
-
-    // Rotation
-    ss << ",rotA(" << AddedObjectsParser::FormatFloat(rotation.x) << ","
-       << AddedObjectsParser::FormatFloat(rotation.y) << ","
-       << AddedObjectsParser::FormatFloat(rotation.z) << ")";
-
-    // Scale (only if not 1.0)
-    if (std::abs(scale - 1.0f) > 0.0001f) {
-        ss << ",scaleA(" << AddedObjectsParser::FormatFloat(scale) << ")";
-    }
-
-    return ss.str();
+    IniLineFormat::AppendAddedObjectLine(out, baseFormString, position, rotation, scale);
 }
 
 std::string AddedObjectEntry::ToCommentLine() const
+{
+    std::string line;
+    AppendCommentLine(line);
+    return line;
+}
+
+void AddedObjectEntry::AppendCommentLine(std::string& out) const
 {
     // Use unified pipe-separated format: ; EditorId|DisplayName|MeshPath
-    EntryMetadata metadata;
-    metadata.editorId = editorId;
-    metadata.displayName = displayName;
-    metadata.meshName = meshName;
-    return metadata.ToCommentLine();
+    // The form type is not written for entries (only the three metadata fields)
+    IniLineFormat::AppendCommentLine(out, editorId, displayName, meshName, {});
+}
+
+namespace {
+    // Comment line, entry line and the blank separator line of one entry
+    void AppendEntryBlock(std::string& out, const AddedObjectEntry& entry)
+    {
+        entry.AppendCommentLine(out);
+        out += '\n';
+        entry.AppendIniLine(out);
+        out += "\n\n";
+    }
 }
 
 void AddedObjectEntry::ApplyMetadataFromComment(std::string_view commentLine)
@@ -293,7 +299,7 @@ bool AddedObjectsParser::WriteIniFile(const std::filesystem::path& filePath,
 
     // Use position as unique key for deduplication
     auto positionKey = [](const AddedObjectEntry& e) {
-        return fmt::format("{:.2f},{:.2f},{:.2f}", e.position.x, e.position.y, e.position.z);
+        return std::format("{:.2f},{:.2f},{:.2f}", e.position.x, e.position.y, e.position.z);
     };
 
     std::unordered_map<std::string, size_t> positionToIndex;
@@ -361,11 +367,13 @@ bool AddedObjectsParser::WriteIniFile(const std::filesystem::path& filePath,
         file << "; Added objects (" << mergedEntries.size() << " entries)\n";
         file << "\n";
 
+        // One buffer for all entries - no per-line temporaries
+        std::string buffer;
         for (const auto& entry : mergedEntries) {
             // Always write comment line for consistency (enables metadata preservation on merge)
-            file << entry.ToCommentLine() << "\n";
-            file << entry.ToIniLine() << "\n";
-            file << "\n";
+            buffer.clear();
+            AppendEntryBlock(buffer, entry);
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
         }
 
         // Ensure all data is flushed to disk
@@ -487,6 +495,7 @@ bool AddedObjectsParser::WriteConsolidatedIniFile(
         file << "\n";
 
         size_t totalEntries = 0;
+        std::string buffer;  // Reused for every entry
 
         // Write each cell section
         for (const auto& section : cellSections) {
@@ -501,9 +510,9 @@ bool AddedObjectsParser::WriteConsolidatedIniFile(
 
             // Write entries for this cell
             for (const auto& entry : section.entries) {
-                file << entry.ToCommentLine() << "\n";
-                file << entry.ToIniLine() << "\n";
-                file << "\n";
+                buffer.clear();
+                AppendEntryBlock(buffer, entry);
+                file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
             }
 
             totalEntries += section.entries.size();
@@ -567,12 +576,17 @@ bool AddedObjectsParser::WriteConsolidatedIniFile(
 
 std::filesystem::path AddedObjectsParser::GetVREditorFolderPath() const
 {
+#ifdef _WIN32
     // Get path relative to Skyrim's Data/VREditor folder
     wchar_t exePath[MAX_PATH];
     GetModuleFileNameW(nullptr, exePath, MAX_PATH);
 
     std::filesystem::path skyrimPath(exePath);
     skyrimPath = skyrimPath.parent_path();  // Remove executable name
+#else
+    // Headless builds (tests, tools) have no game executable
+    std::filesystem::path skyrimPath = std::filesystem::current_path();
+#endif
 
     auto vrEditorPath = skyrimPath / "Data" / "SKSE" / "Plugins" / "VREditor";
 
@@ -721,22 +735,7 @@ bool AddedObjectsParser::ParsePropertyString(std::string_view props, AddedObject
 std::string AddedObjectsParser::FormatFloat(float value)
 {
     // Format with up to 4 decimal places, removing trailing zeros
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(4) << value;
-    std::string result = ss.str();
-
-    // Remove trailing zeros after decimal point
-    size_t dotPos = result.find('.');
-    if (dotPos != std::string::npos) {
-        size_t lastNonZero = result.find_last_not_of('0');
-        if (lastNonZero > dotPos) {
-            result.erase(lastNonZero + 1);
-        } else {
-            result.erase(dotPos);  // Remove decimal point too if no decimals
-        }
-    }
-
-    return result;
+    return IniLineFormat::FormatFloat(value);
 }
 
 RE::TESForm* AddedObjectsParser::ResolveBaseForm(const std::string& baseFormString)
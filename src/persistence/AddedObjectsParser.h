@@ -1,7 +1,11 @@
 #pragma once
 
 #include "EntryMetadata.h"
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/N/NiTransform.h>
+#else
+#include "TestStubs.h"
+#endif
 #include <string>
 #include <vector>
 #include <optional>
@@ -22,18 +26,24 @@ struct AddedObjectEntry {
 
     // Metadata for comments (not serialized to INI line itself)
     // Uses shared EntryMetadata format for parsing/generation
-    std::string editorId;            // Editor ID of the base object
-    std::string displayName;         // Display name if available
-    std::string meshName;            // Mesh/model name
-    std::string formTypeName;        // Form type code (e.g., "LIGH", "STAT") - fallback when other metadata unavailable
+    InternedString editorId;         // Editor ID of the base object
+    InternedString displayName;      // Display name if available
+    InternedString meshName;         // Mesh/model name
+    InternedString formTypeName;     // Form type code (e.g., "LIGH", "STAT") - fallback when other metadata unavailable
 
     // Convert to INI line format
     std::string ToIniLine() const;
 
+    // Append the INI line to out (writers reuse one buffer for all entries)
+    void AppendIniLine(std::string& out) const;
+
     // Generate a comment line describing this entry
     // Uses unified pipe-separated format: ; EditorId|DisplayName|MeshPath
     std::string ToCommentLine() const;
 
+    // Append the comment line to out
+    void AppendCommentLine(std::string& out) const;
+
     // Parse from INI line (returns nullopt if invalid)
     static std::optional<AddedObjectEntry> FromIniLine(std::string_view line);
 
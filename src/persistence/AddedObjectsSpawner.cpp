@@ -1,6 +1,8 @@
 #include "AddedObjectsSpawner.h"
+#include "CellBinaryConverter.h"
 #include "CreatedObjectTracker.h"
 #include "FormKeyUtil.h"
+#include "../util/JobSystem.h"
 #include "../log.h"
 #include <RE/T/TESDataHandler.h>
 #include <RE/T/TESBoundObject.h>
@@ -11,6 +13,25 @@ namespace Persistence {
 
 namespace {
     constexpr float DEG_TO_RAD = 3.14159265358979323846f / 180.0f;
+
+    // Read a cell's .vrcb sibling when it is at least as new as the INI,
+    // otherwise (missing, stale after a hand edit, or damaged) parse the INI
+    AddedObjectsFileData LoadCellFile(const std::filesystem::path& iniPath)
+    {
+        const auto binaryPath = CellBinary::GetBinaryPath(iniPath);
+
+        std::error_code ec;
+        const auto binaryTime = std::filesystem::last_write_time(binaryPath, ec);
+        if (!ec && binaryTime >= std::filesystem::last_write_time(iniPath, ec) && !ec) {
+            std::string error;
+            if (auto data = CellBinary::ReadAddedObjects(binaryPath, &error)) {
+                return std::move(*data);
+            }
+            spdlog::warn("AddedObjectsSpawner: Ignoring {}: {}", binaryPath.filename().string(), error);
+        }
+
+        return AddedObjectsParser::GetSingleton()->ParseIniFile(iniPath);
+    }
 }
 
 AddedObjectsSpawner* AddedObjectsSpawner::GetSingleton()
@@ -37,11 +58,20 @@ void AddedObjectsSpawner::Initialize()
         return;
     }
 
+    // Files are independent - parse them on the job workers, index them here in order
+    std::vector<AddedObjectsFileData> loaded(iniFiles.size());
+    Util::JobSystem::GetSingleton()->ParallelFor(iniFiles.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            loaded[i] = LoadCellFile(iniFiles[i]);
+        }
+    });
+
     std::unique_lock lock(m_mutex);
 
     size_t totalEntries = 0;
-    for (const auto& filePath : iniFiles) {
-        auto fileData = parser->ParseIniFile(filePath);
+    for (size_t i = 0; i < iniFiles.size(); ++i) {
+        const auto& filePath = iniFiles[i];
+        auto& fileData = loaded[i];
 
         if (fileData.cellFormKey.empty()) {
             spdlog::warn("AddedObjectsSpawner: Could not determine cell FormKey for {}", filePath.string());
@@ -54,12 +84,14 @@ void AddedObjectsSpawner::Initialize()
         }
 
         // Index by cell FormKey
-        m_filesByCell[fileData.cellFormKey] = std::move(fileData);
-        totalEntries += m_filesByCell[fileData.cellFormKey].entries.size();
+        const size_t entryCount = fileData.entries.size();
+        const std::string cellFormKey = fileData.cellFormKey;
+        m_filesByCell[cellFormKey] = std::move(fileData);
+        totalEntries += entryCount;
 
         spdlog::info("AddedObjectsSpawner: Loaded {} entries for cell {} from {}",
-            m_filesByCell[fileData.cellFormKey].entries.size(),
-            fileData.cellFormKey,
+            entryCount,
+            cellFormKey,
             filePath.filename().string());
     }
 
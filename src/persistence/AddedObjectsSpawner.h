@@ -15,7 +15,8 @@ namespace Persistence {
 // Important: This is currently UNUSED! Added Items are automatically persistet in the save.  
 //
 // Purpose:
-// - Load and cache all _AddedObjects.ini files on startup
+// - Load and cache all _AddedObjects.ini files on startup (from the cell's .vrcb
+//   file instead when it is up to date - see CellBinaryConverter.h)
 // - Listen for cell enter events
 // - Spawn objects from INI files when player enters a cell
 // - Track which objects have been spawned this session (to prevent duplicates)
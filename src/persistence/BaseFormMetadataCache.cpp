@@ -0,0 +1,125 @@
+#include "BaseFormMetadataCache.h"
+#include "../log.h"
+#if !defined(TEST_ENVIRONMENT)
+#include <RE/T/TESModel.h>
+#endif
+#include <mutex>
+
+namespace Persistence {
+
+BaseFormMetadataCache* BaseFormMetadataCache::GetSingleton()
+{
+    static BaseFormMetadataCache instance;
+    return &instance;
+}
+
+EntryMetadata BaseFormMetadataCache::Get(RE::TESForm* baseForm)
+{
+    if (!baseForm) {
+        return {};
+    }
+
+    const RE::FormID formId = baseForm->GetFormID();
+    if (IsDynamicForm(formId)) {
+        return ReadFromForm(baseForm);
+    }
+
+    if (auto cached = Find(formId)) {
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return *cached;
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    EntryMetadata metadata = ReadFromForm(baseForm);
+    {
+        std::unique_lock lock(m_mutex);
+        m_entries.try_emplace(formId, metadata);
+    }
+    return metadata;
+}
+
+EntryMetadata BaseFormMetadataCache::GetForReference(RE::TESObjectREFR* ref)
+{
+    if (!ref) {
+        return {};
+    }
+
+    EntryMetadata metadata = Get(ref->GetBaseObject());
+
+    // The reference's own editor ID wins over the base object's
+    const char* editorId = ref->GetFormEditorID();
+    if (editorId && editorId[0] != '\0') {
+        metadata.editorId = editorId;
+    }
+
+    // Get the display name (respects ExtraTextDisplayData, so per reference)
+    const char* displayName = ref->GetDisplayFullName();
+    if (displayName && displayName[0] != '\0') {
+        metadata.displayName = displayName;
+    }
+
+    return metadata;
+}
+
+std::optional<EntryMetadata> BaseFormMetadataCache::Find(RE::FormID baseFormId) const
+{
+    std::shared_lock lock(m_mutex);
+    if (auto it = m_entries.find(baseFormId); it != m_entries.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+void BaseFormMetadataCache::Invalidate()
+{
+    std::unique_lock lock(m_mutex);
+    if (!m_entries.empty()) {
+        LOG_DEBUG("BaseFormMetadataCache: Dropping {} cached base forms ({} hits, {} misses)",
+            m_entries.size(), GetHitCount(), GetMissCount());
+    }
+    m_entries.clear();
+    m_hits.store(0, std::memory_order_relaxed);
+    m_misses.store(0, std::memory_order_relaxed);
+}
+
+EntryMetadata BaseFormMetadataCache::ReadFromForm(RE::TESForm* baseForm)
+{
+    EntryMetadata metadata;
+    if (!baseForm) {
+        return metadata;
+    }
+
+    // Get editor ID
+    const char* editorId = baseForm->GetFormEditorID();
+    if (editorId && editorId[0] != '\0') {
+        metadata.editorId = editorId;
+    }
+
+    // Get display name
+    const char* fullName = baseForm->GetName();
+    if (fullName && fullName[0] != '\0') {
+        metadata.displayName = fullName;
+    }
+
+    // Get mesh name from model
+    auto* model = baseForm->As<RE::TESModel>();
+    if (model) {
+        const char* modelPath = model->GetModel();
+        if (modelPath && modelPath[0] != '\0') {
+            metadata.meshName = modelPath;
+        }
+    }
+
+    // Get form type as fallback identifier (useful for LIGH, etc. that don't have meshes)
+    metadata.formTypeName = RE::FormTypeToString(baseForm->GetFormType());
+
+    return metadata;
+}
+
+size_t BaseFormMetadataCache::GetSize() const
+{
+    std::shared_lock lock(m_mutex);
+    return m_entries.size();
+}
+
+} // namespace Persistence
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "EntryMetadata.h"
+
+#if !defined(TEST_ENVIRONMENT)
+#include <RE/T/TESObjectREFR.h>
+#else
+#include "TestStubs.h"
+#endif
+#include <atomic>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Persistence {
+
+// BaseFormMetadataCache: base FormID -> comment metadata for the INI exporters
+//
+// Problem: Every save rebuilt the comment metadata of every exported entry from
+// the game (editor ID, full name, TESModel path, form type), although a cell's
+// worth of entries usually shares a handful of base objects.
+//
+// Solution: Metadata is read from a base form the first time it is needed and
+// kept by FormID. Fields are InternedStrings, so a cached copy is four views.
+//
+// Lifetime:
+// - Invalidate() is called when the load order is set up (kDataLoaded) and on
+//   game load / new game: the load order decides what a FormID refers to, and
+//   a save can restore base form names changed by scripts.
+// - Dynamic base forms (0xFF load-order index) belong to one save and are
+//   never cached.
+//
+// Threading: Get() reads the form and must run on the main thread. Find() only
+// reads the cache, so entries can be formatted on a worker once the main thread
+// has warmed the cache for their base forms.
+//
+class BaseFormMetadataCache
+{
+public:
+    static BaseFormMetadataCache* GetSingleton();
+
+    // Metadata for a base form, read from the game on first use (main thread)
+    EntryMetadata Get(RE::TESForm* baseForm);
+
+    // Metadata describing a reference: its base object's cached fields, with the
+    // reference's own editor ID and display name (ExtraTextDisplayData) on top
+    EntryMetadata GetForReference(RE::TESObjectREFR* ref);
+
+    // Cached metadata only - never touches the form; safe from any thread
+    std::optional<EntryMetadata> Find(RE::FormID baseFormId) const;
+
+    // Drop all cached metadata
+    void Invalidate();
+
+    // Read metadata straight from a form, bypassing the cache
+    static EntryMetadata ReadFromForm(RE::TESForm* baseForm);
+
+    size_t GetSize() const;
+    size_t GetHitCount() const { return m_hits.load(std::memory_order_relaxed); }
+    size_t GetMissCount() const { return m_misses.load(std::memory_order_relaxed); }
+
+private:
+    BaseFormMetadataCache() = default;
+    ~BaseFormMetadataCache() = default;
+    BaseFormMetadataCache(const BaseFormMetadataCache&) = delete;
+    BaseFormMetadataCache& operator=(const BaseFormMetadataCache&) = delete;
+
+    static bool IsDynamicForm(RE::FormID formId) { return (formId >> 24) == 0xFF; }
+
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<RE::FormID, EntryMetadata> m_entries;
+    std::atomic<size_t> m_hits{ 0 };
+    std::atomic<size_t> m_misses{ 0 };
+};
+
+} // namespace Persistence
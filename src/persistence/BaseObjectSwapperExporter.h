@@ -23,7 +23,10 @@ namespace Persistence {
 //
 // Integration:
 // - SaveGameDataManager::OnSave() calls ExportPendingChanges()
-// - ChangedObjectRegistry tracks which objects have pending changes
+// - CellExportWriter calls ExportEntries() from its writer thread for cells the
+//   player has left (bExportOnCellLeave)
+// - ChangedObjectRegistry tracks which objects have pending changes and captures
+//   their export state at edit time; ExportBuilder turns that into entries
 // - Plugin initialization must call BaseObjectSwapperParser::ApplyPendingSessionFiles()
 //   BEFORE BOS loads (use SKSEMessagingInterface kDataLoaded or earlier)
 //
@@ -41,35 +44,11 @@ public:
     // Returns number of entries exported
     size_t ExportEntries(const std::vector<std::pair<std::string, const ChangedObjectRuntimeData*>>& entries);
 
-    // Convert NiTransform to BOS format entry
-    // Handles rotation matrix to Euler angles conversion
-    // Also populates metadata (editorId, displayName, pluginName) from the reference
-    static BOSTransformEntry TransformToBOSEntry(const std::string& formKey,
-                                                   const RE::NiTransform& transform,
-                                                   bool isDeleted = false);
-
-    // Populate metadata fields for an entry by looking up the reference
-    static void PopulateEntryMetadata(BOSTransformEntry& entry);
-
-    // Convert NiMatrix3 rotation to Euler angles (degrees)
-    // Returns (pitch, yaw, roll) in degrees, normalized to -180 to +180 range
-    static RE::NiPoint3 MatrixToEulerDegrees(const RE::NiMatrix3& matrix);
-
-    // Normalize angle to -180 to +180 degree range
-    // Ensures angles stay within BOS's ±360° clamp range
-    static float NormalizeAngleDegrees(float angle);
-    static RE::NiPoint3 NormalizeAnglesDegrees(const RE::NiPoint3& angles);
-
 private:
     BaseObjectSwapperExporter() = default;
     ~BaseObjectSwapperExporter() = default;
     BaseObjectSwapperExporter(const BaseObjectSwapperExporter&) = delete;
     BaseObjectSwapperExporter& operator=(const BaseObjectSwapperExporter&) = delete;
-
-    // Group entries by cell FormKey
-    // Returns map of cellFormKey -> (cellEditorId, entries)
-    std::unordered_map<std::string, std::pair<std::string, std::vector<BOSTransformEntry>>>
-    GroupEntriesByCell(const std::vector<std::pair<std::string, const ChangedObjectRuntimeData*>>& entries);
 };
 
 } // namespace Persistence
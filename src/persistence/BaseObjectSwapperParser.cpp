@@ -1,10 +1,10 @@
 #include "BaseObjectSwapperParser.h"
+#include "IniLineFormat.h"
 #include "../log.h"
 #include <fstream>
 #include <sstream>
 #include <regex>
 #include <algorithm>
-#include <iomanip>
 #include <cmath>
 #include <stdexcept>
 #include <set>
@@ -17,47 +17,52 @@ namespace Persistence {
 
 std::string BOSTransformEntry::ToIniLine() const
 {
-    std::ostringstream ss;
+    std::string line;
+    AppendIniLine(line);
+    return line;
+}
 
+void BOSTransformEntry::AppendIniLine(std::string& out) const
+{
     // Format: formKey|posA(x,y,z),rotA(rx,ry,rz),scaleA(s),flags(0x...)|100
-    ss << formKeyString << "|";
-
-    // Position
-    ss << "posA(" << BaseObjectSwapperParser::FormatFloat(position.x) << ","
-       << BaseObjectSwapperParser::FormatFloat(position.y) << ","
-       << BaseObjectSwapperParser::FormatFloat(position.z) << ")";
-
-    // Rotation
-    ss << ",rotA(" << BaseObjectSwapperParser::FormatFloat(rotation.x) << ","
-       << BaseObjectSwapperParser::FormatFloat(rotation.y) << ","
-       << BaseObjectSwapperParser::FormatFloat(rotation.z) << ")";
-
-    // Scale (only if not 1.0)
-    if (std::abs(scale - 1.0f) > 0.0001f) {
-        ss << ",scaleA(" << BaseObjectSwapperParser::FormatFloat(scale) << ")";
-    }
-
     // Initially Disabled flag for deleted references
     // When undeleting, we remove flags() entirely (no need for flagsC to clear)
-    if (isDeleted) {
-        ss << ",flags(0x" << std::hex << std::setfill('0') << std::setw(8)
-           << INITIALLY_DISABLED_FLAG << ")";
-    }
-
-    // Chance is always 100
-    ss << "|100";
-
-    return ss.str();
+    IniLineFormat::AppendSwapLine(out, formKeyString, position, rotation, scale,
+        isDeleted ? INITIALLY_DISABLED_FLAG : 0);
 }
 
 std::string BOSTransformEntry::ToCommentLine() const
+{
+    std::string line;
+    AppendCommentLine(line);
+    return line;
+}
+
+void BOSTransformEntry::AppendCommentLine(std::string& out) const
 {
     // Use unified pipe-separated format: ; EditorId|DisplayName|MeshPath
-    EntryMetadata metadata;
-    metadata.editorId = editorId;
-    metadata.displayName = displayName;
-    metadata.meshName = meshName;
-    return metadata.ToCommentLine();
+    // The form type is not written for entries (only the three metadata fields)
+    IniLineFormat::AppendCommentLine(out, editorId, displayName, meshName, {});
+}
+
+namespace {
+    // Comment line, entry line and the blank separator line of one entry
+    void AppendEntryBlock(std::string& out, const BOSTransformEntry& entry)
+    {
+        entry.AppendCommentLine(out);
+        out += '\n';
+        entry.AppendIniLine(out);
+        out += "\n\n";
+    }
+
+    void WriteEntries(std::ostream& out, const std::vector<const BOSTransformEntry*>& entries, std::string& buffer)
+    {
+        for (const auto* entry : entries) {
+            buffer.clear();
+            AppendEntryBlock(buffer, *entry);
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+    }
 }
 
 void BOSTransformEntry::ApplyMetadataFromComment(std::string_view commentLine)
@@ -347,12 +352,10 @@ bool BaseObjectSwapperParser::WriteIniFile(const std::filesystem::path& filePath
     file << "; Repositioned objects (" << movedEntries.size() << " entries)\n";
     file << "\n";
 
-    for (const auto* entry : movedEntries) {
-        // Always write comment line for consistency (enables metadata preservation on merge)
-        file << entry->ToCommentLine() << "\n";
-        file << entry->ToIniLine() << "\n";
-        file << "\n";
-    }
+    // Always write comment line for consistency (enables metadata preservation on merge)
+    // One buffer for all entries - no per-line temporaries
+    std::string buffer;
+    WriteEntries(file, movedEntries, buffer);
 
     // Write deleted entries section if any
     if (!deletedEntries.empty()) {
@@ -363,12 +366,7 @@ bool BaseObjectSwapperParser::WriteIniFile(const std::filesystem::path& filePath
         file << "; ============================================================\n";
         file << "\n";
 
-        for (const auto* entry : deletedEntries) {
-            // Always write comment line for consistency (enables metadata preservation on merge)
-            file << entry->ToCommentLine() << "\n";
-            file << entry->ToIniLine() << "\n";
-            file << "\n";
-        }
+        WriteEntries(file, deletedEntries, buffer);
     }
 
     // Ensure all data is flushed to disk
@@ -426,20 +424,13 @@ void BaseObjectSwapperParser::WriteCellSection(std::ostream& out,
     out << "\n";
 
     // Write moved entries
-    for (const auto* entry : movedEntries) {
-        out << entry->ToCommentLine() << "\n";
-        out << entry->ToIniLine() << "\n";
-        out << "\n";
-    }
+    std::string buffer;
+    WriteEntries(out, movedEntries, buffer);
 
     // Write deleted entries
     if (!deletedEntries.empty()) {
         out << "; --- Deleted References (" << deletedEntries.size() << ") ---\n";
-        for (const auto* entry : deletedEntries) {
-            out << entry->ToCommentLine() << "\n";
-            out << entry->ToIniLine() << "\n";
-            out << "\n";
-        }
+        WriteEntries(out, deletedEntries, buffer);
     }
 }
 
@@ -461,7 +452,7 @@ bool BaseObjectSwapperParser::WriteConsolidatedIniFile(
         // Note: In consolidated mode, we need to parse cell info from comments
         // For now, existing entries go to a "Unknown" cell if we can't determine
         for (auto& entry : existingEntries) {
-            existingEntriesByCell[""][""][entry.formKeyString] = std::move(entry);
+            existingEntriesByCell[""][entry.formKeyString] = std::move(entry);
         }
     } else if (std::filesystem::exists(filePath)) {
         auto existingEntries = ParseIniFile(filePath);
@@ -573,6 +564,7 @@ bool BaseObjectSwapperParser::WriteConsolidatedIniFile(
 
 std::filesystem::path BaseObjectSwapperParser::GetDataFolderPath() const
 {
+#ifdef _WIN32
     // Get path relative to Skyrim's Data folder
     // SKSE provides this through various means, but we can construct it
     // from the executable path
@@ -583,6 +575,10 @@ std::filesystem::path BaseObjectSwapperParser::GetDataFolderPath() const
     skyrimPath = skyrimPath.parent_path();  // Remove executable name
 
     return skyrimPath / "Data";
+#else
+    // Headless builds (tests, benchmarks) have no game executable
+    return std::filesystem::current_path() / "Data";
+#endif
 }
 
 std::filesystem::path BaseObjectSwapperParser::GetVREditorFolderPath() const
@@ -832,22 +828,7 @@ bool BaseObjectSwapperParser::ParsePropertyString(std::string_view props, BOSTra
 std::string BaseObjectSwapperParser::FormatFloat(float value)
 {
     // Format with up to 4 decimal places, removing trailing zeros
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(4) << value;
-    std::string result = ss.str();
-
-    // Remove trailing zeros after decimal point
-    size_t dotPos = result.find('.');
-    if (dotPos != std::string::npos) {
-        size_t lastNonZero = result.find_last_not_of('0');
-        if (lastNonZero > dotPos) {
-            result.erase(lastNonZero + 1);
-        } else {
-            result.erase(dotPos);  // Remove decimal point too if no decimals
-        }
-    }
-
-    return result;
+    return IniLineFormat::FormatFloat(value);
 }
 
 } // namespace Persistence
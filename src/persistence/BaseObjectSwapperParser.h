@@ -1,7 +1,11 @@
 #pragma once
 
 #include "EntryMetadata.h"
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/N/NiTransform.h>
+#else
+#include "TestStubs.h"
+#endif
 #include <string>
 #include <vector>
 #include <optional>
@@ -28,19 +32,25 @@ struct BOSTransformEntry {
 
     // Metadata for comments (not serialized to INI line itself)
     // Uses shared EntryMetadata format for parsing/generation
-    std::string editorId;            // Editor ID of the reference (e.g., "WhiterunDragonStatue01")
-    std::string displayName;         // Display name if available (e.g., "Dragon Statue")
-    std::string meshName;            // Mesh/model name (e.g., "architecture/whiterun/wrdragonstatue01.nif")
-    std::string formTypeName;        // Form type code (e.g., "LIGH", "STAT") - fallback when other metadata unavailable
+    InternedString editorId;         // Editor ID of the reference (e.g., "WhiterunDragonStatue01")
+    InternedString displayName;      // Display name if available (e.g., "Dragon Statue")
+    InternedString meshName;         // Mesh/model name (e.g., "architecture/whiterun/wrdragonstatue01.nif")
+    InternedString formTypeName;     // Form type code (e.g., "LIGH", "STAT") - fallback when other metadata unavailable
     bool isDeleted = false;          // True if this is a "deleted" reference (uses Initially Disabled flag)
 
     // Convert to BOS INI line format
     std::string ToIniLine() const;
 
+    // Append the INI line to out (writers reuse one buffer for all entries)
+    void AppendIniLine(std::string& out) const;
+
     // Generate a comment line describing this entry
     // Uses unified pipe-separated format: ; EditorId|DisplayName|MeshPath
     std::string ToCommentLine() const;
 
+    // Append the comment line to out
+    void AppendCommentLine(std::string& out) const;
+
     // Parse from BOS INI line (returns nullopt if invalid)
     // Also extracts plugin name from formKeyString
     static std::optional<BOSTransformEntry> FromIniLine(std::string_view line);
@@ -0,0 +1,240 @@
+#include "CellBinaryConverter.h"
+#include "../util/MappedFile.h"
+#include "../log.h"
+#include <fstream>
+#include <set>
+
+namespace Persistence::CellBinary {
+
+namespace {
+    void Fail(std::string* error, std::string message)
+    {
+        if (error) {
+            *error = std::move(message);
+        }
+    }
+
+    bool WriteTransformsIni(const std::filesystem::path& iniPath, const View& view)
+    {
+        const auto entries = ToTransforms(view);
+
+        std::set<std::string> plugins;
+        std::vector<const BOSTransformEntry*> movedEntries;
+        std::vector<const BOSTransformEntry*> deletedEntries;
+        for (const auto& entry : entries) {
+            std::string plugin = entry.GetPluginName();
+            if (!plugin.empty()) {
+                plugins.insert(std::move(plugin));
+            }
+            (entry.isDeleted ? deletedEntries : movedEntries).push_back(&entry);
+        }
+
+        std::ofstream file(iniPath, std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        const std::string cellFormKey(view.GetCellFormKey());
+        std::string cellName(view.GetCellEditorId());
+        if (cellName.empty()) {
+            cellName = cellFormKey.empty() ? iniPath.stem().string() : cellFormKey;
+        }
+
+        BaseObjectSwapperParser::WriteFileHeader(file);
+        file << "[Transforms]\n";
+        file << "\n";
+        BaseObjectSwapperParser::WriteCellSection(file, cellName, cellFormKey, movedEntries, deletedEntries, plugins);
+
+        file.flush();
+        return !file.fail();
+    }
+}
+
+std::filesystem::path GetBinaryPath(const std::filesystem::path& iniPath)
+{
+    std::filesystem::path binaryPath = iniPath;
+    binaryPath.replace_extension(kFileExtension);
+    return binaryPath;
+}
+
+std::optional<FileKind> GetIniKind(const std::filesystem::path& iniPath)
+{
+    const std::string fileName = iniPath.filename().string();
+    if (fileName.ends_with("_AddedObjects.ini")) {
+        return FileKind::AddedObjects;
+    }
+    if (fileName.ends_with("_SWAP.ini") || fileName.ends_with("_SWAP_latest.ini")) {
+        return FileKind::Transforms;
+    }
+    return std::nullopt;
+}
+
+std::vector<std::byte> FromAddedObjects(const AddedObjectsFileData& data)
+{
+    Builder builder(FileKind::AddedObjects, data.cellFormKey, data.cellEditorId);
+    for (const auto& entry : data.entries) {
+        builder.AddRow(entry.baseFormString, entry.position, entry.rotation, entry.scale, 0, entry.GetMetadata());
+    }
+    return builder.Finish();
+}
+
+std::vector<std::byte> FromTransforms(const std::vector<BOSTransformEntry>& entries,
+                                      std::string_view cellFormKey,
+                                      std::string_view cellEditorId)
+{
+    Builder builder(FileKind::Transforms, cellFormKey, cellEditorId);
+    for (const auto& entry : entries) {
+        builder.AddRow(entry.formKeyString, entry.position, entry.rotation, entry.scale,
+                       entry.isDeleted ? kFlagDeleted : 0, entry.GetMetadata());
+    }
+    return builder.Finish();
+}
+
+AddedObjectsFileData ToAddedObjects(const View& view)
+{
+    AddedObjectsFileData data;
+    data.cellFormKey = view.GetCellFormKey();
+    data.cellEditorId = view.GetCellEditorId();
+    data.entries.resize(view.GetRowCount());
+
+    for (size_t row = 0; row < data.entries.size(); ++row) {
+        auto& entry = data.entries[row];
+        entry.baseFormString = view.GetFormKey(row);
+        entry.position = view.GetPosition(row);
+        entry.rotation = view.GetRotation(row);
+        entry.scale = view.GetScale(row);
+        entry.SetMetadata(view.GetMetadata(row));
+    }
+    return data;
+}
+
+std::vector<BOSTransformEntry> ToTransforms(const View& view)
+{
+    std::vector<BOSTransformEntry> entries(view.GetRowCount());
+    for (size_t row = 0; row < entries.size(); ++row) {
+        auto& entry = entries[row];
+        entry.formKeyString = view.GetFormKey(row);
+        entry.position = view.GetPosition(row);
+        entry.rotation = view.GetRotation(row);
+        entry.scale = view.GetScale(row);
+        entry.isDeleted = (view.GetFlags(row) & kFlagDeleted) != 0;
+        entry.SetMetadata(view.GetMetadata(row));
+    }
+    return entries;
+}
+
+std::optional<AddedObjectsFileData> ReadAddedObjects(const std::filesystem::path& binaryPath, std::string* error)
+{
+    Util::MappedFile file;
+    if (!file.Open(binaryPath)) {
+        Fail(error, "cannot open file");
+        return std::nullopt;
+    }
+
+    auto view = View::Open(file.GetBytes(), error);
+    if (!view) {
+        return std::nullopt;
+    }
+    if (view->GetKind() != FileKind::AddedObjects) {
+        Fail(error, "not an AddedObjects cell file");
+        return std::nullopt;
+    }
+
+    AddedObjectsFileData data = ToAddedObjects(*view);
+    data.iniFileName = std::filesystem::path(binaryPath).replace_extension(".ini").filename().string();
+    return data;
+}
+
+bool WriteBinaryFile(const std::filesystem::path& path, std::span<const std::byte> bytes)
+{
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            spdlog::error("CellBinary: Failed to create {}", tempPath.string());
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        file.flush();
+        if (file.fail()) {
+            spdlog::error("CellBinary: Failed to write {}", tempPath.string());
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        spdlog::error("CellBinary: Failed to replace {}: {}", path.string(), ec.message());
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+bool ConvertIniToBinary(const std::filesystem::path& iniPath, const std::filesystem::path& binaryPath,
+                        std::string* error)
+{
+    const auto kind = GetIniKind(iniPath);
+    if (!kind) {
+        Fail(error, "unknown INI file name (expected *_AddedObjects.ini or *_SWAP.ini)");
+        return false;
+    }
+    if (!std::filesystem::exists(iniPath)) {
+        Fail(error, "INI file not found");
+        return false;
+    }
+
+    std::vector<std::byte> bytes;
+    if (*kind == FileKind::AddedObjects) {
+        bytes = FromAddedObjects(AddedObjectsParser::GetSingleton()->ParseIniFile(iniPath));
+    } else {
+        bytes = FromTransforms(BaseObjectSwapperParser::GetSingleton()->ParseIniFile(iniPath));
+    }
+
+    if (!WriteBinaryFile(binaryPath, bytes)) {
+        Fail(error, "cannot write output file");
+        return false;
+    }
+    return true;
+}
+
+bool ConvertBinaryToIni(const std::filesystem::path& binaryPath, const std::filesystem::path& iniPath,
+                        std::string* error)
+{
+    Util::MappedFile file;
+    if (!file.Open(binaryPath)) {
+        Fail(error, "cannot open file");
+        return false;
+    }
+
+    auto view = View::Open(file.GetBytes(), error);
+    if (!view) {
+        return false;
+    }
+
+    // The INI writers merge into an existing file - start from scratch
+    std::error_code ec;
+    std::filesystem::remove(iniPath, ec);
+
+    bool written = false;
+    if (view->GetKind() == FileKind::AddedObjects) {
+        const AddedObjectsFileData data = ToAddedObjects(*view);
+        written = AddedObjectsParser::GetSingleton()->WriteIniFile(iniPath, data.cellFormKey, data.cellEditorId,
+                                                                   data.entries);
+    } else {
+        written = WriteTransformsIni(iniPath, *view);
+    }
+
+    if (!written) {
+        Fail(error, "cannot write output file");
+    }
+    return written;
+}
+
+} // namespace Persistence::CellBinary
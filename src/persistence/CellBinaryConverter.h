@@ -0,0 +1,60 @@
+#pragma once
+
+#include "AddedObjectsParser.h"
+#include "BaseObjectSwapperParser.h"
+#include "CellBinaryFormat.h"
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Persistence::CellBinary {
+
+// Conversion between the per-cell INI files and .vrcb files (CellBinaryFormat.h)
+//
+// The INI files stay the master copy and the interchange format. With
+// bWriteBinaryCells the AddedObjects exporter also writes a .vrcb next to each
+// cell's _AddedObjects.ini, and AddedObjectsSpawner loads that instead of parsing
+// the INI as long as it is not older than the INI (hand edits win). BOS keeps
+// reading _SWAP.ini; Transforms files only exist through the converter tool
+// (Tools/cell_convert.cpp), which is built on the same functions.
+
+inline constexpr std::string_view kFileExtension = ".vrcb";
+
+// "VREditor_X_AddedObjects.ini" -> "VREditor_X_AddedObjects.vrcb"
+std::filesystem::path GetBinaryPath(const std::filesystem::path& iniPath);
+
+// Kind of INI file from its name: *_AddedObjects.ini, or *_SWAP.ini / *_SWAP_latest.ini
+std::optional<FileKind> GetIniKind(const std::filesystem::path& iniPath);
+
+// ========== In memory ==========
+
+std::vector<std::byte> FromAddedObjects(const AddedObjectsFileData& data);
+
+// _SWAP.ini files do not record their cell; the cell fields are optional
+std::vector<std::byte> FromTransforms(const std::vector<BOSTransformEntry>& entries,
+                                      std::string_view cellFormKey = {},
+                                      std::string_view cellEditorId = {});
+
+AddedObjectsFileData ToAddedObjects(const View& view);
+std::vector<BOSTransformEntry> ToTransforms(const View& view);
+
+// ========== Files ==========
+
+// A cell's added objects from a memory-mapped .vrcb file
+// iniFileName is set to the INI sibling's name; nullopt if the file is unusable
+std::optional<AddedObjectsFileData> ReadAddedObjects(const std::filesystem::path& binaryPath,
+                                                     std::string* error = nullptr);
+
+// Write bytes to a temporary file, then rename it over path
+bool WriteBinaryFile(const std::filesystem::path& path, std::span<const std::byte> bytes);
+
+// Whole-file conversions; an existing output file is replaced
+bool ConvertIniToBinary(const std::filesystem::path& iniPath, const std::filesystem::path& binaryPath,
+                        std::string* error = nullptr);
+bool ConvertBinaryToIni(const std::filesystem::path& binaryPath, const std::filesystem::path& iniPath,
+                        std::string* error = nullptr);
+
+} // namespace Persistence::CellBinary
@@ -0,0 +1,257 @@
+#include "CellBinaryFormat.h"
+#include "FormKeyUtil.h"
+#include <bit>
+#include <cstring>
+
+namespace Persistence::CellBinary {
+
+static_assert(std::endian::native == std::endian::little, "Cell files are read in place as little-endian");
+
+namespace {
+    uint32_t FloatBits(float value)
+    {
+        return std::bit_cast<uint32_t>(value);
+    }
+
+    void Fail(std::string* error, const char* message)
+    {
+        if (error) {
+            *error = message;
+        }
+    }
+}
+
+// ============================================================================
+// Builder
+// ============================================================================
+
+Builder::Builder(FileKind kind, std::string_view cellFormKey, std::string_view cellEditorId) :
+    m_kind(kind)
+{
+    m_cellFormKey = AddString(cellFormKey);
+    m_cellEditorId = AddString(cellEditorId);
+}
+
+void Builder::AddRow(std::string_view formKey, const RE::NiPoint3& position, const RE::NiPoint3& rotation,
+                     float scale, uint32_t flags, const EntryMetadata& metadata)
+{
+    // Keys that would not come back byte-identical (e.g. "0x00abc~...") are kept as strings
+    uint32_t plugin = kEditorIdPlugin;
+    uint32_t formId = kNoString;
+    auto parsed = FormKeyUtil::ParseFormKey(formKey);
+    if (parsed && FormKeyUtil::BuildFormKey(parsed->localFormId, parsed->pluginName) == formKey) {
+        plugin = AddPlugin(parsed->pluginName);
+        formId = parsed->localFormId;
+    } else {
+        formId = AddString(formKey);
+    }
+
+    auto column = [this](Column c) -> std::vector<uint32_t>& { return m_columns[static_cast<size_t>(c)]; };
+    column(Column::FormPlugin).push_back(plugin);
+    column(Column::FormId).push_back(formId);
+    column(Column::PosX).push_back(FloatBits(position.x));
+    column(Column::PosY).push_back(FloatBits(position.y));
+    column(Column::PosZ).push_back(FloatBits(position.z));
+    column(Column::RotX).push_back(FloatBits(rotation.x));
+    column(Column::RotY).push_back(FloatBits(rotation.y));
+    column(Column::RotZ).push_back(FloatBits(rotation.z));
+    column(Column::Scale).push_back(FloatBits(scale));
+    column(Column::Flags).push_back(flags);
+    column(Column::EditorId).push_back(AddString(metadata.editorId));
+    column(Column::DisplayName).push_back(AddString(metadata.displayName));
+    column(Column::MeshName).push_back(AddString(metadata.meshName));
+    column(Column::FormTypeName).push_back(AddString(metadata.formTypeName));
+    m_rowCount++;
+}
+
+uint32_t Builder::AddString(std::string_view str)
+{
+    if (str.empty()) {
+        return kNoString;
+    }
+
+    auto [it, inserted] = m_stringOffsets.try_emplace(std::string(str), static_cast<uint32_t>(m_strings.size()));
+    if (inserted) {
+        m_strings.append(str);
+        m_strings.push_back('\0');
+    }
+    return it->second;
+}
+
+uint32_t Builder::AddPlugin(std::string_view pluginName)
+{
+    auto [it, inserted] = m_pluginIndex.try_emplace(std::string(pluginName), static_cast<uint32_t>(m_plugins.size()));
+    if (inserted) {
+        m_plugins.push_back(AddString(pluginName));
+    }
+    return it->second;
+}
+
+std::vector<std::byte> Builder::Finish() const
+{
+    // Pad the string table so the file size stays a multiple of 4
+    const size_t stringTableSize = (m_strings.size() + 3) & ~size_t(3);
+
+    FileHeader header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.kind = static_cast<uint32_t>(m_kind);
+    header.rowCount = static_cast<uint32_t>(m_rowCount);
+    header.pluginCount = static_cast<uint32_t>(m_plugins.size());
+    header.cellFormKey = m_cellFormKey;
+    header.cellEditorId = m_cellEditorId;
+    header.stringTableSize = static_cast<uint32_t>(stringTableSize);
+
+    const size_t columnBytes = m_rowCount * sizeof(uint32_t);
+    std::vector<std::byte> bytes(sizeof(FileHeader) + m_plugins.size() * sizeof(uint32_t) +
+                                 kColumnCount * columnBytes + stringTableSize);
+
+    std::byte* out = bytes.data();
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+
+    if (!m_plugins.empty()) {
+        std::memcpy(out, m_plugins.data(), m_plugins.size() * sizeof(uint32_t));
+        out += m_plugins.size() * sizeof(uint32_t);
+    }
+
+    for (const auto& column : m_columns) {
+        if (columnBytes > 0) {
+            std::memcpy(out, column.data(), columnBytes);
+            out += columnBytes;
+        }
+    }
+
+    // Remaining bytes are zero-initialized padding
+    if (!m_strings.empty()) {
+        std::memcpy(out, m_strings.data(), m_strings.size());
+    }
+
+    return bytes;
+}
+
+// ============================================================================
+// View
+// ============================================================================
+
+std::optional<View> View::Open(std::span<const std::byte> bytes, std::string* error)
+{
+    if (reinterpret_cast<uintptr_t>(bytes.data()) % alignof(uint32_t) != 0) {
+        Fail(error, "buffer is not 4-byte aligned");
+        return std::nullopt;
+    }
+    if (bytes.size() < sizeof(FileHeader)) {
+        Fail(error, "file is smaller than the header");
+        return std::nullopt;
+    }
+
+    View view;
+    std::memcpy(&view.m_header, bytes.data(), sizeof(FileHeader));
+    const FileHeader& header = view.m_header;
+
+    if (header.magic != kMagic) {
+        Fail(error, "not a cell binary file (bad magic)");
+        return std::nullopt;
+    }
+    if (header.version != kVersion) {
+        Fail(error, "unsupported version");
+        return std::nullopt;
+    }
+    if (header.kind != static_cast<uint32_t>(FileKind::AddedObjects) &&
+        header.kind != static_cast<uint32_t>(FileKind::Transforms)) {
+        Fail(error, "unknown file kind");
+        return std::nullopt;
+    }
+
+    // 64-bit sums - header counts come from the file and may be garbage
+    const uint64_t pluginBytes = uint64_t(header.pluginCount) * sizeof(uint32_t);
+    const uint64_t columnBytes = uint64_t(header.rowCount) * sizeof(uint32_t) * kColumnCount;
+    const uint64_t expectedSize = sizeof(FileHeader) + pluginBytes + columnBytes + header.stringTableSize;
+    if (expectedSize != bytes.size()) {
+        Fail(error, "file size does not match the header");
+        return std::nullopt;
+    }
+
+    const std::byte* base = bytes.data();
+    view.m_plugins = reinterpret_cast<const uint32_t*>(base + sizeof(FileHeader));
+    view.m_columns = base + sizeof(FileHeader) + pluginBytes;
+    view.m_strings = reinterpret_cast<const char*>(view.m_columns + columnBytes);
+
+    // Every offset inside the table then ends at a NUL within the table
+    if (header.stringTableSize > 0 && view.m_strings[header.stringTableSize - 1] != '\0') {
+        Fail(error, "string table is not NUL-terminated");
+        return std::nullopt;
+    }
+
+    return view;
+}
+
+const std::byte* View::ColumnData(Column column) const
+{
+    return m_columns + static_cast<size_t>(column) * m_header.rowCount * sizeof(uint32_t);
+}
+
+std::span<const uint32_t> View::GetUIntColumn(Column column) const
+{
+    return { reinterpret_cast<const uint32_t*>(ColumnData(column)), m_header.rowCount };
+}
+
+std::span<const float> View::GetFloatColumn(Column column) const
+{
+    return { reinterpret_cast<const float*>(ColumnData(column)), m_header.rowCount };
+}
+
+std::string_view View::GetString(uint32_t offset) const
+{
+    if (offset >= m_header.stringTableSize) {
+        return {};
+    }
+    return std::string_view(m_strings + offset);
+}
+
+std::string_view View::GetPluginName(uint32_t index) const
+{
+    if (index >= m_header.pluginCount) {
+        return {};
+    }
+    return GetString(m_plugins[index]);
+}
+
+std::string View::GetFormKey(size_t row) const
+{
+    const uint32_t plugin = GetUIntColumn(Column::FormPlugin)[row];
+    const uint32_t formId = GetUIntColumn(Column::FormId)[row];
+    if (plugin == kEditorIdPlugin) {
+        return std::string(GetString(formId));
+    }
+
+    const std::string_view pluginName = GetPluginName(plugin);
+    if (pluginName.empty()) {
+        return {};
+    }
+    return FormKeyUtil::BuildFormKey(formId, pluginName);
+}
+
+RE::NiPoint3 View::GetPosition(size_t row) const
+{
+    return RE::NiPoint3(GetFloatColumn(Column::PosX)[row], GetFloatColumn(Column::PosY)[row],
+                        GetFloatColumn(Column::PosZ)[row]);
+}
+
+RE::NiPoint3 View::GetRotation(size_t row) const
+{
+    return RE::NiPoint3(GetFloatColumn(Column::RotX)[row], GetFloatColumn(Column::RotY)[row],
+                        GetFloatColumn(Column::RotZ)[row]);
+}
+
+EntryMetadata View::GetMetadata(size_t row) const
+{
+    EntryMetadata metadata;
+    metadata.editorId = GetString(GetUIntColumn(Column::EditorId)[row]);
+    metadata.displayName = GetString(GetUIntColumn(Column::DisplayName)[row]);
+    metadata.meshName = GetString(GetUIntColumn(Column::MeshName)[row]);
+    metadata.formTypeName = GetString(GetUIntColumn(Column::FormTypeName)[row]);
+    return metadata;
+}
+
+} // namespace Persistence::CellBinary
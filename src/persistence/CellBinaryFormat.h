@@ -0,0 +1,150 @@
+#pragma once
+
+#include "EntryMetadata.h"
+#if !defined(TEST_ENVIRONMENT)
+#include <RE/N/NiPoint3.h>
+#else
+#include "TestStubs.h"
+#endif
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Persistence::CellBinary {
+
+// Columnar per-cell file (.vrcb) - binary sibling of _AddedObjects.ini / _SWAP.ini
+//
+// The INI files are the interchange format (BOS reads _SWAP.ini, users edit them);
+// for large projects they are slow to parse and several times the size of the data.
+// A .vrcb file holds the same rows as fixed-width columns, laid out so a loader can
+// read them straight out of a memory map (Util::MappedFile) without parsing.
+//
+// Layout (little-endian; every section is 4-byte aligned):
+//   FileHeader     32 bytes
+//   plugin table   pluginCount x uint32 - string offsets of plugin file names
+//   columns        kColumnCount x rowCount x 4 bytes, in Column order
+//   string table   stringTableSize bytes of NUL-terminated strings (deduplicated)
+//
+// Form keys ("0x10C0E3~Skyrim.esm") are split into FormPlugin (plugin table index)
+// and FormId (local form ID). AddedObjects may name a base form by editor ID instead;
+// such rows have FormPlugin == kEditorIdPlugin and FormId holds the editor ID's
+// string offset. The metadata columns are string offsets (kNoString when empty) -
+// loaders that only need transforms never touch their pages.
+
+inline constexpr std::array<char, 4> kMagic = { 'V', 'R', 'C', 'B' };
+inline constexpr uint32_t kVersion = 1;
+inline constexpr uint32_t kNoString = 0xFFFFFFFF;
+inline constexpr uint32_t kEditorIdPlugin = 0xFFFFFFFF;
+
+// Flags column
+inline constexpr uint32_t kFlagDeleted = 1u << 0;  // BOS: reference is disabled
+
+enum class FileKind : uint32_t {
+    AddedObjects = 1,  // Rows are _AddedObjects.ini entries (base form + transform)
+    Transforms = 2,    // Rows are _SWAP.ini [Transforms] entries (reference + transform)
+};
+
+enum class Column : uint32_t {
+    FormPlugin,
+    FormId,
+    PosX, PosY, PosZ,
+    RotX, RotY, RotZ,  // Degrees, as in the INI files
+    Scale,
+    Flags,
+    EditorId,
+    DisplayName,
+    MeshName,
+    FormTypeName,
+    Count
+};
+inline constexpr size_t kColumnCount = static_cast<size_t>(Column::Count);
+
+struct FileHeader {
+    std::array<char, 4> magic;
+    uint32_t version;
+    uint32_t kind;             // FileKind
+    uint32_t rowCount;
+    uint32_t pluginCount;
+    uint32_t cellFormKey;      // String offsets
+    uint32_t cellEditorId;
+    uint32_t stringTableSize;
+};
+static_assert(sizeof(FileHeader) == 32);
+
+// Builds a file in memory, one row at a time
+class Builder
+{
+public:
+    Builder(FileKind kind, std::string_view cellFormKey, std::string_view cellEditorId);
+
+    // formKey: "0xID~Plugin", or an editor ID (AddedObjects base forms)
+    void AddRow(std::string_view formKey, const RE::NiPoint3& position, const RE::NiPoint3& rotation,
+                float scale, uint32_t flags, const EntryMetadata& metadata);
+
+    size_t GetRowCount() const { return m_rowCount; }
+
+    // The complete file
+    std::vector<std::byte> Finish() const;
+
+private:
+    uint32_t AddString(std::string_view str);
+    uint32_t AddPlugin(std::string_view pluginName);
+
+    FileKind m_kind;
+    uint32_t m_cellFormKey;
+    uint32_t m_cellEditorId;
+    size_t m_rowCount = 0;
+    std::array<std::vector<uint32_t>, kColumnCount> m_columns;
+    std::vector<uint32_t> m_plugins;                        // String offsets
+    std::unordered_map<std::string, uint32_t> m_pluginIndex;
+    std::string m_strings;
+    std::unordered_map<std::string, uint32_t> m_stringOffsets;
+};
+
+// Read-only view over a file's bytes (typically a memory map)
+// Open() checks the header and section sizes; out-of-range string offsets and
+// plugin indices in the columns read as empty strings, so a damaged file never
+// reads outside its bytes.
+class View
+{
+public:
+    static std::optional<View> Open(std::span<const std::byte> bytes, std::string* error = nullptr);
+
+    FileKind GetKind() const { return static_cast<FileKind>(m_header.kind); }
+    size_t GetRowCount() const { return m_header.rowCount; }
+    std::string_view GetCellFormKey() const { return GetString(m_header.cellFormKey); }
+    std::string_view GetCellEditorId() const { return GetString(m_header.cellEditorId); }
+
+    std::span<const uint32_t> GetUIntColumn(Column column) const;
+    std::span<const float> GetFloatColumn(Column column) const;
+
+    // Empty for kNoString and offsets outside the string table
+    std::string_view GetString(uint32_t offset) const;
+    std::string_view GetPluginName(uint32_t index) const;
+
+    // Row accessors on top of the columns
+    std::string GetFormKey(size_t row) const;
+    RE::NiPoint3 GetPosition(size_t row) const;
+    RE::NiPoint3 GetRotation(size_t row) const;
+    float GetScale(size_t row) const { return GetFloatColumn(Column::Scale)[row]; }
+    uint32_t GetFlags(size_t row) const { return GetUIntColumn(Column::Flags)[row]; }
+    EntryMetadata GetMetadata(size_t row) const;
+
+private:
+    View() = default;
+
+    const std::byte* ColumnData(Column column) const;
+
+    FileHeader m_header{};
+    const uint32_t* m_plugins = nullptr;
+    const std::byte* m_columns = nullptr;
+    const char* m_strings = nullptr;
+};
+
+} // namespace Persistence::CellBinary
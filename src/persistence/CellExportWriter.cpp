@@ -0,0 +1,153 @@
+#include "CellExportWriter.h"
+#include "AddedObjectsExporter.h"
+#include "BaseObjectSwapperExporter.h"
+#include "ExportBuilder.h"
+#include "../config/ConfigStorage.h"
+#include "../config/ConfigOptions.h"
+#include "../util/Profiler.h"
+#include "../log.h"
+#include <unordered_map>
+
+namespace Persistence {
+
+CellExportWriter* CellExportWriter::GetSingleton()
+{
+    static CellExportWriter instance;
+    return &instance;
+}
+
+CellExportWriter::~CellExportWriter()
+{
+    // Static destruction at process exit: the OS has already stopped the writer
+    // thread (possibly while it held m_mutex), so it cannot be woken and joined
+    if (m_thread.joinable()) {
+        m_thread.detach();
+    }
+}
+
+size_t CellExportWriter::ExportCellsOutside(const std::string& currentCellFormKey)
+{
+    auto* config = Config::ConfigStorage::GetSingleton();
+    if (config->GetInt(Config::Options::kExportOnCellLeave, 0) == 0 ||
+        config->GetInt(Config::Options::kSavePerCell, 0) == 0) {
+        return 0;
+    }
+
+    PROFILE_FUNCTION();
+    Entries taken = ChangedObjectRegistry::GetSingleton()->TakePendingExportEntriesOutside(currentCellFormKey);
+    if (taken.empty()) {
+        return 0;
+    }
+
+    // One job per cell, so a failed file only re-marks its own entries
+    std::unordered_map<std::string, Entries> byCell;
+    for (auto& entry : taken) {
+        byCell[entry.second.saveData.cellFormKey].push_back(std::move(entry));
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        for (auto& [cellFormKey, entries] : byCell) {
+            m_queue.push_back(CellJob{ cellFormKey, std::move(entries) });
+        }
+        if (!m_thread.joinable()) {
+            m_thread = std::thread(&CellExportWriter::WorkerLoop, this);
+        }
+    }
+    m_wake.notify_one();
+
+    spdlog::info("CellExportWriter: Queued {} entries from {} cells for background export",
+        taken.size(), byCell.size());
+    return taken.size();
+}
+
+void CellExportWriter::Flush()
+{
+    PROFILE_FUNCTION();
+    std::unique_lock lock(m_mutex);
+    if (m_queue.empty() && !m_writing) {
+        return;
+    }
+
+    spdlog::info("CellExportWriter: Waiting for {} queued cells", m_queue.size() + (m_writing ? 1 : 0));
+    m_idle.wait(lock, [this] { return m_queue.empty() && !m_writing; });
+}
+
+void CellExportWriter::Cancel()
+{
+    std::unique_lock lock(m_mutex);
+    const size_t dropped = m_queue.size();
+    m_queue.clear();
+    if (dropped == 0 && !m_writing) {
+        return;
+    }
+
+    spdlog::info("CellExportWriter: Dropped {} queued cells{}", dropped,
+        m_writing ? ", waiting for the one being written" : "");
+    m_idle.wait(lock, [this] { return !m_writing; });
+}
+
+size_t CellExportWriter::GetQueuedCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_queue.size() + (m_writing ? 1 : 0);
+}
+
+void CellExportWriter::WorkerLoop()
+{
+    std::unique_lock lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [this] { return !m_queue.empty(); });
+
+        CellJob job = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_writing = true;
+
+        lock.unlock();
+        WriteCell(job);
+        lock.lock();
+
+        m_writing = false;
+        if (m_queue.empty()) {
+            m_idle.notify_all();
+        }
+    }
+}
+
+void CellExportWriter::WriteCell(const CellJob& job)
+{
+    ExportBuilder::PendingEntries pending;
+    pending.reserve(job.entries.size());
+    size_t createdCount = 0;
+    for (const auto& [formKey, data] : job.entries) {
+        pending.emplace_back(formKey, &data);
+        if (data.saveData.wasCreated) {
+            createdCount++;
+        }
+    }
+    const size_t movedCount = pending.size() - createdCount;
+
+    // Exporters skip the entries that are not theirs (created vs. existing references)
+    const bool movedWritten = movedCount == 0 ||
+        BaseObjectSwapperExporter::GetSingleton()->ExportEntries(pending) == movedCount;
+    const bool createdWritten = createdCount == 0 ||
+        AddedObjectsExporter::GetSingleton()->ExportEntries(pending) == createdCount;
+
+    if (movedWritten && createdWritten) {
+        return;
+    }
+
+    // Hand the entries of the failed file(s) back to the save-time export
+    std::vector<std::string> retry;
+    for (const auto& [formKey, data] : job.entries) {
+        if (data.saveData.wasCreated ? !createdWritten : !movedWritten) {
+            retry.push_back(formKey);
+        }
+    }
+    ChangedObjectRegistry::GetSingleton()->MarkPendingExport(retry);
+
+    spdlog::warn("CellExportWriter: Export of cell {} incomplete - {} entries left for the next save",
+        job.cellFormKey, retry.size());
+}
+
+} // namespace Persistence
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "ChangedObjectRegistry.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Persistence {
+
+// CellExportWriter: Exports cells the player has left on a background thread
+//
+// Problem: All INI export ran in SaveGameDataManager::OnSave, so the first save
+// after a long building session formatted and merged every touched cell at once.
+//
+// Solution: When the player enters a cell (bExportOnCellLeave), the pending
+// entries of every other cell are taken out of the registry and handed to a
+// writer thread. Since ChangedObjectRegistry captures the export data at edit
+// time, the exporters' ExportEntries runs there without touching the game.
+// OnSave is left with the cell the player is in.
+//
+// Ordering: OnSave calls Flush() before its own export, so a save never writes a
+// file the writer thread is still merging into.
+//
+// Failures: Entries whose file could not be written are marked pending again and
+// retried by the next save.
+//
+// Game load: Cancel() drops the queued cells - their entries belong to the session
+// being unloaded - and waits for the one being written.
+//
+// Only per-cell mode (bSavePerCell) exports early. A consolidated file holds every
+// cell and is written from the full pending set at save time.
+//
+class CellExportWriter
+{
+public:
+    static CellExportWriter* GetSingleton();
+
+    // Queue the pending changes of every cell except the player's current one
+    // Main thread; no-op unless bExportOnCellLeave and bSavePerCell are set
+    // Returns the number of entries queued
+    size_t ExportCellsOutside(const std::string& currentCellFormKey);
+
+    // Block until every queued cell has been written
+    void Flush();
+
+    // Drop the queued cells and wait for the one being written (game load)
+    void Cancel();
+
+    // Cells queued or being written
+    size_t GetQueuedCount() const;
+
+private:
+    CellExportWriter() = default;
+    ~CellExportWriter();
+    CellExportWriter(const CellExportWriter&) = delete;
+    CellExportWriter& operator=(const CellExportWriter&) = delete;
+
+    using Entries = std::vector<std::pair<std::string, ChangedObjectRuntimeData>>;
+
+    struct CellJob {
+        std::string cellFormKey;
+        Entries entries;
+    };
+
+    void WorkerLoop();
+
+    // Write one cell's BOS and AddedObjects files (writer thread)
+    static void WriteCell(const CellJob& job);
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;  // Worker: jobs queued
+    std::condition_variable m_idle;  // Flush: queue drained
+    std::deque<CellJob> m_queue;
+    bool m_writing = false;
+    std::thread m_thread;
+};
+
+} // namespace Persistence
@@ -0,0 +1,412 @@
+#include "CellResetJob.h"
+#include "AddedObjectsParser.h"
+#include "AddedObjectsSpawner.h"
+#include "BaseObjectSwapperParser.h"
+#include "CellBinaryConverter.h"
+#include "CellExportWriter.h"
+#include "CreatedObjectTracker.h"
+#include "FormKeyUtil.h"
+#include "../FrameCallbackDispatcher.h"
+#include "../grab/DeferredCollisionUpdateManager.h"
+#include "../visuals/ObjectHighlighter.h"
+#include "../util/PositioningUtil.h"
+#include "../log.h"
+#include <fmt/format.h>
+#include <RE/P/PlayerCharacter.h>
+#include <filesystem>
+
+namespace Persistence {
+
+namespace {
+    void RemoveFileIfExists(const std::filesystem::path& path)
+    {
+        std::error_code ec;
+        if (std::filesystem::exists(path, ec)) {
+            std::filesystem::remove(path, ec);
+            if (ec) {
+                spdlog::warn("CellResetJob: Failed to delete {}", path.string());
+            }
+        }
+    }
+
+    RE::TESObjectREFR* LookupRef(const std::string& formKey)
+    {
+        RE::FormID runtimeFormId = FormKeyUtil::ResolveToRuntimeFormID(formKey);
+        if (runtimeFormId == 0) {
+            return nullptr;
+        }
+        return RE::TESForm::LookupByID<RE::TESObjectREFR>(runtimeFormId);
+    }
+}
+
+CellResetJob* CellResetJob::GetSingleton()
+{
+    static CellResetJob instance;
+    return &instance;
+}
+
+bool CellResetJob::Start()
+{
+    if (IsRunning()) {
+        RE::DebugNotification(fmt::format("VR Editor: Already resetting {}", m_cellName).c_str());
+        return false;
+    }
+
+    auto* player = RE::PlayerCharacter::GetSingleton();
+    if (!player) {
+        spdlog::warn("CellResetJob: Start - player not found");
+        return false;
+    }
+
+    auto* cell = player->GetParentCell();
+    if (!cell) {
+        spdlog::warn("CellResetJob: Start - cell not found");
+        return false;
+    }
+
+    m_cellFormId = cell->GetFormID();
+    m_cellFormKey = FormKeyUtil::BuildFormKey(cell);
+    m_cellEditorId = cell->GetFormEditorID() ? cell->GetFormEditorID() : "";
+
+    if (const char* name = cell->GetName(); name && name[0] != '\0') {
+        m_cellName = name;
+    } else if (!m_cellEditorId.empty()) {
+        m_cellName = m_cellEditorId;
+    } else {
+        m_cellName = fmt::format("{:08X}", m_cellFormId);
+    }
+
+    // Take the entries out of the registry now so nothing re-exports them mid-job
+    auto entries = ChangedObjectRegistry::GetSingleton()->ExtractEntriesForCell(m_cellFormKey);
+
+    m_restoreEntries.clear();
+    m_createdEntries.clear();
+    for (auto& entry : entries) {
+        if (entry.second.saveData.wasCreated) {
+            m_createdEntries.push_back(std::move(entry));
+        } else {
+            m_restoreEntries.push_back(std::move(entry));
+        }
+    }
+
+    m_phase = Phase::Restoring;
+    m_nextIndex = 0;
+    m_resetCount = 0;
+    m_removedAddedCount = 0;
+    m_leftCell = false;
+    m_progressTimer = 0.0f;
+
+    if (!m_isRegistered) {
+        // Runs outside edit mode too - the reset is a Papyrus/MCM action
+        FrameCallbackDispatcher::GetSingleton()->Register(this, false);
+        m_isRegistered = true;
+    }
+
+    RE::DebugNotification(fmt::format("VR Editor: Resetting {}...", m_cellName).c_str());
+    spdlog::info("CellResetJob: Started reset of {} ({} edited, {} created)",
+        m_cellFormKey, m_restoreEntries.size(), m_createdEntries.size());
+    return true;
+}
+
+void CellResetJob::Cancel()
+{
+    if (!IsRunning()) {
+        return;
+    }
+
+    // Return everything not yet processed so it stays tracked
+    std::vector<Entry> remaining;
+    if (m_phase == Phase::Restoring) {
+        remaining.assign(std::make_move_iterator(m_restoreEntries.begin() + m_nextIndex),
+                         std::make_move_iterator(m_restoreEntries.end()));
+        remaining.insert(remaining.end(),
+                         std::make_move_iterator(m_createdEntries.begin()),
+                         std::make_move_iterator(m_createdEntries.end()));
+    } else {
+        remaining.assign(std::make_move_iterator(m_createdEntries.begin() + m_nextIndex),
+                         std::make_move_iterator(m_createdEntries.end()));
+    }
+
+    const size_t remainingCount = remaining.size();
+    ChangedObjectRegistry::GetSingleton()->ReinsertEntries(std::move(remaining));
+
+    RE::DebugNotification(fmt::format("VR Editor: Reset of {} cancelled ({} objects reset)",
+        m_cellName, m_resetCount).c_str());
+    spdlog::info("CellResetJob: Cancelled reset of {} - {} reset, {} entries returned to registry",
+        m_cellFormKey, m_resetCount, remainingCount);
+
+    Stop();
+}
+
+void CellResetJob::Abort()
+{
+    if (!IsRunning()) {
+        return;
+    }
+
+    spdlog::info("CellResetJob: Aborted reset of {} ({} of {} restored)",
+        m_cellFormKey, m_resetCount, m_restoreEntries.size());
+    Stop();
+}
+
+void CellResetJob::FinishNow()
+{
+    if (!IsRunning()) {
+        return;
+    }
+
+    const size_t remaining = m_phase == Phase::Restoring
+        ? m_restoreEntries.size() - m_nextIndex + m_createdEntries.size()
+        : m_createdEntries.size() - m_nextIndex;
+    spdlog::info("CellResetJob: Save during the reset of {} - finishing the remaining {} entries now",
+        m_cellFormKey, remaining);
+
+    while (IsRunning()) {
+        Step();
+    }
+}
+
+void CellResetJob::Stop()
+{
+    m_phase = Phase::Idle;
+    m_restoreEntries.clear();
+    m_createdEntries.clear();
+    m_nextIndex = 0;
+
+    if (m_isRegistered) {
+        FrameCallbackDispatcher::GetSingleton()->Unregister(this);
+        m_isRegistered = false;
+    }
+}
+
+void CellResetJob::OnFrameUpdate(float deltaTime)
+{
+    if (!IsRunning()) {
+        return;
+    }
+
+    Step();
+
+    if (IsRunning()) {
+        MaybeReportProgress(deltaTime);
+    }
+}
+
+void CellResetJob::Step()
+{
+    if (!m_leftCell && !IsPlayerInCell()) {
+        m_leftCell = true;
+        spdlog::info("CellResetJob: Player left {} - finishing without 3D updates", m_cellFormKey);
+    }
+
+    if (m_phase == Phase::Restoring) {
+        if (m_leftCell) {
+            FinishRemainingDataOnly();
+        } else {
+            ProcessRestoreSlice();
+        }
+
+        if (m_nextIndex >= m_restoreEntries.size()) {
+            m_phase = Phase::RemovingCreated;
+            m_nextIndex = 0;
+        }
+    } else if (m_phase == Phase::RemovingCreated) {
+        ProcessRemoveSlice();
+
+        if (m_nextIndex >= m_createdEntries.size()) {
+            Complete();
+        }
+    }
+}
+
+bool CellResetJob::IsPlayerInCell() const
+{
+    auto* player = RE::PlayerCharacter::GetSingleton();
+    auto* cell = player ? player->GetParentCell() : nullptr;
+    return cell && cell->GetFormID() == m_cellFormId;
+}
+
+RE::TESObjectREFR* CellResetJob::RestoreEntry(const Entry& entry, bool with3D)
+{
+    auto* ref = LookupRef(entry.first);
+    if (!ref) {
+        return nullptr;
+    }
+
+    const auto& original = entry.second.saveData.originalTransform;
+
+    if (ref->IsDeleted()) {
+        ref->SetDelete(false);
+    }
+    ref->Enable(false);
+
+    // Apply original transform
+    RE::NiPoint3 angles = PositioningUtil::MatrixToEulerAngles(original.rotate);
+    PositioningUtil::SetPositionNative(ref, original.translate);
+    PositioningUtil::SetAngleNative(ref, angles);
+    ref->SetScale(original.scale);
+
+    // Without 3D the new data is picked up when the cell loads again
+    if (with3D) {
+        ref->Update3DPosition(true);
+    }
+
+    m_resetCount++;
+    return ref;
+}
+
+void CellResetJob::RebuildCollision(const std::vector<RE::TESObjectREFR*>& refs)
+{
+    auto* deferred = Grab::DeferredCollisionUpdateManager::GetSingleton();
+
+    std::vector<RE::TESObjectREFR*> toggled;
+    toggled.reserve(refs.size());
+
+    for (auto* ref : refs) {
+        // Player standing on it - toggling now would drop them through the floor
+        if (ref->Get3D() && deferred->RegisterForDeferredUpdate(ref, ref->Get3D()->world)) {
+            continue;
+        }
+        ObjectHighlighter::Unhighlight(ref);
+        ref->Disable();
+        toggled.push_back(ref);
+    }
+
+    for (auto* ref : toggled) {
+        ref->Enable(false);
+    }
+}
+
+void CellResetJob::ProcessRestoreSlice()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<RE::TESObjectREFR*> slice;
+    slice.reserve(kRefsPerFrame);
+
+    while (m_nextIndex < m_restoreEntries.size() && slice.size() < kRefsPerFrame) {
+        if (auto* ref = RestoreEntry(m_restoreEntries[m_nextIndex], true)) {
+            slice.push_back(ref);
+        }
+        m_nextIndex++;
+
+        if (std::chrono::steady_clock::now() - start >= kFrameBudget) {
+            break;
+        }
+    }
+
+    RebuildCollision(slice);
+
+    spdlog::trace("CellResetJob: Restored {} refs this frame ({}/{})",
+        slice.size(), m_nextIndex, m_restoreEntries.size());
+}
+
+void CellResetJob::FinishRemainingDataOnly()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    size_t count = 0;
+    size_t processed = 0;
+    while (m_nextIndex < m_restoreEntries.size() && processed < kDataOnlyRefsPerFrame) {
+        if (RestoreEntry(m_restoreEntries[m_nextIndex], false)) {
+            count++;
+        }
+        m_nextIndex++;
+        processed++;
+
+        if (std::chrono::steady_clock::now() - start >= kFrameBudget) {
+            break;
+        }
+    }
+
+    spdlog::trace("CellResetJob: Restored {} refs data-only this frame ({}/{})",
+        count, m_nextIndex, m_restoreEntries.size());
+}
+
+void CellResetJob::ProcessRemoveSlice()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    auto* tracker = CreatedObjectTracker::GetSingleton();
+
+    size_t processed = 0;
+    while (m_nextIndex < m_createdEntries.size() && processed < kRefsPerFrame) {
+        if (auto* ref = LookupRef(m_createdEntries[m_nextIndex].first)) {
+            // Untrack now - a Cancel before Complete must not leave entries for deleted refs
+            if (tracker) {
+                tracker->Remove(ref);
+            }
+            ObjectHighlighter::Unhighlight(ref);
+            ref->Disable();
+            ref->SetDelete(true);
+        }
+        m_nextIndex++;
+        processed++;
+
+        if (std::chrono::steady_clock::now() - start >= kFrameBudget) {
+            break;
+        }
+    }
+}
+
+void CellResetJob::Complete()
+{
+    // Remove and delete the added objects of this cell that were not loaded
+    // (the loaded ones were untracked as ProcessRemoveSlice deleted them)
+    if (auto* tracker = CreatedObjectTracker::GetSingleton()) {
+        m_removedAddedCount = tracker->RemoveForCell(m_cellFormKey);
+    }
+    if (m_removedAddedCount < m_createdEntries.size()) {
+        m_removedAddedCount = m_createdEntries.size();
+    }
+
+    if (auto* spawner = AddedObjectsSpawner::GetSingleton()) {
+        spawner->RemoveCellEntries(m_cellFormKey);
+    }
+
+    // A background export of this cell (left and re-entered) must not recreate the files
+    CellExportWriter::GetSingleton()->Flush();
+
+    // Remove AddedObjects INI (and its .vrcb, if any) for this cell
+    {
+        auto* parser = AddedObjectsParser::GetSingleton();
+        auto filePath = parser->GetVREditorFolderPath() / AddedObjectsParser::BuildIniFileName(m_cellEditorId, m_cellFormKey);
+        RemoveFileIfExists(filePath);
+        RemoveFileIfExists(CellBinary::GetBinaryPath(filePath));
+    }
+
+    // Remove BOS swap/session files for this cell
+    {
+        auto* bos = BaseObjectSwapperParser::GetSingleton();
+        auto swapFileName = BaseObjectSwapperParser::BuildIniFileName(m_cellEditorId, m_cellFormKey);
+        auto sessionFileName = BaseObjectSwapperParser::BuildSessionIniFileName(m_cellEditorId, m_cellFormKey);
+        RemoveFileIfExists(bos->GetDataFolderPath() / swapFileName);
+        RemoveFileIfExists(bos->GetVREditorFolderPath() / sessionFileName);
+    }
+
+    std::string message = fmt::format("VR Editor: Reset {} objects", m_resetCount);
+    if (m_removedAddedCount > 0) {
+        message += fmt::format(", removed {} added objects", m_removedAddedCount);
+    }
+    RE::DebugNotification(message.c_str());
+
+    spdlog::info("CellResetJob: Finished reset of {} - {} reset, {} added objects removed{}",
+        m_cellFormKey, m_resetCount, m_removedAddedCount, m_leftCell ? " (player left cell)" : "");
+
+    Stop();
+}
+
+void CellResetJob::MaybeReportProgress(float deltaTime)
+{
+    m_progressTimer += deltaTime;
+    if (m_progressTimer < kProgressIntervalSeconds) {
+        return;
+    }
+    m_progressTimer = 0.0f;
+
+    const size_t total = m_restoreEntries.size() + m_createdEntries.size();
+    const size_t done = m_phase == Phase::Restoring ? m_nextIndex : m_restoreEntries.size() + m_nextIndex;
+    RE::DebugNotification(fmt::format("VR Editor: Resetting {}... {}/{}", m_cellName, done, total).c_str());
+}
+
+} // namespace Persistence
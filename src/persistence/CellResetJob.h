@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../IFrameUpdateListener.h"
+#include "ChangedObjectRegistry.h"
+#include <RE/Skyrim.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Persistence {
+
+// CellResetJob: Resets all edits of one cell, spread over several frames
+//
+// Problem: Resetting a cell restores every edited reference (position, angle, scale,
+// 3D sync) and forces a Havok rebuild with Disable()/Enable(). Doing thousands of
+// those in one frame freezes the game for seconds.
+//
+// Solution: The registry entries for the cell are extracted up front, then the job
+// runs on the FrameCallbackDispatcher and restores at most kRefsPerFrame references
+// (and at most kFrameBudget of wall time) per frame. The Havok rebuild is batched:
+// a frame's slice is first restored in full, then disabled together and re-enabled
+// together, so the physics world sees one block of removals and one of additions
+// instead of interleaved toggles. References the player is standing on are handed
+// to DeferredCollisionUpdateManager so the player does not fall through.
+//
+// Phases: Restoring -> RemovingCreated -> Finished (files and caches cleaned up)
+//
+// Leaving the cell: once the cell's 3D is gone, Disable/Enable and Update3DPosition
+// are pointless. The remaining references are restored data-only, kDataOnlyRefsPerFrame
+// per frame (cheap without 3D, but still bounded by kFrameBudget), and the job
+// completes normally.
+//
+// Cancel(): stops after the current slice. Entries not yet restored are put back
+// into ChangedObjectRegistry, so they are still tracked and exported as before.
+// Created references already deleted were removed from CreatedObjectTracker one by
+// one, so none of them is respawned. Files on disk are only deleted when the job completes.
+//
+// Saving: the extracted entries are in neither the registry nor the co-save while
+// the job runs, so SaveGameDataManager::OnSave calls FinishNow() first. A save made
+// mid-reset then stores the cell fully reset, matching the files Complete() removes.
+//
+class CellResetJob : public IFrameUpdateListener
+{
+public:
+    static CellResetJob* GetSingleton();
+
+    // Start resetting the player's current cell
+    // Returns false if a job is already running or the cell could not be resolved
+    bool Start();
+
+    // Stop the running job, returning unprocessed entries to the registry
+    void Cancel();
+
+    // Drop the running job without touching game objects (game load / revert)
+    void Abort();
+
+    // Run the rest of the job now, ignoring the per-frame budget (before a save)
+    void FinishNow();
+
+    bool IsRunning() const { return m_phase != Phase::Idle; }
+
+    // IFrameUpdateListener interface
+    void OnFrameUpdate(float deltaTime) override;
+
+    // Per-frame budget
+    static constexpr size_t kRefsPerFrame = 32;
+    static constexpr std::chrono::microseconds kFrameBudget{ 2000 };
+
+    // Per-frame cap once the player has left the cell (no 3D work per reference)
+    static constexpr size_t kDataOnlyRefsPerFrame = 256;
+
+    // Minimum time between progress notifications
+    static constexpr float kProgressIntervalSeconds = 2.0f;
+
+private:
+    CellResetJob() = default;
+    ~CellResetJob() = default;
+    CellResetJob(const CellResetJob&) = delete;
+    CellResetJob& operator=(const CellResetJob&) = delete;
+
+    enum class Phase {
+        Idle,
+        Restoring,        // Restoring original transforms of edited references
+        RemovingCreated,  // Deleting references created by the editor
+    };
+
+    using Entry = std::pair<std::string, ChangedObjectRuntimeData>;
+
+    // Restore one entry's original state; with3D=false only updates reference data
+    RE::TESObjectREFR* RestoreEntry(const Entry& entry, bool with3D);
+
+    // Disable all refs of a slice, then enable them all (see class comment)
+    void RebuildCollision(const std::vector<RE::TESObjectREFR*>& refs);
+
+    // One frame's worth of work; completes the job after the last slice
+    void Step();
+
+    void ProcessRestoreSlice();
+    void ProcessRemoveSlice();
+    void FinishRemainingDataOnly();
+    void Complete();
+    void Stop();
+
+    bool IsPlayerInCell() const;
+    void MaybeReportProgress(float deltaTime);
+
+    Phase m_phase = Phase::Idle;
+
+    RE::FormID m_cellFormId = 0;
+    std::string m_cellFormKey;
+    std::string m_cellEditorId;
+    std::string m_cellName;
+
+    std::vector<Entry> m_restoreEntries;  // Edited references (extracted from the registry)
+    std::vector<Entry> m_createdEntries;  // References created by the editor
+    size_t m_nextIndex = 0;               // Next entry of the current phase's list
+
+    size_t m_resetCount = 0;
+    size_t m_removedAddedCount = 0;
+    bool m_leftCell = false;
+
+    float m_progressTimer = 0.0f;
+    bool m_isRegistered = false;
+};
+
+} // namespace Persistence
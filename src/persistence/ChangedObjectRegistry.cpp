@@ -1,8 +1,14 @@
 #include "ChangedObjectRegistry.h"
+#include "BaseFormMetadataCache.h"
+#include "ExportBuilder.h"
 #include "FormKeyUtil.h"
 #include "../log.h"
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/P/PlayerCharacter.h>
 #include <RE/T/TESObjectCELL.h>
+#endif
+#include <string_view>
+#include <unordered_set>
 
 namespace Persistence {
 
@@ -12,29 +18,11 @@ ChangedObjectRegistry* ChangedObjectRegistry::GetSingleton()
     return &instance;
 }
 
-void ChangedObjectRegistry::RegisterIfNew(RE::TESObjectREFR* ref,
-                                          const RE::NiTransform& originalTransform,
-                                          const Util::ActionId& actionId)
+ChangedObjectRuntimeData ChangedObjectRegistry::BuildEntry(RE::TESObjectREFR* ref,
+                                                           const std::string& formKey,
+                                                           const RE::NiTransform& originalTransform,
+                                                           const Util::ActionId& actionId) const
 {
-    if (!ref) {
-        return;
-    }
-
-    std::string formKey = FormKeyUtil::BuildFormKey(ref);
-    if (formKey.empty()) {
-        spdlog::warn("ChangedObjectRegistry: Could not build form key for {:08X} (dynamic form?)",
-            ref->GetFormID());
-        return;
-    }
-
-    std::unique_lock lock(m_mutex);
-
-    // Only register if not already present
-    if (m_entries.contains(formKey)) {
-        spdlog::trace("ChangedObjectRegistry: {} already registered, skipping", formKey);
-        return;
-    }
-
     ChangedObjectRuntimeData data;
     data.saveData.formKeyString = formKey;
     data.saveData.originalTransform = originalTransform;
@@ -45,9 +33,8 @@ void ChangedObjectRegistry::RegisterIfNew(RE::TESObjectREFR* ref,
     data.createdThisSession = true;
 
     // Capture cell info while we have access to the loaded reference
-    std::string cellFormKey;
     if (auto* cell = ref->GetParentCell()) {
-        cellFormKey = FormKeyUtil::BuildFormKey(cell);
+        std::string cellFormKey = FormKeyUtil::BuildFormKey(cell);
         if (cellFormKey.empty()) {
             // BuildFormKey failed - cell has no source file (common for dynamically-created exterior cells)
             // Fall back to player's cell, which should be a real persistent cell
@@ -76,13 +63,156 @@ void ChangedObjectRegistry::RegisterIfNew(RE::TESObjectREFR* ref,
         spdlog::warn("ChangedObjectRegistry: {} has no parent cell at registration time!", formKey);
     }
 
-    auto timestamp = data.saveData.timestamp;
-    m_entries.emplace(formKey, std::move(data));
+    // Comment metadata for export - position and angles follow with UpdateCurrentTransform
+    data.exportRecord.metadata = BaseFormMetadataCache::GetSingleton()->GetForReference(ref);
+
+    return data;
+}
+
+void ChangedObjectRegistry::RegisterIfNew(RE::TESObjectREFR* ref,
+                                          const RE::NiTransform& originalTransform,
+                                          const Util::ActionId& actionId)
+{
+    if (!ref) {
+        return;
+    }
+
+    std::string formKey = FormKeyUtil::BuildFormKey(ref);
+    if (formKey.empty()) {
+        spdlog::warn("ChangedObjectRegistry: Could not build form key for {:08X} (dynamic form?)",
+            ref->GetFormID());
+        return;
+    }
+
+    // Game reads happen outside the lock; the unique lock only covers check-and-insert
+    bool registered = false;
+    bool needsMetadata = false;
+    {
+        std::shared_lock lock(m_mutex);
+        if (auto it = m_entries.find(formKey); it != m_entries.end()) {
+            registered = true;
+            // Entries loaded from a save may have no export metadata yet
+            needsMetadata = it->second.exportRecord.metadata.IsCompletelyEmpty();
+        }
+    }
+
+    // Only register if not already present
+    if (registered) {
+        if (needsMetadata) {
+            auto metadata = BaseFormMetadataCache::GetSingleton()->GetForReference(ref);
+            std::unique_lock lock(m_mutex);
+            if (auto it = m_entries.find(formKey); it != m_entries.end()) {
+                auto& existing = it->second.exportRecord.metadata;
+                if (existing.IsCompletelyEmpty()) {
+                    existing = std::move(metadata);
+                }
+            }
+        }
+        spdlog::trace("ChangedObjectRegistry: {} already registered, skipping", formKey);
+        return;
+    }
+
+    auto data = BuildEntry(ref, formKey, originalTransform, actionId);
+    const auto cellFormKey = data.saveData.cellFormKey;
+    const auto timestamp = data.saveData.timestamp;
+    {
+        std::unique_lock lock(m_mutex);
+
+        // Another thread may have registered the same object in between - keep its entry
+        if (!m_entries.try_emplace(formKey, std::move(data)).second) {
+            spdlog::trace("ChangedObjectRegistry: {} already registered, skipping", formKey);
+            return;
+        }
+    }
 
     spdlog::info("ChangedObjectRegistry: Registered {} (cell: {}, first change: action {}, timestamp: {})",
         formKey, cellFormKey, actionId.Value(), timestamp);
 }
 
+size_t ChangedObjectRegistry::RegisterIfNewBatch(
+    const std::vector<std::pair<RE::TESObjectREFR*, RE::NiTransform>>& objects,
+    const Util::ActionId& actionId)
+{
+    // Game reads happen outside the lock; the unique lock only covers check-and-insert
+    std::vector<std::string> formKeys;
+    formKeys.reserve(objects.size());
+    for (const auto& [ref, transform] : objects) {
+        std::string formKey = ref ? FormKeyUtil::BuildFormKey(ref) : std::string{};
+        if (ref && formKey.empty()) {
+            spdlog::warn("ChangedObjectRegistry: Could not build form key for {:08X} (dynamic form?)",
+                ref->GetFormID());
+        }
+        formKeys.push_back(std::move(formKey));
+    }
+
+    // Which objects need a new entry, and which existing entries (loaded from a
+    // save) still lack export metadata
+    std::vector<size_t> newIndices;
+    std::vector<size_t> metadataIndices;
+    {
+        std::shared_lock lock(m_mutex);
+        for (size_t i = 0; i < objects.size(); ++i) {
+            if (formKeys[i].empty()) {
+                continue;
+            }
+            auto it = m_entries.find(formKeys[i]);
+            if (it == m_entries.end()) {
+                newIndices.push_back(i);
+            } else if (it->second.exportRecord.metadata.IsCompletelyEmpty()) {
+                metadataIndices.push_back(i);
+            }
+        }
+    }
+
+    // A ref listed twice is built once
+    std::vector<std::pair<size_t, ChangedObjectRuntimeData>> built;
+    built.reserve(newIndices.size());
+    std::unordered_set<std::string_view> builtKeys;
+    for (size_t i : newIndices) {
+        if (builtKeys.insert(formKeys[i]).second) {
+            built.emplace_back(i, BuildEntry(objects[i].first, formKeys[i], objects[i].second, actionId));
+        }
+    }
+
+    std::vector<std::pair<size_t, EntryMetadata>> metadata;
+    metadata.reserve(metadataIndices.size());
+    for (size_t i : metadataIndices) {
+        metadata.emplace_back(i, BaseFormMetadataCache::GetSingleton()->GetForReference(objects[i].first));
+    }
+
+    size_t registered = 0;
+    {
+        std::unique_lock lock(m_mutex);
+
+        // Another thread may have registered the same object in between - keep its entry
+        for (auto& [i, data] : built) {
+            const auto& formKey = formKeys[i];
+            const std::string cellFormKey = data.saveData.cellFormKey;
+            if (!m_entries.try_emplace(formKey, std::move(data)).second) {
+                continue;
+            }
+            spdlog::trace("ChangedObjectRegistry: Registered {} (cell: {}, first change: action {})",
+                formKey, cellFormKey, actionId.Value());
+            registered++;
+        }
+
+        for (auto& [i, entryMetadata] : metadata) {
+            if (auto it = m_entries.find(formKeys[i]); it != m_entries.end()) {
+                auto& existing = it->second.exportRecord.metadata;
+                if (existing.IsCompletelyEmpty()) {
+                    existing = std::move(entryMetadata);
+                }
+            }
+        }
+    }
+
+    if (registered > 0) {
+        spdlog::info("ChangedObjectRegistry: Registered {} of {} objects (first change: action {})",
+            registered, objects.size(), actionId.Value());
+    }
+    return registered;
+}
+
 void ChangedObjectRegistry::RegisterDeletedIfNew(RE::TESObjectREFR* ref,
                                                   RE::FormID baseFormId,
                                                   const RE::NiTransform& originalTransform,
@@ -110,6 +240,10 @@ void ChangedObjectRegistry::RegisterDeletedIfNew(RE::TESObjectREFR* ref,
         }
     }
 
+    // The deleted line keeps the reference where it was deleted
+    auto exportRecord = ExportBuilder::CaptureRecord(ref->GetPosition(), ref->GetAngle(), ref->GetScale());
+    exportRecord.metadata = BaseFormMetadataCache::GetSingleton()->GetForReference(ref);
+
     std::unique_lock lock(m_mutex);
 
     // Only register if not already present
@@ -117,6 +251,7 @@ void ChangedObjectRegistry::RegisterDeletedIfNew(RE::TESObjectREFR* ref,
         // Object already tracked - just update the deleted flag
         auto& existing = m_entries[formKey];
         existing.saveData.wasDeleted = true;
+        existing.exportRecord = std::move(exportRecord);
 
         // Build base form key if we have a valid base form
         if (baseFormId != 0) {
@@ -146,6 +281,7 @@ void ChangedObjectRegistry::RegisterDeletedIfNew(RE::TESObjectREFR* ref,
         std::chrono::system_clock::now().time_since_epoch()).count();
     data.firstChangeActionId = actionId;
     data.createdThisSession = true;
+    data.exportRecord = std::move(exportRecord);
 
     // Build base form key if we have a valid base form
     if (baseFormId != 0) {
@@ -170,22 +306,8 @@ void ChangedObjectRegistry::RegisterCreatedObject(RE::TESObjectREFR* ref,
         return;
     }
 
-    std::string formKey = FormKeyUtil::BuildFormKey(ref);
-    if (formKey.empty()) {
-        // Created objects are dynamic forms - use FormID directly
-        formKey = fmt::format("0x{:08X}~DYNAMIC", ref->GetFormID());
-        spdlog::info("ChangedObjectRegistry: Using dynamic form key for created object: {}", formKey);
-    }
-
-    // Capture cell info while we have access to the loaded reference
-    std::string cellFormKey;
-    std::string cellEditorId;
-    if (auto* cell = ref->GetParentCell()) {
-        cellFormKey = FormKeyUtil::BuildFormKey(cell);
-        if (const char* editorId = cell->GetFormEditorID(); editorId && editorId[0] != '\0') {
-            cellEditorId = editorId;
-        }
-    }
+    auto data = BuildCreatedEntry(ref, baseFormId, transform, actionId);
+    const std::string formKey = data.saveData.formKeyString;
 
     std::unique_lock lock(m_mutex);
 
@@ -195,34 +317,90 @@ void ChangedObjectRegistry::RegisterCreatedObject(RE::TESObjectREFR* ref,
         return;
     }
 
+    spdlog::info("ChangedObjectRegistry: Registered created object {} (cell: {}, base: {}, action {}, timestamp: {})",
+        formKey, data.saveData.cellFormKey, data.saveData.baseFormKey, actionId.Value(), data.saveData.timestamp);
+
+    m_entries.emplace(formKey, std::move(data));
+}
+
+size_t ChangedObjectRegistry::RegisterCreatedObjects(const std::vector<CreatedObjectRecord>& objects,
+                                                     const Util::ActionId& actionId)
+{
+    // Build all entries (form keys, cell info, base form keys) before taking the lock
+    std::vector<ChangedObjectRuntimeData> built;
+    built.reserve(objects.size());
+    for (const auto& obj : objects) {
+        if (obj.ref) {
+            built.push_back(BuildCreatedEntry(obj.ref, obj.baseFormId, obj.transform, actionId));
+        }
+    }
+
+    size_t registered = 0;
+    {
+        std::unique_lock lock(m_mutex);
+        for (auto& data : built) {
+            std::string formKey = data.saveData.formKeyString;
+            if (!m_entries.try_emplace(std::move(formKey), std::move(data)).second) {
+                spdlog::warn("ChangedObjectRegistry: Created object {} already registered (unexpected)",
+                    data.saveData.formKeyString);
+                continue;
+            }
+            registered++;
+        }
+    }
+
+    spdlog::info("ChangedObjectRegistry: Registered {} created objects (action {})", registered, actionId.Value());
+    return registered;
+}
+
+ChangedObjectRuntimeData ChangedObjectRegistry::BuildCreatedEntry(RE::TESObjectREFR* ref,
+                                                                  RE::FormID baseFormId,
+                                                                  const RE::NiTransform& transform,
+                                                                  const Util::ActionId& actionId) const
+{
+    std::string formKey = FormKeyUtil::BuildFormKey(ref);
+    if (formKey.empty()) {
+        // Created objects are dynamic forms - use FormID directly
+        formKey = fmt::format("0x{:08X}~DYNAMIC", ref->GetFormID());
+        spdlog::trace("ChangedObjectRegistry: Using dynamic form key for created object: {}", formKey);
+    }
+
     ChangedObjectRuntimeData data;
     data.saveData.formKeyString = formKey;
     data.saveData.originalTransform = transform;
     data.saveData.wasDeleted = false;
     data.saveData.wasCreated = true;  // Mark as created by this mod
-    data.saveData.cellFormKey = cellFormKey;
-    data.saveData.cellEditorId = cellEditorId;
     data.saveData.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
     data.firstChangeActionId = actionId;
     data.createdThisSession = true;
 
-    // Store base form key
+    // Capture cell info while we have access to the loaded reference
+    if (auto* cell = ref->GetParentCell()) {
+        data.saveData.cellFormKey = FormKeyUtil::BuildFormKey(cell);
+        if (const char* editorId = cell->GetFormEditorID(); editorId && editorId[0] != '\0') {
+            data.saveData.cellEditorId = editorId;
+        }
+    }
+
+    // Store base form key, and the base object's metadata for the AddedObjects comment
     if (baseFormId != 0) {
         auto* baseForm = RE::TESForm::LookupByID(baseFormId);
         if (baseForm) {
             data.saveData.baseFormKey = FormKeyUtil::BuildFormKey(baseForm);
+            data.exportRecord.metadata = BaseFormMetadataCache::GetSingleton()->Get(baseForm);
         }
     }
 
     // Also set current transform for BOS export
+    // The new reference was placed with these angles, so its game data matches the transform
     data.currentTransform = transform;
     data.hasPendingExportChanges = true;
+    auto exportRecord = ExportBuilder::CaptureRecord(transform.translate, ref->GetAngle(), transform.scale);
+    exportRecord.metadata = std::move(data.exportRecord.metadata);
+    data.exportRecord = std::move(exportRecord);
 
-    m_entries.emplace(formKey, std::move(data));
-
-    spdlog::info("ChangedObjectRegistry: Registered created object {} (cell: {}, base: {}, action {}, timestamp: {})",
-        formKey, data.saveData.cellFormKey, data.saveData.baseFormKey, actionId.Value(), data.saveData.timestamp);
+    return data;
 }
 
 void ChangedObjectRegistry::OnActionUndone(const Util::ActionId& undoneActionId)
@@ -249,8 +427,19 @@ void ChangedObjectRegistry::OnActionUndone(const Util::ActionId& undoneActionId)
     }
 }
 
+void ChangedObjectRegistry::RecordExportState(ChangedObjectRuntimeData& data,
+                                              const RE::NiTransform& transform,
+                                              const RE::NiPoint3& eulerAngles)
+{
+    // Metadata was captured at registration and does not change with the transform
+    auto record = ExportBuilder::CaptureRecord(transform.translate, eulerAngles, transform.scale);
+    record.metadata = std::move(data.exportRecord.metadata);
+    data.exportRecord = std::move(record);
+}
+
 void ChangedObjectRegistry::UpdateCurrentTransform(const std::string& formKey,
                                                     const RE::NiTransform& currentTransform,
+                                                    const RE::NiPoint3& eulerAngles,
                                                     std::string_view locationName)
 {
     std::unique_lock lock(m_mutex);
@@ -264,11 +453,36 @@ void ChangedObjectRegistry::UpdateCurrentTransform(const std::string& formKey,
     it->second.currentTransform = currentTransform;
     it->second.locationName = std::string(locationName);
     it->second.hasPendingExportChanges = true;
+    RecordExportState(it->second, currentTransform, eulerAngles);
 
     spdlog::trace("ChangedObjectRegistry: Updated current transform for {} (location: {})",
         formKey, locationName);
 }
 
+void ChangedObjectRegistry::UpdateCurrentTransforms(const std::vector<TransformUpdate>& updates)
+{
+    if (updates.empty()) {
+        return;
+    }
+
+    std::unique_lock lock(m_mutex);
+
+    for (const auto& update : updates) {
+        auto it = m_entries.find(update.formKey);
+        if (it == m_entries.end()) {
+            spdlog::warn("ChangedObjectRegistry: Cannot update transform for unregistered key: {}", update.formKey);
+            continue;
+        }
+
+        it->second.currentTransform = update.currentTransform;
+        it->second.locationName = update.locationName;
+        it->second.hasPendingExportChanges = true;
+        RecordExportState(it->second, update.currentTransform, update.eulerAngles);
+    }
+
+    spdlog::trace("ChangedObjectRegistry: Updated current transforms for {} objects", updates.size());
+}
+
 std::vector<std::pair<std::string, const ChangedObjectRuntimeData*>>
 ChangedObjectRegistry::GetPendingExportEntries() const
 {
@@ -319,6 +533,41 @@ void ChangedObjectRegistry::ClearPendingExportFlagsForCreatedObjects()
     spdlog::trace("ChangedObjectRegistry: Cleared pending export flags on {} created objects", cleared);
 }
 
+std::vector<std::pair<std::string, ChangedObjectRuntimeData>>
+ChangedObjectRegistry::TakePendingExportEntriesOutside(const std::string& keepCellFormKey)
+{
+    std::unique_lock lock(m_mutex);
+
+    std::vector<std::pair<std::string, ChangedObjectRuntimeData>> taken;
+    for (auto& [key, data] : m_entries) {
+        const std::string& cellFormKey = data.saveData.cellFormKey;
+        if (!data.hasPendingExportChanges || cellFormKey.empty() || cellFormKey == keepCellFormKey) {
+            continue;
+        }
+        data.hasPendingExportChanges = false;
+        taken.emplace_back(key, data);
+    }
+
+    spdlog::trace("ChangedObjectRegistry: Took {} pending entries outside cell {}", taken.size(), keepCellFormKey);
+    return taken;
+}
+
+void ChangedObjectRegistry::MarkPendingExport(const std::vector<std::string>& formKeys)
+{
+    std::unique_lock lock(m_mutex);
+
+    size_t marked = 0;
+    for (const auto& formKey : formKeys) {
+        auto it = m_entries.find(formKey);
+        if (it != m_entries.end()) {
+            it->second.hasPendingExportChanges = true;
+            marked++;
+        }
+    }
+
+    spdlog::trace("ChangedObjectRegistry: Marked {} of {} entries as pending export", marked, formKeys.size());
+}
+
 std::optional<ChangedObjectSaveGameData> ChangedObjectRegistry::GetOriginalState(
     const std::string& formKey) const
 {
@@ -370,6 +619,24 @@ ChangedObjectRegistry::ExtractEntriesForCell(const std::string& cellFormKey)
     return extracted;
 }
 
+void ChangedObjectRegistry::ReinsertEntries(std::vector<std::pair<std::string, ChangedObjectRuntimeData>>&& entries)
+{
+    if (entries.empty()) {
+        return;
+    }
+
+    std::unique_lock lock(m_mutex);
+
+    size_t reinserted = 0;
+    for (auto& [formKey, data] : entries) {
+        if (m_entries.try_emplace(formKey, std::move(data)).second) {
+            reinserted++;
+        }
+    }
+
+    spdlog::info("ChangedObjectRegistry: Reinserted {} of {} extracted entries", reinserted, entries.size());
+}
+
 const std::unordered_map<std::string, ChangedObjectRuntimeData>&
 ChangedObjectRegistry::GetAllEntries() const
 {
@@ -397,6 +664,61 @@ void ChangedObjectRegistry::LoadEntries(std::vector<ChangedObjectSaveGameData>&&
     spdlog::info("ChangedObjectRegistry: Loaded {} entries from save game", loadedCount);
 }
 
+size_t ChangedObjectRegistry::CaptureRestoredExportRecords()
+{
+    // Entries still without a record; the game reads happen outside the lock
+    std::vector<std::pair<std::string, bool>> restored;  // formKey, wasCreated
+    {
+        std::shared_lock lock(m_mutex);
+        for (const auto& [formKey, data] : m_entries) {
+            if (!data.exportRecord.captured) {
+                restored.emplace_back(formKey, data.saveData.wasCreated);
+            }
+        }
+    }
+
+    if (restored.empty()) {
+        return 0;
+    }
+
+    auto* metadataCache = BaseFormMetadataCache::GetSingleton();
+    std::vector<std::pair<std::string, ChangedObjectExportRecord>> records;
+    records.reserve(restored.size());
+    for (auto& [formKey, wasCreated] : restored) {
+        const RE::FormID runtimeId = FormKeyUtil::ResolveToRuntimeFormID(formKey);
+        auto* ref = runtimeId != 0 ? RE::TESForm::LookupByID<RE::TESObjectREFR>(runtimeId) : nullptr;
+        if (!ref) {
+            spdlog::trace("ChangedObjectRegistry: {} is not loaded, its export record waits for the next edit",
+                formKey);
+            continue;
+        }
+
+        // The save restored the edited reference, so its game data is what the export writes
+        auto record = ExportBuilder::CaptureRecord(ref->GetPosition(), ref->GetAngle(), ref->GetScale());
+        // Created objects are written as their base object (AddedObjects), the rest as references (BOS)
+        record.metadata = wasCreated ? metadataCache->Get(ref->GetBaseObject()) : metadataCache->GetForReference(ref);
+        records.emplace_back(std::move(formKey), std::move(record));
+    }
+
+    size_t captured = 0;
+    {
+        std::unique_lock lock(m_mutex);
+        for (auto& [formKey, record] : records) {
+            // An edit in between has captured a newer record
+            auto it = m_entries.find(formKey);
+            if (it == m_entries.end() || it->second.exportRecord.captured) {
+                continue;
+            }
+            it->second.exportRecord = std::move(record);
+            captured++;
+        }
+    }
+
+    spdlog::info("ChangedObjectRegistry: Captured export records for {} of {} restored entries",
+        captured, restored.size());
+    return captured;
+}
+
 void ChangedObjectRegistry::Clear()
 {
     std::unique_lock lock(m_mutex);
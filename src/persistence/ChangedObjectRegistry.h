@@ -1,8 +1,13 @@
 #pragma once
 
+#include "EntryMetadata.h"
 #include "../util/UUID.h"
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/N/NiTransform.h>
 #include <RE/F/FormTypes.h>
+#else
+#include "TestStubs.h"
+#endif
 #include <string>
 #include <unordered_map>
 #include <optional>
@@ -28,6 +33,18 @@ struct ChangedObjectSaveGameData {
     ChangedObjectSaveGameData() = default;
 };
 
+// Export-ready state of an object, captured when it is edited
+// Holds exactly what the BOS / AddedObjects lines contain, so building the INI
+// entries (see ExportBuilder) needs no game lookups and can run off the main thread
+struct ChangedObjectExportRecord {
+    RE::NiPoint3 position;               // ref->data.location after the edit
+    RE::NiPoint3 angleDegrees;           // ref->data.angle after the edit, degrees in [-180, 180]
+    float scale = 1.0f;
+    EntryMetadata metadata;              // Comment metadata (reference for BOS, base object for AddedObjects)
+    bool captured = false;               // False for entries loaded from a save until CaptureRestoredExportRecords
+                                         // or an edit captures them
+};
+
 // Runtime data including non-serialized fields
 // Contains the serializable data plus session-specific tracking
 struct ChangedObjectRuntimeData {
@@ -40,6 +57,7 @@ struct ChangedObjectRuntimeData {
     RE::NiTransform currentTransform;    // Current transform (for BOS export)
     std::string locationName;            // Location name for INI file grouping
     bool hasPendingExportChanges = false;// True if currentTransform differs from last export
+    ChangedObjectExportRecord exportRecord;  // Captured alongside currentTransform
 
     ChangedObjectRuntimeData() = default;
 };
@@ -77,6 +95,13 @@ public:
                        const RE::NiTransform& originalTransform,
                        const Util::ActionId& actionId);
 
+    // Batch form of RegisterIfNew - reads the game for all objects first, then takes
+    // the registry lock once to insert them
+    // Used by MultiTransformAction and scripted bulk edits (hundreds of refs at a time)
+    // Returns the number of objects that were newly registered
+    size_t RegisterIfNewBatch(const std::vector<std::pair<RE::TESObjectREFR*, RE::NiTransform>>& objects,
+                              const Util::ActionId& actionId);
+
     // Register a deleted object
     // Called when DeleteAction is created
     // Stores additional baseFormId for potential object recreation
@@ -97,6 +122,18 @@ public:
                                const RE::NiTransform& transform,
                                const Util::ActionId& actionId);
 
+    // One object of a batch RegisterCreatedObjects call
+    struct CreatedObjectRecord {
+        RE::TESObjectREFR* ref = nullptr;
+        RE::FormID baseFormId = 0;
+        RE::NiTransform transform;
+    };
+
+    // Batch form of RegisterCreatedObject - takes the registry lock once (bulk duplication)
+    // Returns the number of objects registered
+    size_t RegisterCreatedObjects(const std::vector<CreatedObjectRecord>& objects,
+                                  const Util::ActionId& actionId);
+
     // ========== Undo Integration ==========
 
     // Called when an action is undone
@@ -123,10 +160,24 @@ public:
     // Update the current transform of an object
     // Marks the entry as having pending export changes
     // Also updates the location name for INI file grouping
+    // eulerAngles: the game angles (radians) the edit applies - recorded for export
+    // together with the transform's position and scale
     void UpdateCurrentTransform(const std::string& formKey,
                                 const RE::NiTransform& currentTransform,
+                                const RE::NiPoint3& eulerAngles,
                                 std::string_view locationName);
 
+    // One entry of a batch transform update
+    struct TransformUpdate {
+        std::string formKey;
+        RE::NiTransform currentTransform;
+        RE::NiPoint3 eulerAngles;
+        std::string locationName;
+    };
+
+    // Batch form of UpdateCurrentTransform - takes the registry lock once
+    void UpdateCurrentTransforms(const std::vector<TransformUpdate>& updates);
+
     // Get all entries that have pending export changes
     // Used by BaseObjectSwapperExporter to determine what to write
     std::vector<std::pair<std::string, const ChangedObjectRuntimeData*>> GetPendingExportEntries() const;
@@ -137,6 +188,16 @@ public:
     // Clear pending export flags for created objects only (called after AddedObjects export)
     void ClearPendingExportFlagsForCreatedObjects();
 
+    // Take copies of the pending entries of every cell except keepCellFormKey and
+    // clear their flags (used by CellExportWriter to export cells the player left)
+    // Entries without a stored cell stay pending for the save-time export
+    std::vector<std::pair<std::string, ChangedObjectRuntimeData>> TakePendingExportEntriesOutside(
+        const std::string& keepCellFormKey);
+
+    // Set the pending export flag again, e.g. after a background write failed
+    // Keys no longer in the registry are ignored
+    void MarkPendingExport(const std::vector<std::string>& formKeys);
+
     // ========== Query ==========
 
     // Get the original state of an object if it exists in registry
@@ -152,6 +213,10 @@ public:
     std::vector<std::pair<std::string, ChangedObjectRuntimeData>> ExtractEntriesForCell(
         const std::string& cellFormKey);
 
+    // Put back entries previously taken out by ExtractEntriesForCell (e.g. a cancelled cell reset)
+    // Keys that were re-registered in the meantime keep their newer entry
+    void ReinsertEntries(std::vector<std::pair<std::string, ChangedObjectRuntimeData>>&& entries);
+
     // ========== Serialization Support ==========
 
     // Get all entries for serialization
@@ -161,6 +226,12 @@ public:
     // Loaded entries have createdThisSession=false and invalid ActionId
     void LoadEntries(std::vector<ChangedObjectSaveGameData>&& entries);
 
+    // Capture the export records of loaded entries from their references
+    // Called from PostLoadGame, once the references resolve. Entries whose reference
+    // is not loaded keep captured=false until their next edit.
+    // Returns the number of records captured
+    size_t CaptureRestoredExportRecords();
+
     // Clear all entries (called on game revert)
     void Clear();
 
@@ -170,6 +241,23 @@ private:
     ChangedObjectRegistry(const ChangedObjectRegistry&) = delete;
     ChangedObjectRegistry& operator=(const ChangedObjectRegistry&) = delete;
 
+    // Build a new entry for ref, capturing its parent cell and metadata (no lock needed)
+    ChangedObjectRuntimeData BuildEntry(RE::TESObjectREFR* ref,
+                                        const std::string& formKey,
+                                        const RE::NiTransform& originalTransform,
+                                        const Util::ActionId& actionId) const;
+
+    // Capture the export record for a new current transform (caller holds the unique lock)
+    static void RecordExportState(ChangedObjectRuntimeData& data,
+                                  const RE::NiTransform& transform,
+                                  const RE::NiPoint3& eulerAngles);
+
+    // Build the entry for a reference created by this mod (no lock needed)
+    ChangedObjectRuntimeData BuildCreatedEntry(RE::TESObjectREFR* ref,
+                                               RE::FormID baseFormId,
+                                               const RE::NiTransform& transform,
+                                               const Util::ActionId& actionId) const;
+
     // Map of formKey -> runtime data
     // Key is the stable form key string (e.g., "0x10C0E3~Skyrim.esm")
     std::unordered_map<std::string, ChangedObjectRuntimeData> m_entries;
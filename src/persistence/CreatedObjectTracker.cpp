@@ -5,6 +5,7 @@
 #include <RE/T/TESBoundObject.h>
 #include <RE/T/TESWorldSpace.h>
 #include <RE/P/PlayerCharacter.h>
+#include <algorithm>
 #include <cmath>
 #include <fmt/format.h>
 
@@ -29,13 +30,9 @@ CreatedObjectTracker* CreatedObjectTracker::GetSingleton()
     return &instance;
 }
 
-void CreatedObjectTracker::Add(RE::TESObjectREFR* ref, RE::FormID baseFormId, const std::string& cellFormKey)
+TrackedCreatedObject CreatedObjectTracker::MakeTrackedObject(RE::TESObjectREFR* ref, RE::FormID baseFormId,
+                                                             const std::string& cellFormKey)
 {
-    if (!ref) {
-        spdlog::warn("CreatedObjectTracker::Add - null ref");
-        return;
-    }
-
     TrackedCreatedObject obj;
     obj.baseFormId = baseFormId;
     obj.cellFormKey = cellFormKey;
@@ -51,31 +48,136 @@ void CreatedObjectTracker::Add(RE::TESObjectREFR* ref, RE::FormID baseFormId, co
 
     obj.scale = ref->GetScale();
     obj.currentRefHandle = ref->GetHandle();
+    return obj;
+}
 
-    std::unique_lock lock(m_mutex);
+int32_t CreatedObjectTracker::Quantize(float value)
+{
+    return static_cast<int32_t>(std::floor(value / kBucketSize));
+}
 
+uint64_t CreatedObjectTracker::BucketKey(int32_t x, int32_t y, int32_t z)
+{
+    // 21 bits per axis covers +-2M buckets; wrap-around only costs an extra compare
+    constexpr uint64_t mask = (1ull << 21) - 1;
+    return ((static_cast<uint64_t>(x) & mask) << 42) |
+           ((static_cast<uint64_t>(y) & mask) << 21) |
+           (static_cast<uint64_t>(z) & mask);
+}
+
+uint64_t CreatedObjectTracker::BucketKey(const RE::NiPoint3& position)
+{
+    return BucketKey(Quantize(position.x), Quantize(position.y), Quantize(position.z));
+}
+
+void CreatedObjectTracker::IndexLocked(CellObjects& cell, uint32_t index)
+{
+    const auto& obj = cell.objects[index];
+    cell.buckets[BucketKey(obj.position)].push_back(index);
+    m_keyIndex.insert_or_assign(obj.GetUniqueKey(), KeyLocation{ &cell, index });
+}
+
+void CreatedObjectTracker::UnindexLocked(CellObjects& cell, uint32_t index)
+{
+    const auto& obj = cell.objects[index];
+
+    auto bucketIt = cell.buckets.find(BucketKey(obj.position));
+    if (bucketIt != cell.buckets.end()) {
+        auto& slots = bucketIt->second;
+        auto slot = std::find(slots.begin(), slots.end(), index);
+        if (slot != slots.end()) {
+            *slot = slots.back();
+            slots.pop_back();
+        }
+        if (slots.empty()) {
+            cell.buckets.erase(bucketIt);
+        }
+    }
+
+    // Only drop the key if it still points here (DeleteForCell can move two objects onto one key)
+    auto keyIt = m_keyIndex.find(obj.GetUniqueKey());
+    if (keyIt != m_keyIndex.end() && keyIt->second.cell == &cell && keyIt->second.index == index) {
+        m_keyIndex.erase(keyIt);
+    }
+}
+
+void CreatedObjectTracker::EraseLocked(CellObjects& cell, uint32_t index)
+{
+    const auto last = static_cast<uint32_t>(cell.objects.size() - 1);
+
+    UnindexLocked(cell, index);
+    if (index != last) {
+        // Move the last object into the hole and re-point its index entries
+        UnindexLocked(cell, last);
+        cell.objects[index] = std::move(cell.objects[last]);
+        cell.objects.pop_back();
+        IndexLocked(cell, index);
+    } else {
+        cell.objects.pop_back();
+    }
+
+    m_totalCount--;
+}
+
+bool CreatedObjectTracker::AddLocked(TrackedCreatedObject&& obj)
+{
     // Check for duplicates by position
-    auto& cellObjects = m_objectsByCell[cellFormKey];
-    std::string key = obj.GetUniqueKey();
-
-    for (const auto& existing : cellObjects) {
-        if (existing.GetUniqueKey() == key) {
-            spdlog::trace("CreatedObjectTracker::Add - duplicate at position, updating ref");
-            // Update the ref handle for existing entry
-            for (auto& o : cellObjects) {
-                if (o.GetUniqueKey() == key) {
-                    o.currentRefHandle = ref->GetHandle();
-                    break;
-                }
-            }
-            return;
+    auto keyIt = m_keyIndex.find(obj.GetUniqueKey());
+    if (keyIt != m_keyIndex.end()) {
+        spdlog::trace("CreatedObjectTracker::Add - duplicate at position, updating ref");
+        // Update the ref handle for existing entry
+        auto& location = keyIt->second;
+        location.cell->objects[location.index].currentRefHandle = obj.currentRefHandle;
+        return false;
+    }
+
+    auto& cell = m_objectsByCell[obj.cellFormKey];
+    cell.objects.push_back(std::move(obj));
+    IndexLocked(cell, static_cast<uint32_t>(cell.objects.size() - 1));
+    m_totalCount++;
+    return true;
+}
+
+void CreatedObjectTracker::Add(RE::TESObjectREFR* ref, RE::FormID baseFormId, const std::string& cellFormKey)
+{
+    if (!ref) {
+        spdlog::warn("CreatedObjectTracker::Add - null ref");
+        return;
+    }
+
+    TrackedCreatedObject obj = MakeTrackedObject(ref, baseFormId, cellFormKey);
+    const RE::NiPoint3 position = obj.position;
+
+    std::unique_lock lock(m_mutex);
+
+    if (AddLocked(std::move(obj))) {
+        spdlog::info("CreatedObjectTracker::Add - tracking {:08X} (base {:08X}) in cell {} at ({:.1f}, {:.1f}, {:.1f})",
+            ref->GetFormID(), baseFormId, cellFormKey, position.x, position.y, position.z);
+    }
+}
+
+void CreatedObjectTracker::AddBatch(const std::vector<PendingAdd>& objects)
+{
+    // Snapshot placements before taking the lock
+    std::vector<TrackedCreatedObject> tracked;
+    tracked.reserve(objects.size());
+    for (const auto& pending : objects) {
+        if (pending.ref && !pending.cellFormKey.empty()) {
+            tracked.push_back(MakeTrackedObject(pending.ref, pending.baseFormId, pending.cellFormKey));
         }
     }
 
-    cellObjects.push_back(std::move(obj));
+    size_t added = 0;
+    {
+        std::unique_lock lock(m_mutex);
+        for (auto& obj : tracked) {
+            if (AddLocked(std::move(obj))) {
+                added++;
+            }
+        }
+    }
 
-    spdlog::info("CreatedObjectTracker::Add - tracking {:08X} (base {:08X}) in cell {} at ({:.1f}, {:.1f}, {:.1f})",
-        ref->GetFormID(), baseFormId, cellFormKey, obj.position.x, obj.position.y, obj.position.z);
+    spdlog::info("CreatedObjectTracker::AddBatch - tracking {} new objects ({} submitted)", added, objects.size());
 }
 
 void CreatedObjectTracker::Remove(RE::TESObjectREFR* ref)
@@ -85,12 +187,12 @@ void CreatedObjectTracker::Remove(RE::TESObjectREFR* ref)
     std::unique_lock lock(m_mutex);
 
     auto handleToRemove = ref->GetHandle();
-    for (auto& [cellKey, objects] : m_objectsByCell) {
-        for (auto it = objects.begin(); it != objects.end(); ++it) {
-            if (it->currentRefHandle == handleToRemove) {
+    for (auto& [cellKey, cell] : m_objectsByCell) {
+        for (size_t i = 0; i < cell.objects.size(); ++i) {
+            if (cell.objects[i].currentRefHandle == handleToRemove) {
                 spdlog::info("CreatedObjectTracker::Remove - removed {:08X} from cell {}",
                     ref->GetFormID(), cellKey);
-                objects.erase(it);
+                EraseLocked(cell, static_cast<uint32_t>(i));
                 return;
             }
         }
@@ -103,15 +205,15 @@ void CreatedObjectTracker::RemoveByKey(const std::string& key)
 {
     std::unique_lock lock(m_mutex);
 
-    for (auto& [cellKey, objects] : m_objectsByCell) {
-        for (auto it = objects.begin(); it != objects.end(); ++it) {
-            if (it->GetUniqueKey() == key) {
-                spdlog::info("CreatedObjectTracker::RemoveByKey - removed {} from cell {}", key, cellKey);
-                objects.erase(it);
-                return;
-            }
-        }
+    auto it = m_keyIndex.find(key);
+    if (it == m_keyIndex.end()) {
+        return;
     }
+
+    KeyLocation location = it->second;
+    spdlog::info("CreatedObjectTracker::RemoveByKey - removed {} from cell {}",
+        key, location.cell->objects[location.index].cellFormKey);
+    EraseLocked(*location.cell, location.index);
 }
 
 bool CreatedObjectTracker::IsTracked(const std::string& cellFormKey, const RE::NiPoint3& position) const
@@ -124,13 +226,28 @@ bool CreatedObjectTracker::IsTracked(const std::string& cellFormKey, const RE::N
     }
 
     // Check if position matches (with small tolerance)
-    constexpr float tolerance = 1.0f;
-    for (const auto& obj : it->second) {
-        float dx = std::abs(obj.position.x - position.x);
-        float dy = std::abs(obj.position.y - position.y);
-        float dz = std::abs(obj.position.z - position.z);
-        if (dx < tolerance && dy < tolerance && dz < tolerance) {
-            return true;
+    // Only the buckets overlapping the tolerance box can hold a match - at most 2 per axis
+    const auto& cell = it->second;
+    const int32_t minX = Quantize(position.x - kPositionTolerance), maxX = Quantize(position.x + kPositionTolerance);
+    const int32_t minY = Quantize(position.y - kPositionTolerance), maxY = Quantize(position.y + kPositionTolerance);
+    const int32_t minZ = Quantize(position.z - kPositionTolerance), maxZ = Quantize(position.z + kPositionTolerance);
+
+    for (int32_t bx = minX; bx <= maxX; ++bx) {
+        for (int32_t by = minY; by <= maxY; ++by) {
+            for (int32_t bz = minZ; bz <= maxZ; ++bz) {
+                auto bucketIt = cell.buckets.find(BucketKey(bx, by, bz));
+                if (bucketIt == cell.buckets.end()) continue;
+
+                for (uint32_t index : bucketIt->second) {
+                    const auto& obj = cell.objects[index];
+                    float dx = std::abs(obj.position.x - position.x);
+                    float dy = std::abs(obj.position.y - position.y);
+                    float dz = std::abs(obj.position.z - position.z);
+                    if (dx < kPositionTolerance && dy < kPositionTolerance && dz < kPositionTolerance) {
+                        return true;
+                    }
+                }
+            }
         }
     }
 
@@ -170,7 +287,7 @@ void CreatedObjectTracker::SpawnForCell(const std::string& cellFormKey, RE::TESO
     size_t spawnedCount = 0;
     size_t skippedCount = 0;
 
-    for (auto& obj : it->second) {
+    for (auto& obj : it->second.objects) {
         // Skip if already has a valid ref in world
         auto existingPtr = obj.currentRefHandle.get();
         if (auto* existingRef = existingPtr.get()) {
@@ -202,13 +319,19 @@ void CreatedObjectTracker::DeleteForCell(const std::string& cellFormKey)
         return;
     }
 
+    auto& cell = it->second;
     size_t deletedCount = 0;
-    for (auto& obj : it->second) {
+    for (uint32_t i = 0; i < cell.objects.size(); ++i) {
+        auto& obj = cell.objects[i];
+
         // Safely resolve handle - returns null if ref was deleted by engine
         auto refPtr = obj.currentRefHandle.get();
         if (auto* ref = refPtr.get()) {
             // Update stored transform before deletion
+            // The position feeds both indices - re-index around the change
+            UnindexLocked(cell, i);
             obj.position = ref->GetPosition();
+            IndexLocked(cell, i);
             RE::NiPoint3 angleRad = ref->GetAngle();
             obj.rotation = RE::NiPoint3(
                 angleRad.x * RAD_TO_DEG,
@@ -236,12 +359,14 @@ size_t CreatedObjectTracker::RemoveForCell(const std::string& cellFormKey)
         return 0;
     }
 
-    size_t removedCount = it->second.size();
-    for (auto& obj : it->second) {
+    size_t removedCount = it->second.objects.size();
+    for (auto& obj : it->second.objects) {
         DeleteObject(obj);
+        m_keyIndex.erase(obj.GetUniqueKey());
     }
 
     m_objectsByCell.erase(it);
+    m_totalCount -= removedCount;
 
     if (removedCount > 0) {
         spdlog::info("CreatedObjectTracker::RemoveForCell - removed {} objects from cell {}", removedCount, cellFormKey);
@@ -253,19 +378,15 @@ size_t CreatedObjectTracker::RemoveForCell(const std::string& cellFormKey)
 size_t CreatedObjectTracker::GetCount() const
 {
     std::shared_lock lock(m_mutex);
-    size_t total = 0;
-    for (const auto& [key, objects] : m_objectsByCell) {
-        total += objects.size();
-    }
-    return total;
-}
+    return m_totalCount;
+}
 
 size_t CreatedObjectTracker::GetCountForCell(const std::string& cellFormKey) const
 {
     std::shared_lock lock(m_mutex);
     auto it = m_objectsByCell.find(cellFormKey);
     if (it != m_objectsByCell.end()) {
-        return it->second.size();
+        return it->second.objects.size();
     }
     return 0;
 }
@@ -274,12 +395,11 @@ void CreatedObjectTracker::Clear()
 {
     std::unique_lock lock(m_mutex);
 
-    size_t count = 0;
-    for (const auto& [key, objects] : m_objectsByCell) {
-        count += objects.size();
-    }
+    size_t count = m_totalCount;
 
     m_objectsByCell.clear();
+    m_keyIndex.clear();
+    m_totalCount = 0;
     spdlog::info("CreatedObjectTracker::Clear - cleared {} tracked objects", count);
 }
 
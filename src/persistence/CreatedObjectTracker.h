@@ -1,6 +1,7 @@
 #pragma once
 
 #include <RE/Skyrim.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -33,6 +34,10 @@ struct TrackedCreatedObject {
 // - Objects are created with forcePersist=true so the game handles save/load
 //
 // Note: This is separate from ChangedObjectRegistry which handles INI export.
+//
+// Lookups: each cell keeps a spatial hash of its objects on quantized position
+// buckets (kBucketSize units per side), and a global index maps unique keys to
+// their slot, so IsTracked, duplicate detection and RemoveByKey don't scan.
 class CreatedObjectTracker {
 public:
     static CreatedObjectTracker* GetSingleton();
@@ -43,6 +48,16 @@ public:
     // Called by CopyHandler, Gallery, AddedObjectsSpawner after creating a ref
     void Add(RE::TESObjectREFR* ref, RE::FormID baseFormId, const std::string& cellFormKey);
 
+    // One object of a batch add
+    struct PendingAdd {
+        RE::TESObjectREFR* ref = nullptr;
+        RE::FormID baseFormId = 0;
+        std::string cellFormKey;
+    };
+
+    // Batch form of Add - takes the tracker lock once (used by bulk duplication)
+    void AddBatch(const std::vector<PendingAdd>& objects);
+
     // Remove an object from tracking (e.g., when deleted by user)
     // Matches by currentRefHandle
     void Remove(RE::TESObjectREFR* ref);
@@ -51,6 +66,7 @@ public:
     void RemoveByKey(const std::string& key);
 
     // Check if an object at this position is already tracked
+    // Matches within kPositionTolerance on every axis
     bool IsTracked(const std::string& cellFormKey, const RE::NiPoint3& position) const;
 
     // ========== Save Hooks (legacy, now no-ops) ==========
@@ -86,6 +102,13 @@ public:
     // Clear all tracking (called on game revert/new game)
     void Clear();
 
+    // Per-axis distance below which IsTracked treats two positions as the same object
+    static constexpr float kPositionTolerance = 1.0f;
+
+    // Side length of a spatial hash bucket - twice the tolerance, so a lookup
+    // touches at most 2 buckets per axis
+    static constexpr float kBucketSize = 2.0f * kPositionTolerance;
+
 private:
     CreatedObjectTracker() = default;
     ~CreatedObjectTracker() = default;
@@ -101,10 +124,50 @@ private:
     // Get cell from FormKey
     RE::TESObjectCELL* ResolveCellFromFormKey(const std::string& cellFormKey) const;
 
+    // Snapshot a created reference's placement (no lock needed)
+    static TrackedCreatedObject MakeTrackedObject(RE::TESObjectREFR* ref, RE::FormID baseFormId,
+                                                  const std::string& cellFormKey);
+
+    // Insert or refresh a tracked object; caller holds the unique lock
+    // Returns false if an object at the same position was already tracked
+    bool AddLocked(TrackedCreatedObject&& obj);
+
+    // Objects of one cell plus a spatial hash over their positions
+    struct CellObjects {
+        std::vector<TrackedCreatedObject> objects;
+
+        // Packed bucket coordinates -> indices into objects
+        std::unordered_map<uint64_t, std::vector<uint32_t>> buckets;
+    };
+
+    // Slot of an object, by unique key
+    // CellObjects pointers stay valid - unordered_map never moves its values
+    struct KeyLocation {
+        CellObjects* cell = nullptr;
+        uint32_t index = 0;
+    };
+
+    static int32_t Quantize(float value);
+    static uint64_t BucketKey(int32_t x, int32_t y, int32_t z);
+    static uint64_t BucketKey(const RE::NiPoint3& position);
+
+    // Add/remove objects[index] to/from the bucket and key indices; caller holds the unique lock
+    void IndexLocked(CellObjects& cell, uint32_t index);
+    void UnindexLocked(CellObjects& cell, uint32_t index);
+
+    // Swap-and-pop removal that keeps both indices consistent; caller holds the unique lock
+    void EraseLocked(CellObjects& cell, uint32_t index);
+
     // ========== Data ==========
 
     // All tracked objects, indexed by cell FormKey for fast lookup
-    std::unordered_map<std::string, std::vector<TrackedCreatedObject>> m_objectsByCell;
+    std::unordered_map<std::string, CellObjects> m_objectsByCell;
+
+    // Unique key -> slot, for O(1) duplicate detection and RemoveByKey
+    std::unordered_map<std::string, KeyLocation> m_keyIndex;
+
+    // Number of tracked objects across all cells
+    size_t m_totalCount = 0;
 
     // Thread safety
     mutable std::shared_mutex m_mutex;
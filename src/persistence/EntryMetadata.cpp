@@ -1,6 +1,7 @@
 #include "EntryMetadata.h"
-#include <sstream>
+#include "IniLineFormat.h"
 #include <algorithm>
+#include <array>
 
 namespace Persistence {
 
@@ -8,9 +9,9 @@ std::string EntryMetadata::ToCommentLine() const
 {
     // Format: ; EditorId|DisplayName|MeshPath|FormType
     // Empty fields are preserved as empty strings between pipes
-    std::ostringstream ss;
-    ss << "; " << editorId << "|" << displayName << "|" << meshName << "|" << formTypeName;
-    return ss.str();
+    std::string line;
+    IniLineFormat::AppendCommentLine(line, editorId, displayName, meshName, formTypeName);
+    return line;
 }
 
 bool EntryMetadata::ParseFromComment(std::string_view commentLine, EntryMetadata& outMetadata)
@@ -34,35 +35,36 @@ bool EntryMetadata::ParseFromComment(std::string_view commentLine, EntryMetadata
         return false;
     }
 
-    // Split by '|'
-    std::vector<std::string> fields;
-    std::string contentStr(content);
-    std::istringstream ss(contentStr);
-    std::string field;
+    // Split by '|' into views of the line; only the first four fields are used
+    std::array<std::string_view, 4> fields;
+    size_t fieldCount = 0;
+    while (fieldCount < fields.size()) {
+        const size_t pipe = content.find('|');
+        std::string_view field = content.substr(0, pipe);
 
-    while (std::getline(ss, field, '|')) {
         // Trim whitespace from field
-        size_t start = field.find_first_not_of(" \t");
-        size_t end = field.find_last_not_of(" \t");
-        if (start != std::string::npos && end != std::string::npos) {
-            field = field.substr(start, end - start + 1);
+        const size_t start = field.find_first_not_of(" \t");
+        if (start == std::string_view::npos) {
+            field = {};
         } else {
-            field.clear();
+            field = field.substr(start, field.find_last_not_of(" \t") - start + 1);
         }
-        fields.push_back(field);
-    }
+        fields[fieldCount++] = field;
 
-    // Need at least 3 fields (editorId, displayName, meshName)
-    if (fields.size() < 3) {
-        return false;
+        if (pipe == std::string_view::npos) {
+            break;
+        }
+        content.remove_prefix(pipe + 1);
     }
 
+    // Need at least 3 fields (editorId, displayName, meshName) - guaranteed by the pipe count
+
     outMetadata.editorId = fields[0];
     outMetadata.displayName = fields[1];
     outMetadata.meshName = fields[2];
 
     // FormType is optional (4th field) - supports both old 3-field and new 4-field format
-    if (fields.size() >= 4) {
+    if (fieldCount >= 4) {
         outMetadata.formTypeName = fields[3];
     }
 
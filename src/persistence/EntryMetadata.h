@@ -1,5 +1,6 @@
 #pragma once
 
+#include "StringPool.h"
 #include <string>
 #include <string_view>
 #include <vector>
@@ -26,11 +27,14 @@ namespace Persistence {
 // 1 = DisplayName (no quotes)
 // 2 = MeshPath
 // 3 = FormType (e.g., "LIGH", "STAT", "ACTI" - only shown when other fields empty)
+//
+// Fields are InternedStrings (see StringPool.h): the same mesh path or name
+// repeated across a file is stored once.
 struct EntryMetadata {
-    std::string editorId;
-    std::string displayName;
-    std::string meshName;
-    std::string formTypeName;    // Form type code (e.g., "LIGH", "STAT")
+    InternedString editorId;
+    InternedString displayName;
+    InternedString meshName;
+    InternedString formTypeName;    // Form type code (e.g., "LIGH", "STAT")
 
     // Generate comment line in the standard format
     // Returns "; EditorId|DisplayName|MeshPath|FormType"
@@ -39,6 +43,8 @@ struct EntryMetadata {
     // Parse metadata from a comment line
     // Returns true if the line was a valid metadata comment
     // The line should start with "; " and contain pipe-separated fields
+    // Fields are sliced from the line and interned - nothing is copied for
+    // strings the pool already holds
     static bool ParseFromComment(std::string_view commentLine, EntryMetadata& outMetadata);
 
     // Check if all metadata fields are empty (excludes formType from check)
@@ -0,0 +1,177 @@
+#include "ExportBuilder.h"
+#include "../log.h"
+#include <cmath>
+
+namespace Persistence::ExportBuilder {
+
+namespace {
+    constexpr float RAD_TO_DEG = 180.0f / 3.14159265358979323846f;
+
+    // Same as the entries' SetMetadata - inlined so the tests do not need the parser sources
+    template <typename Entry>
+    void AssignMetadata(Entry& entry, const EntryMetadata& metadata)
+    {
+        entry.editorId = metadata.editorId;
+        entry.displayName = metadata.displayName;
+        entry.meshName = metadata.meshName;
+        entry.formTypeName = metadata.formTypeName;
+    }
+
+    // Record values, falling back to currentTransform for entries edited before capture existed
+    ChangedObjectExportRecord ResolveRecord(const ChangedObjectRuntimeData& data)
+    {
+        if (data.exportRecord.captured) {
+            return data.exportRecord;
+        }
+
+        RE::NiPoint3 eulerRadians;
+        data.currentTransform.rotate.ToEulerAnglesXYZ(eulerRadians);
+        ChangedObjectExportRecord record = CaptureRecord(data.currentTransform.translate, eulerRadians,
+                                                         data.currentTransform.scale);
+        record.metadata = data.exportRecord.metadata;
+        return record;
+    }
+}
+
+ChangedObjectExportRecord CaptureRecord(const RE::NiPoint3& position, const RE::NiPoint3& eulerRadians, float scale)
+{
+    ChangedObjectExportRecord record;
+    record.position = position;
+    record.angleDegrees = RadiansToDegrees(eulerRadians);
+    record.scale = scale;
+    record.captured = true;
+    return record;
+}
+
+float NormalizeAngleDegrees(float angle)
+{
+    // Wrap angle to -180 to +180 range
+    // BOS clamps to ±360°, but normalized angles are more predictable
+    angle = std::fmod(angle, 360.0f);
+    if (angle > 180.0f) {
+        angle -= 360.0f;
+    } else if (angle < -180.0f) {
+        angle += 360.0f;
+    }
+    return angle;
+}
+
+RE::NiPoint3 NormalizeAnglesDegrees(const RE::NiPoint3& angles)
+{
+    return RE::NiPoint3(
+        NormalizeAngleDegrees(angles.x),
+        NormalizeAngleDegrees(angles.y),
+        NormalizeAngleDegrees(angles.z)
+    );
+}
+
+RE::NiPoint3 RadiansToDegrees(const RE::NiPoint3& radians)
+{
+    return NormalizeAnglesDegrees(RE::NiPoint3(
+        radians.x * RAD_TO_DEG,
+        radians.y * RAD_TO_DEG,
+        radians.z * RAD_TO_DEG
+    ));
+}
+
+BOSTransformEntry ToBOSEntry(const std::string& formKey, const ChangedObjectRuntimeData& data)
+{
+    const ChangedObjectExportRecord record = ResolveRecord(data);
+
+    BOSTransformEntry entry;
+    entry.formKeyString = formKey;
+    entry.position = record.position;
+    entry.rotation = record.angleDegrees;
+    entry.scale = record.scale;
+    entry.isDeleted = data.saveData.wasDeleted;
+    AssignMetadata(entry, record.metadata);
+    return entry;
+}
+
+AddedObjectEntry ToAddedObjectEntry(const ChangedObjectRuntimeData& data)
+{
+    const ChangedObjectExportRecord record = ResolveRecord(data);
+
+    AddedObjectEntry entry;
+    // Prefer base form's EditorID, fallback to FormKey
+    if (!record.metadata.editorId.empty()) {
+        entry.baseFormString = record.metadata.editorId.str();
+    } else {
+        entry.baseFormString = data.saveData.baseFormKey;
+    }
+    entry.position = record.position;
+    entry.rotation = record.angleDegrees;
+    entry.scale = record.scale;
+    AssignMetadata(entry, record.metadata);
+    return entry;
+}
+
+CellGroups<BOSTransformEntry> GroupBOSEntries(const PendingEntries& entries)
+{
+    CellGroups<BOSTransformEntry> grouped;
+    size_t skippedCreated = 0;
+    size_t skippedNoCell = 0;
+
+    for (const auto& [formKey, data] : entries) {
+        // Skip objects that were created by this mod (e.g., via copy/duplicate)
+        // BOS is for modifying existing world objects, not for spawning new ones
+        if (data->saveData.wasCreated) {
+            skippedCreated++;
+            continue;
+        }
+
+        // Use stored cell info from the registry (captured at registration time)
+        const std::string& cellFormKey = data->saveData.cellFormKey;
+        if (cellFormKey.empty()) {
+            spdlog::trace("ExportBuilder: Skipping {} - no stored cell info", formKey);
+            skippedNoCell++;
+            continue;
+        }
+
+        auto& cellGroup = grouped[cellFormKey];
+        cellGroup.first = data->saveData.cellEditorId;
+        cellGroup.second.push_back(ToBOSEntry(formKey, *data));
+    }
+
+    spdlog::trace("ExportBuilder: Grouped {} BOS entries into {} cells ({} created, {} without cell skipped)",
+        entries.size() - skippedCreated - skippedNoCell, grouped.size(), skippedCreated, skippedNoCell);
+
+    return grouped;
+}
+
+CellGroups<AddedObjectEntry> GroupAddedObjectEntries(const PendingEntries& entries)
+{
+    CellGroups<AddedObjectEntry> grouped;
+    size_t groupedCount = 0;
+
+    for (const auto& [formKey, data] : entries) {
+        // Only process created objects
+        if (!data->saveData.wasCreated) {
+            continue;
+        }
+
+        // Use stored cell info from the registry (captured at registration time)
+        const std::string& cellFormKey = data->saveData.cellFormKey;
+        if (cellFormKey.empty()) {
+            spdlog::trace("ExportBuilder: Skipping {} - no stored cell info", formKey);
+            continue;
+        }
+
+        AddedObjectEntry addedEntry = ToAddedObjectEntry(*data);
+        if (addedEntry.baseFormString.empty()) {
+            spdlog::warn("ExportBuilder: Could not create entry for {} (no base form)", formKey);
+            continue;
+        }
+
+        auto& cellGroup = grouped[cellFormKey];
+        cellGroup.first = data->saveData.cellEditorId;
+        cellGroup.second.push_back(std::move(addedEntry));
+        groupedCount++;
+    }
+
+    spdlog::trace("ExportBuilder: Grouped {} AddedObjects entries into {} cells", groupedCount, grouped.size());
+
+    return grouped;
+}
+
+} // namespace Persistence::ExportBuilder
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "AddedObjectsParser.h"
+#include "BaseObjectSwapperParser.h"
+#include "ChangedObjectRegistry.h"
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Persistence {
+
+// ExportBuilder: Turns ChangedObjectRegistry data into INI entries
+//
+// Everything here is a pure function of the registry data - no form lookups,
+// no reads from loaded references. The game state the INI lines need is
+// captured into ChangedObjectExportRecord when an object is edited (see
+// ChangedObjectRegistry::UpdateCurrentTransform), so the exporters can build
+// their entries on any thread and the conversion is unit-tested on its own.
+namespace ExportBuilder {
+
+    // Entries grouped by cell: cellFormKey -> (cellEditorId, entries)
+    template <typename Entry>
+    using CellGroups = std::unordered_map<std::string, std::pair<std::string, std::vector<Entry>>>;
+
+    using PendingEntries = std::vector<std::pair<std::string, const ChangedObjectRuntimeData*>>;
+
+    // Export record for an object at position with the given game angles (radians) and scale
+    // Metadata is left for the caller to fill in
+    ChangedObjectExportRecord CaptureRecord(const RE::NiPoint3& position, const RE::NiPoint3& eulerRadians, float scale);
+
+    // Normalize angle to -180 to +180 degree range
+    // Ensures angles stay within BOS's ±360° clamp range
+    float NormalizeAngleDegrees(float angle);
+    RE::NiPoint3 NormalizeAnglesDegrees(const RE::NiPoint3& angles);
+
+    // Convert radians to degrees, normalized to -180 to +180
+    RE::NiPoint3 RadiansToDegrees(const RE::NiPoint3& radians);
+
+    // BOS entry for a changed (non-created) object
+    // Records that were never captured fall back to currentTransform
+    BOSTransformEntry ToBOSEntry(const std::string& formKey, const ChangedObjectRuntimeData& data);
+
+    // AddedObjects entry for a created object
+    // Base form is the base object's editor ID if known, else its FormKey;
+    // baseFormString stays empty if the registry has neither
+    AddedObjectEntry ToAddedObjectEntry(const ChangedObjectRuntimeData& data);
+
+    // Group pending registry entries by their registration-time cell
+    // BOS groups skip created objects, AddedObjects groups contain only created objects
+    // Entries without a stored cell are skipped
+    CellGroups<BOSTransformEntry> GroupBOSEntries(const PendingEntries& entries);
+    CellGroups<AddedObjectEntry> GroupAddedObjectEntries(const PendingEntries& entries);
+
+} // namespace ExportBuilder
+
+} // namespace Persistence
@@ -1,9 +1,11 @@
 #include "FormKeyUtil.h"
 #include "../log.h"
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/T/TESFile.h>
 #include <RE/T/TESDataHandler.h>
-#include <fmt/format.h>
+#endif
 #include <charconv>
+#include <format>
 
 namespace Persistence {
 
@@ -38,7 +40,7 @@ std::string FormKeyUtil::BuildFormKey(RE::TESForm* form)
 std::string FormKeyUtil::BuildFormKey(RE::FormID localFormId, std::string_view pluginName)
 {
     // Format: "0x[hex]~[name]"
-    return fmt::format("0x{:X}~{}", localFormId, pluginName);
+    return std::format("0x{:X}~{}", localFormId, pluginName);
 }
 
 std::optional<FormKeyUtil::ParsedKey> FormKeyUtil::ParseFormKey(std::string_view keyString)
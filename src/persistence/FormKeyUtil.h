@@ -1,8 +1,12 @@
 #pragma once
 
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/T/TESObjectREFR.h>
 #include <RE/T/TESForm.h>
 #include <RE/T/TESDataHandler.h>
+#else
+#include "TestStubs.h"
+#endif
 #include <string>
 #include <optional>
 
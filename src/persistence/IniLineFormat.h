@@ -0,0 +1,133 @@
+#pragma once
+
+#if !defined(TEST_ENVIRONMENT)
+#include <RE/N/NiPoint3.h>
+#else
+#include "TestStubs.h"
+#endif
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Persistence::IniLineFormat {
+
+// Shared text formatting for the INI writers (AddedObjects and BOS _SWAP files)
+//
+// Everything appends to a caller-owned std::string so a writer can reuse one
+// buffer for all its lines. Output is byte-for-byte what the previous
+// ostringstream implementation produced (std::fixed, setprecision(4), trailing
+// zeros trimmed) - see Tests/test_ini_line_format.cpp and its golden file.
+
+// Append value with up to 4 decimals, trailing zeros (and a bare '.') removed
+// e.g. 1.5 -> "1.5", 2.0 -> "2", -0.00001 -> "-0"
+inline void AppendFloat(std::string& out, float value)
+{
+    // Widest fixed output of a float: sign + 39 integer digits + '.' + 4 decimals
+    char buffer[64];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<double>(value),
+                                   std::chars_format::fixed, 4);
+    if (ec != std::errc{}) {
+        out += '0';
+        return;
+    }
+
+    std::string_view text(buffer, static_cast<size_t>(end - buffer));
+    if (const size_t dotPos = text.find('.'); dotPos != std::string_view::npos) {
+        const size_t lastNonZero = text.find_last_not_of('0');
+        text = lastNonZero > dotPos ? text.substr(0, lastNonZero + 1) : text.substr(0, dotPos);
+    }
+    out += text;
+}
+
+inline std::string FormatFloat(float value)
+{
+    std::string result;
+    AppendFloat(result, value);
+    return result;
+}
+
+// Append "0x" followed by value as 8 lowercase hex digits
+inline void AppendHex32(std::string& out, uint32_t value)
+{
+    char buffer[8];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value, 16);
+    const size_t digits = ec == std::errc{} ? static_cast<size_t>(end - buffer) : 0;
+
+    out += "0x";
+    out.append(8 - digits, '0');
+    out.append(buffer, digits);
+}
+
+// Append "posA(x,y,z),rotA(rx,ry,rz)" plus ",scaleA(s)" when scale differs from 1
+inline void AppendTransform(std::string& out, const RE::NiPoint3& position, const RE::NiPoint3& rotation,
+                            float scale)
+{
+    out += "posA(";
+    AppendFloat(out, position.x);
+    out += ',';
+    AppendFloat(out, position.y);
+    out += ',';
+    AppendFloat(out, position.z);
+
+    out += "),rotA(";
+    AppendFloat(out, rotation.x);
+    out += ',';
+    AppendFloat(out, rotation.y);
+    out += ',';
+    AppendFloat(out, rotation.z);
+    out += ')';
+
+    if (std::abs(scale - 1.0f) > 0.0001f) {
+        out += ",scaleA(";
+        AppendFloat(out, scale);
+        out += ')';
+    }
+}
+
+// Append "; EditorId|DisplayName|MeshPath|FormType" (EntryMetadata comment format)
+inline void AppendCommentLine(std::string& out, std::string_view editorId, std::string_view displayName,
+                              std::string_view meshName, std::string_view formTypeName)
+{
+    out += "; ";
+    out += editorId;
+    out += '|';
+    out += displayName;
+    out += '|';
+    out += meshName;
+    out += '|';
+    out += formTypeName;
+}
+
+// AddedObjects line: "baseForm|posA(x,y,z),rotA(rx,ry,rz),scaleA(s)"
+inline void AppendAddedObjectLine(std::string& out, std::string_view baseFormString,
+                                  const RE::NiPoint3& position, const RE::NiPoint3& rotation, float scale)
+{
+    out += baseFormString;
+    out += '|';
+    AppendTransform(out, position, rotation, scale);
+}
+
+// BOS line: "formKey|posA(x,y,z),rotA(rx,ry,rz),scaleA(s),flags(0x...)|100"
+// flags=0 omits the flags() property
+inline void AppendSwapLine(std::string& out, std::string_view formKeyString,
+                           const RE::NiPoint3& position, const RE::NiPoint3& rotation, float scale,
+                           uint32_t flags)
+{
+    out += formKeyString;
+    out += '|';
+    AppendTransform(out, position, rotation, scale);
+
+    if (flags != 0) {
+        out += ",flags(";
+        AppendHex32(out, flags);
+        out += ')';
+    }
+
+    // Chance is always 100
+    out += "|100";
+}
+
+} // namespace Persistence::IniLineFormat
@@ -3,9 +3,12 @@
 #include "CreatedObjectTracker.h"
 #include "BaseObjectSwapperExporter.h"
 #include "AddedObjectsExporter.h"
+#include "CellExportWriter.h"
+#include "CellResetJob.h"
 #include "../config/ConfigStorage.h"
 #include "../config/ConfigOptions.h"
 #include "../gallery/GalleryManager.h"
+#include "../util/Profiler.h"
 #include "../log.h"
 #include <algorithm>
 #include <chrono>
@@ -46,14 +49,23 @@ void SaveGameDataManager::Initialize(const SKSE::SerializationInterface* seriali
 
 void SaveGameDataManager::OnSave(SKSE::SerializationInterface* intfc)
 {
+    PROFILE_FUNCTION();
     spdlog::info("SaveGameDataManager: Saving changed objects...");
 
+    // A running cell reset holds the cell's entries outside the registry - finish it
+    // first, or this save would keep the moved references without their entries
+    CellResetJob::GetSingleton()->FinishNow();
+
     // Delete all created objects from game world before save
     // This prevents them from being saved to the normal game save file
     // We store the player's current cell to respawn objects there after save
     auto* tracker = CreatedObjectTracker::GetSingleton();
     std::string playerCellFormKey = tracker->OnPreSave();
 
+    // Cells the player left may still be written in the background (bExportOnCellLeave)
+    // Wait for them, so the exporters below never merge into a file that is being written
+    CellExportWriter::GetSingleton()->Flush();
+
     // Export pending changes to Base Object Swapper INI files (repositioned existing refs)
     auto* bosExporter = BaseObjectSwapperExporter::GetSingleton();
     size_t bosExportedCount = bosExporter->ExportPendingChanges();
@@ -209,6 +221,7 @@ void SaveGameDataManager::OnSave(SKSE::SerializationInterface* intfc)
 
 void SaveGameDataManager::OnLoad(SKSE::SerializationInterface* intfc)
 {
+    PROFILE_FUNCTION();
     spdlog::info("SaveGameDataManager: Loading changed objects...");
 
     // Clear existing entries before loading
@@ -0,0 +1,63 @@
+#include "StringPool.h"
+#include <cstring>
+
+namespace Persistence {
+
+StringPool* StringPool::GetSingleton()
+{
+    static StringPool instance;
+    return &instance;
+}
+
+std::string_view StringPool::Intern(std::string_view s)
+{
+    if (s.empty()) {
+        return {};
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    if (auto it = m_index.find(s); it != m_index.end()) {
+        return *it;
+    }
+
+    std::string_view stored(Store(s), s.size());
+    m_index.insert(stored);
+    return stored;
+}
+
+const char* StringPool::Store(std::string_view s)
+{
+    m_bytesStored += s.size();
+
+    // Oversized strings get an allocation of their own; the current chunk stays open
+    if (s.size() > kChunkSize / 4) {
+        auto& block = m_largeStrings.emplace_back(std::make_unique<char[]>(s.size()));
+        std::memcpy(block.get(), s.data(), s.size());
+        return block.get();
+    }
+
+    if (m_chunkUsed + s.size() > kChunkSize) {
+        m_chunks.push_back(std::make_unique<char[]>(kChunkSize));
+        m_chunkUsed = 0;
+    }
+
+    char* dest = m_chunks.back().get() + m_chunkUsed;
+    std::memcpy(dest, s.data(), s.size());
+    m_chunkUsed += s.size();
+    return dest;
+}
+
+size_t StringPool::GetStringCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_index.size();
+}
+
+size_t StringPool::GetBytesStored() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_bytesStored;
+}
+
+} // namespace Persistence
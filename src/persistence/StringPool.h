@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace Persistence {
+
+// StringPool: Deduplicated, immutable storage for INI metadata strings
+//
+// Parsed files repeat the same mesh paths, names and form type codes thousands
+// of times. Every distinct string is stored once here and entries refer to it
+// through InternedString (a string_view into the pool), so loaded INI data
+// costs 16 bytes per metadata field instead of a heap-allocated std::string.
+//
+// The pool is append-only and lives for the whole session: entries are copied
+// freely between parsers, exporters and the spawner, and a view must never
+// dangle. Its size is bounded by the distinct base objects referenced, not by
+// the number of entries. Intern is thread-safe.
+class StringPool
+{
+public:
+    static StringPool* GetSingleton();
+
+    // Returns a view of the pooled copy of s (copied in on first sight).
+    // The empty string maps to an empty view without touching the pool.
+    std::string_view Intern(std::string_view s);
+
+    size_t GetStringCount() const;
+    size_t GetBytesStored() const;
+
+private:
+    StringPool() = default;
+    ~StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    // Strings are packed into fixed chunks so their addresses never move
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    const char* Store(std::string_view s);
+
+    mutable std::mutex m_mutex;
+    std::unordered_set<std::string_view> m_index;
+    std::vector<std::unique_ptr<char[]>> m_chunks;
+    std::vector<std::unique_ptr<char[]>> m_largeStrings;
+    size_t m_chunkUsed = kChunkSize;
+    size_t m_bytesStored = 0;
+};
+
+// A string held by StringPool. Behaves like a std::string_view that can be
+// assigned from any string: assignment interns, copies are free, and equal
+// strings share storage.
+class InternedString
+{
+public:
+    InternedString() = default;
+    InternedString(std::string_view s) :
+        m_view(StringPool::GetSingleton()->Intern(s))
+    {}
+    InternedString(const std::string& s) :
+        InternedString(std::string_view(s))
+    {}
+    InternedString(const char* s) :
+        InternedString(s ? std::string_view(s) : std::string_view())
+    {}
+
+    operator std::string_view() const { return m_view; }
+    std::string_view view() const { return m_view; }
+    std::string str() const { return std::string(m_view); }
+
+    bool empty() const { return m_view.empty(); }
+    size_t size() const { return m_view.size(); }
+    const char* data() const { return m_view.data(); }
+
+    friend bool operator==(const InternedString& a, std::string_view b) { return a.m_view == b; }
+    friend auto operator<=>(const InternedString& a, std::string_view b) { return a.m_view <=> b; }
+
+private:
+    std::string_view m_view;
+};
+
+} // namespace Persistence
+
+template <>
+struct std::formatter<Persistence::InternedString> : std::formatter<std::string_view>
+{
+    auto format(const Persistence::InternedString& s, std::format_context& ctx) const
+    {
+        return std::formatter<std::string_view>::format(s.view(), ctx);
+    }
+};
+
+#if !defined(TEST_ENVIRONMENT)
+#include <spdlog/fmt/fmt.h>
+
+template <>
+struct fmt::formatter<Persistence::InternedString> : fmt::formatter<std::string_view>
+{
+    auto format(const Persistence::InternedString& s, fmt::format_context& ctx) const
+    {
+        return fmt::formatter<std::string_view>::format(s.view(), ctx);
+    }
+};
+#endif
@@ -1,6 +1,7 @@
 #include "log.h"
 #include "HealthCheck.h"
 #include "util/InputManager.h"
+#include "util/JobSystem.h"
 #include "util/MenuChecker.h"
 #include "util/SkyrimNetInterface.h"
 #include "interfaces/higgsinterface001.h"
@@ -10,6 +11,7 @@
 #include "FrameCallbackDispatcher.h"
 #include "EditModeTransitioner.h"
 #include "EditModeStateManager.h"
+#include "EditModeWarmup.h"
 #include "selection/SelectionState.h"
 #include "selection/DelayedHighlightRefreshManager.h"
 #include "grab/RemoteGrabController.h"
@@ -18,6 +20,8 @@
 #include "grab/DeferredCollisionUpdateManager.h"
 #include "visuals/ObjectHighlighter.h"
 #include "actions/UndoRedoController.h"
+#include "actions/CopyHandler.h"
+#include "actions/ArrayDuplicateHandler.h"
 #include "ui/SelectionMenu.h"
 #include "ui/GalleryMenu.h"
 #include "ui/MenuStateManager.h"
@@ -25,19 +29,24 @@
 #include "persistence/AddedObjectsSpawner.h"
 #include "persistence/CreatedObjectTracker.h"
 #include "persistence/FormKeyUtil.h"
+#include "persistence/BaseFormMetadataCache.h"
+#include "persistence/CellResetJob.h"
+#include "persistence/CellExportWriter.h"
 #include "persistence/BaseObjectSwapperParser.h"
 #include "config/ConfigStorage.h"
 #include "config/ConfigStoragePapyrusAdapter.h"
 #include "config/ConfigOptions.h"
 #include "api/VREditorPapyrusAPI.h"
 #include "api/VRBuilderNativePapyrusAPI.h"
+#include "api/SelectionEventQueue.h"
 
 // =============================================================================
 // Cell Event Sink - handles cell attach/detach events
 // =============================================================================
 // This sink handles two responsibilities:
 // 1. On detach: Exit edit mode when player leaves a cell (prevents crashes from invalid refs)
-// 2. On attach: Spawn added objects when player enters a cell
+// 2. On attach: Spawn added objects when player enters a cell, and export the cells left
+//    behind through CellExportWriter
 class CellEventSink : public RE::BSTEventSink<RE::TESCellAttachDetachEvent>
 {
 public:
@@ -78,6 +87,10 @@ public:
 				// Update current cell
 				m_currentCellFormKey = newCellFormKey;
 
+				// Export the pending changes of the cells left behind in the background
+				// (bExportOnCellLeave), so the next save only writes this one
+				Persistence::CellExportWriter::GetSingleton()->ExportCellsOutside(newCellFormKey);
+
 				// NOTE: With forcePersist=true, the game handles object persistence.
 				// We no longer need to delete/spawn objects on cell transitions.
 				// Keeping tracker reference for potential future use.
@@ -174,6 +187,11 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 		// BOS locks _SWAP.ini files when reading them, so we use _session.ini files
 		// during gameplay and copy them to _SWAP.ini here before BOS reads them
 		Persistence::BaseObjectSwapperParser::GetSingleton()->ApplyPendingSessionFiles();
+
+		// Start the background job workers (config is loaded by now)
+		// There is no unload message - the workers live until the process exits
+		Util::JobSystem::GetSingleton()->Start(static_cast<size_t>(std::max(0,
+			Config::ConfigStorage::GetSingleton()->GetInt(Config::Options::kJobWorkerCount, 0))));
 		break;
 
 	case SKSE::MessagingInterface::kPostPostLoad:
@@ -217,6 +235,9 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 		// Initialize FrameCallbackDispatcher
 		FrameCallbackDispatcher::GetSingleton()->Initialize();
 
+		// Job continuations run on the main thread every frame, in and out of edit mode
+		FrameCallbackDispatcher::GetSingleton()->Register(Util::JobSystem::GetSingleton(), false);
+
 		// Initialize DeferredCollisionUpdateManager (needs FrameCallbackDispatcher)
 		// This runs even outside edit mode to complete pending collision updates
 		Grab::DeferredCollisionUpdateManager::GetSingleton()->Initialize();
@@ -227,6 +248,10 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 		// Initialize SelectionState (stores what objects are selected)
 		Selection::SelectionState::GetSingleton()->Initialize();
 
+		// Initialize SelectionEventQueue (needs FrameCallbackDispatcher)
+		// Coalesces selection changes per frame for InGamePatcherAPI consumers
+		API::SelectionEventQueue::GetSingleton()->Initialize();
+
 		// Initialize DelayedHighlightRefreshManager (needs FrameCallbackDispatcher)
 		// Handles delayed re-application of highlights after Disable/Enable cycles
 		Selection::DelayedHighlightRefreshManager::GetSingleton()->Initialize();
@@ -241,6 +266,9 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 			spdlog::info("Registered cell attach/detach event sink");
 		}
 
+		// Load order is final from here on - start the exporters' metadata cache clean
+		Persistence::BaseFormMetadataCache::GetSingleton()->Invalidate();
+
 		// Initialize AddedObjectsSpawner - loads and caches all _AddedObjects.ini files
 		Persistence::AddedObjectsSpawner::GetSingleton()->Initialize();
 
@@ -248,6 +276,15 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 
 	case SKSE::MessagingInterface::kPreLoadGame:
 		spdlog::info("PreLoadGame");
+		// Drop any running cell reset or staged copy - their references are about to be invalidated
+		Persistence::CellResetJob::GetSingleton()->Abort();
+		// Cells queued for background export belong to the session being unloaded
+		Persistence::CellExportWriter::GetSingleton()->Cancel();
+		Actions::CopyHandler::GetSingleton()->Abort();
+		Actions::ArrayDuplicateHandler::GetSingleton()->Cancel();
+		// Scripted renames of base forms are restored from the save - re-read metadata after the load
+		Persistence::BaseFormMetadataCache::GetSingleton()->Invalidate();
+
 		// Exit edit mode before loading a game to prevent crashes from invalid references
 		if (EditModeManager::GetSingleton()->IsInEditMode()) {
 			spdlog::info("PreLoadGame: Exiting edit mode before game load");
@@ -262,6 +299,9 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 		// These were marked for deletion but SetDelete was deferred to this safe point
 		Persistence::ChangedObjectRegistry::GetSingleton()->ProcessPendingHardDeletes();
 
+		// Entries restored from the co-save carry no export record - read it from their references
+		Persistence::ChangedObjectRegistry::GetSingleton()->CaptureRestoredExportRecords();
+
 		// Initialize input systems now - after 3DUI has registered with SkyrimVRTools
 		// This ensures 3DUI input callbacks fire first and can consume events
 		InitializeInputSystems();
@@ -275,10 +315,14 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 		// Check dependency versions and notify user if incompatible (only shows once per session)
 		HealthCheck::GetSingleton()->MayShowDependenciesErrorMessage();
 
+		// Build menus and buffers over the next idle frames so the first edit-mode entry doesn't hitch
+		EditModeWarmup::GetSingleton()->Start();
+
 		break;
 
 	case SKSE::MessagingInterface::kNewGame:
 		spdlog::info("NewGame");
+		Persistence::BaseFormMetadataCache::GetSingleton()->Invalidate();
 
 		// Initialize input systems now - after 3DUI has registered with SkyrimVRTools
 		// This ensures 3DUI input callbacks fire first and can consume events
@@ -293,6 +337,8 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 		// Check dependency versions and notify user if incompatible (only shows once per session)
 		HealthCheck::GetSingleton()->MayShowDependenciesErrorMessage();
 
+		EditModeWarmup::GetSingleton()->Start();
+
 		break;
 	}
 }
@@ -333,6 +379,10 @@ SKSEPluginLoad(const SKSE::LoadInterface *skse) {
 	// This ensures options exist in INI on first run and defines select dropdown choices
 	Config::RegisterConfigOptions();
 
+	// Apply the configured log level now that the INI is loaded
+	Log::SetLevel(Config::ConfigStorage::GetSingleton()->GetInt(Config::Options::kLogLevel, Log::kTrace));
+	spdlog::info("Log level: {} (compiled minimum: {})", Log::g_runtimeLevel.load(), VREDIT_LOG_MIN_LEVEL);
+
 	// Register Papyrus native functions for config storage
 	auto* papyrus = SKSE::GetPapyrusInterface();
 	if (papyrus) {
@@ -28,7 +28,7 @@ void HoverStateManager::SetPendingHover(RE::TESObjectREFR* ref)
     m_pendingTime = 0.0f;
 }
 
-void HoverStateManager::SetPendingHoverWithRetention(RE::TESObjectREFR* primaryHit, const std::vector<RE::TESObjectREFR*>& retentionHits)
+void HoverStateManager::SetPendingHoverWithRetention(RE::TESObjectREFR* primaryHit, std::span<RE::TESObjectREFR* const> retentionHits)
 {
     // Filter primary hit (treat filtered objects as null)
     if (primaryHit && !ObjectFilter::ShouldProcess(primaryHit)) {
@@ -36,7 +36,7 @@ void HoverStateManager::SetPendingHoverWithRetention(RE::TESObjectREFR* primaryH
     }
 
     // Helper to check if an object is in the retention hits (only considers objects that pass filter)
-    auto isInRetentionHits = [&retentionHits](RE::TESObjectREFR* ref) -> bool {
+    auto isInRetentionHits = [retentionHits](RE::TESObjectREFR* ref) -> bool {
         if (!ref) return false;
         for (auto* hit : retentionHits) {
             if (hit == ref && ObjectFilter::ShouldProcess(hit)) return true;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <RE/Skyrim.h>
+#include <span>
 #include <vector>
 
 namespace Selection {
@@ -37,7 +38,7 @@ public:
     // primaryHit: The object hit by the central ray (used for acquiring new targets)
     // retentionHits: All objects hit by any of the 5 rays (used to retain current highlight)
     // If the currently highlighted object is in retentionHits, it stays highlighted (sticky behavior)
-    void SetPendingHoverWithRetention(RE::TESObjectREFR* primaryHit, const std::vector<RE::TESObjectREFR*>& retentionHits);
+    void SetPendingHoverWithRetention(RE::TESObjectREFR* primaryHit, std::span<RE::TESObjectREFR* const> retentionHits);
 
     // Update debounce timer (call each frame)
     void Update(float deltaTime);
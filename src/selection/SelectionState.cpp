@@ -4,6 +4,7 @@
 #include "../visuals/ObjectHighlighter.h"
 #include "../actions/ActionHistoryRepository.h"
 #include "../ui/SelectionMenu.h"
+#include "../api/SelectionEventQueue.h"
 #include "../log.h"
 #include <algorithm>
 
@@ -239,6 +240,20 @@ const SelectionInfo* SelectionState::GetFirstSelectionInfo() const
     return &m_selection[0];
 }
 
+uint32_t SelectionState::CopyFormIds(uint32_t* buffer, uint32_t capacity) const
+{
+    const auto count = static_cast<uint32_t>(m_selection.size());
+    if (!buffer) {
+        return count;
+    }
+
+    const uint32_t toCopy = (std::min)(count, capacity);
+    for (uint32_t i = 0; i < toCopy; ++i) {
+        buffer[i] = m_selection[i].formId;
+    }
+    return count;
+}
+
 void SelectionState::ClearAll()
 {
     if (m_selection.empty()) {
@@ -258,6 +273,29 @@ void SelectionState::ClearAll()
     NotifySelectionChange(oldSelection);
 }
 
+void SelectionState::ReplaceSelection(const std::vector<RE::TESObjectREFR*>& refs)
+{
+    std::vector<SelectionInfo> oldSelection = m_selection;
+
+    for (const auto& info : m_selection) {
+        RemoveHighlight(info.ref);
+    }
+    m_selection.clear();
+    m_selection.reserve(refs.size());
+
+    for (auto* ref : refs) {
+        if (!ref || !ObjectFilter::ShouldProcess(ref) || IsSelected(ref)) {
+            continue;
+        }
+        m_selection.push_back(CreateSelectionInfo(ref));
+        ApplyHighlight(ref);
+    }
+
+    spdlog::info("SelectionState: Replaced selection ({} -> {} items)", oldSelection.size(), m_selection.size());
+
+    NotifySelectionChange(oldSelection);
+}
+
 void SelectionState::ReduceToSingle()
 {
     if (m_selection.size() <= 1) {
@@ -282,6 +320,11 @@ void SelectionState::ReduceToSingle()
 
 void SelectionState::NotifySelectionChange(const std::vector<SelectionInfo>& oldSelection)
 {
+    // Always bump the generation and report to API consumers - undo/redo restores
+    // are still visible selection changes
+    uint32_t generation = m_generation.fetch_add(1, std::memory_order_release) + 1;
+    API::SelectionEventQueue::GetSingleton()->Record(oldSelection, m_selection, generation);
+
     // Skip callback during undo/redo to avoid recording changes we're restoring
     if (m_suppressCallback) {
         return;
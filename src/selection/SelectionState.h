@@ -3,6 +3,7 @@
 #include <RE/Skyrim.h>
 #include <vector>
 #include <functional>
+#include <atomic>
 
 namespace Selection {
 
@@ -50,6 +51,13 @@ public:
     bool IsSelected(RE::FormID formId) const;
     size_t GetSelectionCount() const { return m_selection.size(); }
 
+    // Monotonic counter bumped on every selection mutation (including suppressed ones)
+    // Safe to read from any thread; lets API consumers skip re-reading an unchanged selection
+    uint32_t GetGeneration() const { return m_generation.load(std::memory_order_acquire); }
+
+    // Copy selected FormIDs into buffer (up to capacity), returns total selection count
+    uint32_t CopyFormIds(uint32_t* buffer, uint32_t capacity) const;
+
     // Get first selected (for single-object operations)
     RE::TESObjectREFR* GetFirstSelected() const;
     const SelectionInfo* GetFirstSelectionInfo() const;
@@ -57,6 +65,10 @@ public:
     // Clear everything
     void ClearAll();
 
+    // Replace the whole selection in one step - a single change notification
+    // (and a single undo entry) instead of ClearAll() plus one per AddToSelection()
+    void ReplaceSelection(const std::vector<RE::TESObjectREFR*>& refs);
+
     // Reduce to single selection (keep only the first item)
     void ReduceToSingle();
 
@@ -93,6 +105,9 @@ private:
     // Single unified selection list
     std::vector<SelectionInfo> m_selection;
 
+    // Bumped in NotifySelectionChange - see GetGeneration()
+    std::atomic<uint32_t> m_generation{ 0 };
+
     // Callback for undo/redo
     SelectionChangeCallback m_changeCallback;
     bool m_suppressCallback = false;
@@ -1,6 +1,7 @@
 #include "SphereHoverStateManager.h"
 #include "SelectionState.h"
 #include "../visuals/ObjectHighlighter.h"
+#include "../util/FrameArena.h"
 #include "../log.h"
 
 namespace Selection {
@@ -14,7 +15,8 @@ SphereHoverStateManager* SphereHoverStateManager::GetSingleton()
 void SphereHoverStateManager::SetHoveredObjects(const std::vector<RE::TESObjectREFR*>& objects)
 {
     // Build set of incoming FormIDs for fast lookup
-    std::unordered_set<RE::FormID> incomingFormIds;
+    Util::FrameSet<RE::FormID> incomingFormIds(Util::FrameArena::Get());
+    incomingFormIds.reserve(objects.size());
     for (auto* ref : objects) {
         if (ref) {
             incomingFormIds.insert(ref->GetFormID());
@@ -22,7 +24,7 @@ void SphereHoverStateManager::SetHoveredObjects(const std::vector<RE::TESObjectR
     }
 
     // Find objects that are no longer hovered (were in m_hoveredFormIds but not in incoming)
-    std::vector<RE::FormID> toRemove;
+    Util::FrameVector<RE::FormID> toRemove(Util::FrameArena::Get());
     for (RE::FormID formId : m_hoveredFormIds) {
         if (incomingFormIds.find(formId) == incomingFormIds.end()) {
             toRemove.push_back(formId);
@@ -99,6 +101,12 @@ void SphereHoverStateManager::Clear()
 
 }
 
+void SphereHoverStateManager::Reserve(size_t objectCount)
+{
+    m_hoveredRefs.reserve(objectCount);
+    m_hoveredFormIds.reserve(objectCount);
+}
+
 void SphereHoverStateManager::ApplyHoverHighlight(RE::TESObjectREFR* ref)
 {
     if (!ref) {
@@ -49,6 +49,10 @@ public:
     // Clear all hover state and remove highlights
     void Clear();
 
+    // Pre-size the hover containers (edit-mode warm-up) so the first sphere scans
+    // don't grow them while the user is sweeping
+    void Reserve(size_t objectCount);
+
 private:
     SphereHoverStateManager() = default;
     ~SphereHoverStateManager() = default;
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <RE/Skyrim.h>
+#include <charconv>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <Windows.h>
 #include "../log.h"
 #include "../interfaces/ThreeDUIInterface001.h"
@@ -17,6 +19,7 @@
 #include "openvr.h"
 #include "../EditModeInputManager.h"
 #include "MenuStateManager.h"
+#include "MenuElementPool.h"
 
 // GalleryMenu: Standalone 3D menu for browsing and placing gallery items
 // Separate from SelectionMenu with its own root
@@ -136,6 +139,20 @@ public:
         return true;
     }
 
+    // Edit-mode warm-up: load the gallery item previews into the pool while the
+    // root is hidden, so the first Show only re-skins pooled elements
+    void PrewarmElements()
+    {
+        if (!m_menuSetup || IsMenuOpen()) return;
+
+        if (auto* root = GetRoot()) {
+            root->SetVisible(false);
+        }
+
+        PopulateGalleryWheel();
+        m_galleryPool.ReleaseAll();
+    }
+
     void Show(bool isLeftHand)
     {
         if (IsMenuOpen()) return;
@@ -200,6 +217,7 @@ public:
 
         // Hide menu
         root->SetVisible(false);
+        m_galleryPool.ReleaseAll();
 
         spdlog::info("GalleryMenu::Close - Menu closed (edit mode continues)");
     }
@@ -278,14 +296,18 @@ private:
             }
 
             // Gallery item click - place object
-            if (id.rfind("gallery_item_", 0) == 0) {  // starts_with
-                std::string indexStr = id.substr(13);  // after "gallery_item_"
-                try {
-                    size_t index = std::stoul(indexStr);
-                    PlaceGalleryItem(index);
-                } catch (const std::exception& e) {
-                    spdlog::error("GalleryMenu: Failed to parse gallery item index: {}", e.what());
+            constexpr std::string_view kItemPrefix = "gallery_item_";
+            if (id.starts_with(kItemPrefix)) {
+                const char* first = id.data() + kItemPrefix.size();
+                const char* last = id.data() + id.size();
+                size_t index = 0;
+                const auto [end, ec] = std::from_chars(first, last, index);
+                if (ec != std::errc() || end != last || index >= m_populatedItemCount) {
+                    spdlog::error("GalleryMenu: Ignoring '{}' - not one of the {} populated gallery items",
+                        id, m_populatedItemCount);
+                    return true;
                 }
+                PlaceGalleryItem(index);
                 return true;
             }
         }
@@ -361,6 +383,7 @@ private:
     {
         if (!m_galleryWheel || !m_api) return;
 
+        m_galleryPool.ReleaseAll();
         m_galleryWheel->Clear();
 
         // Central orb anchor handle - closes gallery menu only
@@ -370,7 +393,7 @@ private:
         orbConfig.facingMode = P3DUI::FacingMode::None;
         orbConfig.isAnchorHandle = true;
 
-        auto* orbHandle = m_api->CreateElement(orbConfig);
+        auto* orbHandle = m_galleryPool.Acquire(m_api, orbConfig);
         if (orbHandle) {
             m_galleryWheel->AddChild(orbHandle);
         }
@@ -399,14 +422,28 @@ private:
             itemConfig.scale = item.targetScale;  // Auto-calculated scale
             itemConfig.facingMode = P3DUI::FacingMode::None;
 
-            auto* itemElement = m_api->CreateElement(itemConfig);
+            auto* itemElement = m_galleryPool.Acquire(m_api, itemConfig);
             if (itemElement) {
                 m_galleryWheel->AddChild(itemElement);
             }
         }
+        m_galleryPool.HideUnused();
+
+        // Items past the new count would still resolve to gallery_item_N - forget them
+        size_t retired = 0;
+        for (size_t i = items.size(); i < m_populatedItemCount; i++) {
+            if (m_galleryPool.Retire("gallery_item_" + std::to_string(i))) {
+                retired++;
+            }
+        }
+        if (retired > 0) {
+            spdlog::info("GalleryMenu::PopulateGalleryWheel - Retired {} removed gallery items", retired);
+        }
+        m_populatedItemCount = items.size();
 
         spdlog::info("GalleryMenu::PopulateGalleryWheel - Added {} gallery items + central orb",
             items.size());
+        m_galleryPool.LogStats();
     }
 
     // Populate the tool row (currently empty)
@@ -490,6 +527,10 @@ private:
     P3DUI::Container* m_toolRow = nullptr;
     P3DUI::Text* m_itemCountText = nullptr;
 
+    // Pooled wheel elements - gallery_item_N elements are re-skinned when the gallery changes
+    MenuElementPool m_galleryPool{ "GalleryWheel" };
+    size_t m_populatedItemCount = 0;  // gallery_item_N elements from the last populate
+
     // Positioning state
     bool m_positioningHand = false;  // Which hand is positioning (true = left)
     bool m_isPositioning = false;    // Are we currently in positioning mode?
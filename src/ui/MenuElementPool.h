@@ -0,0 +1,232 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include "../log.h"
+#include "../interfaces/ThreeDUIInterface001.h"
+
+// MenuElementPool: Reuses 3DUI elements across menu repopulations.
+//
+// Menus rebuild their wheels and tool rows every time they open or the selection
+// changes. Creating a fresh element each time costs a model load, a tooltip
+// allocation and a layout pass in 3DUI. The pool keeps every element it has ever
+// created, keyed by the element ID from its ElementConfig, and hands the same
+// element back on the next Acquire(). Only properties that actually changed are
+// pushed to 3DUI (SetModel/SetTexture/SetTooltip/SetScale/SetFacingMode).
+//
+// Properties that 3DUI only honours at creation time (formID, anchor handle,
+// hover threshold, smoothing, rotation offsets, model vs. texture mode) are
+// compared too - if any of them differ the old element is hidden (3DUI recycles
+// hidden nodes) and a new one is created in its place.
+//
+// Usage (inside a Populate method):
+//   m_wheelPool.ReleaseAll();
+//   m_wheel->Clear();
+//   if (auto* e = m_wheelPool.Acquire(m_api, config)) m_wheel->AddChild(e);
+//   m_wheelPool.HideUnused();
+//
+// Reuse relies on Container::Clear() only detaching children, not destroying
+// them: 3DUI owns every node and the only way to give one back is
+// SetVisible(false). Elements a populate did not acquire again are hidden by
+// HideUnused() but stay pooled, so switching between menu modes brings them
+// back without a 3DUI call. Ids that cannot come back (gallery_item_N past the
+// new item count) are hidden and forgotten with Retire().
+//
+// All calls must be made on the main thread, like every other 3DUI call.
+class MenuElementPool
+{
+public:
+    explicit MenuElementPool(const char* name) : m_name(name) {}
+
+    // Get a pooled element matching config, creating it on first use.
+    // Returns nullptr if 3DUI fails to create the element.
+    P3DUI::Element* Acquire(P3DUI::Interface001* api, const P3DUI::ElementConfig& config)
+    {
+        if (!api || !config.id) return nullptr;
+
+        auto it = m_entries.find(config.id);
+        if (it != m_entries.end()) {
+            auto& entry = it->second;
+
+            if (entry.inUse) {
+                spdlog::warn("MenuElementPool[{}]: Element '{}' acquired twice without release",
+                    m_name, config.id);
+            }
+
+            if (entry.element && MatchesCreationState(entry, config)) {
+                Reskin(entry, config);
+                entry.element->SetVisible(true);
+                entry.inUse = true;
+                m_reuseCount++;
+                return entry.element;
+            }
+
+            // Creation-time properties changed - retire the old element
+            if (entry.element) {
+                entry.element->SetVisible(false);
+            }
+            m_entries.erase(it);
+        }
+
+        auto* element = api->CreateElement(config);
+        if (!element) {
+            return nullptr;
+        }
+
+        Entry entry;
+        entry.element = element;
+        entry.inUse = true;
+        StoreState(entry, config);
+        m_entries.emplace(config.id, std::move(entry));
+        m_createCount++;
+        return element;
+    }
+
+    // Mark every element as available again. Call before repopulating the
+    // container that owns these elements, and when the menu is hidden.
+    void ReleaseAll()
+    {
+        for (auto& [id, entry] : m_entries) {
+            entry.inUse = false;
+        }
+    }
+
+    // Hide every element not acquired since the last ReleaseAll(); they stay
+    // pooled for the next Acquire(). Call at the end of each populate.
+    size_t HideUnused()
+    {
+        size_t hidden = 0;
+        for (auto& [id, entry] : m_entries) {
+            if (!entry.inUse && entry.element) {
+                entry.element->SetVisible(false);
+                hidden++;
+            }
+        }
+        return hidden;
+    }
+
+    // Hide and forget an element whose id will not be acquired again
+    // Returns false if the id was not pooled
+    bool Retire(const std::string& id)
+    {
+        auto it = m_entries.find(id);
+        if (it == m_entries.end()) {
+            return false;
+        }
+        if (it->second.element) {
+            it->second.element->SetVisible(false);
+        }
+        m_entries.erase(it);
+        return true;
+    }
+
+    // Forget all pooled elements (e.g. after 3DUI roots were torn down)
+    void Reset()
+    {
+        m_entries.clear();
+        m_createCount = 0;
+        m_reuseCount = 0;
+    }
+
+    size_t GetPooledCount() const { return m_entries.size(); }
+    size_t GetCreateCount() const { return m_createCount; }
+    size_t GetReuseCount() const { return m_reuseCount; }
+
+    void LogStats() const
+    {
+        spdlog::info("MenuElementPool[{}]: {} pooled, {} created, {} reused",
+            m_name, m_entries.size(), m_createCount, m_reuseCount);
+    }
+
+private:
+    struct Entry {
+        P3DUI::Element* element = nullptr;
+        bool inUse = false;
+
+        // Re-skinnable state (last values pushed to 3DUI)
+        std::string modelPath;
+        std::string texturePath;
+        std::wstring tooltip;
+        float scale = 1.0f;
+        P3DUI::FacingMode facingMode = P3DUI::FacingMode::None;
+
+        // Creation-time state
+        bool hasModel = false;
+        bool hasTexture = false;
+        uint32_t formID = 0;
+        bool isAnchorHandle = false;
+        float hoverThreshold = -1.0f;
+        float smoothingFactor = 15.0f;
+        float rotationPitch = 0.0f;
+        float rotationRoll = 0.0f;
+        float rotationYaw = 0.0f;
+    };
+
+    static const char* OrEmpty(const char* s) { return s ? s : ""; }
+    static const wchar_t* OrEmpty(const wchar_t* s) { return s ? s : L""; }
+
+    static bool MatchesCreationState(const Entry& entry, const P3DUI::ElementConfig& config)
+    {
+        return entry.hasModel == (config.modelPath != nullptr)
+            && entry.hasTexture == (config.texturePath != nullptr)
+            && entry.formID == config.formID
+            && entry.isAnchorHandle == config.isAnchorHandle
+            && entry.hoverThreshold == config.hoverThreshold
+            && entry.smoothingFactor == config.smoothingFactor
+            && entry.rotationPitch == config.rotationPitch
+            && entry.rotationRoll == config.rotationRoll
+            && entry.rotationYaw == config.rotationYaw;
+    }
+
+    static void StoreState(Entry& entry, const P3DUI::ElementConfig& config)
+    {
+        entry.modelPath = OrEmpty(config.modelPath);
+        entry.texturePath = OrEmpty(config.texturePath);
+        entry.tooltip = OrEmpty(config.tooltip);
+        entry.scale = config.scale;
+        entry.facingMode = config.facingMode;
+
+        entry.hasModel = config.modelPath != nullptr;
+        entry.hasTexture = config.texturePath != nullptr;
+        entry.formID = config.formID;
+        entry.isAnchorHandle = config.isAnchorHandle;
+        entry.hoverThreshold = config.hoverThreshold;
+        entry.smoothingFactor = config.smoothingFactor;
+        entry.rotationPitch = config.rotationPitch;
+        entry.rotationRoll = config.rotationRoll;
+        entry.rotationYaw = config.rotationYaw;
+    }
+
+    // Push only the properties that differ from what the element already shows
+    static void Reskin(Entry& entry, const P3DUI::ElementConfig& config)
+    {
+        auto* element = entry.element;
+
+        if (config.modelPath && entry.modelPath != config.modelPath) {
+            element->SetModel(config.modelPath);
+            entry.modelPath = config.modelPath;
+        }
+        if (config.texturePath && entry.texturePath != config.texturePath) {
+            element->SetTexture(config.texturePath);
+            entry.texturePath = config.texturePath;
+        }
+        const wchar_t* tooltip = OrEmpty(config.tooltip);
+        if (entry.tooltip != tooltip) {
+            element->SetTooltip(config.tooltip);
+            entry.tooltip = tooltip;
+        }
+        if (entry.scale != config.scale) {
+            element->SetScale(config.scale);
+            entry.scale = config.scale;
+        }
+        if (entry.facingMode != config.facingMode) {
+            element->SetFacingMode(config.facingMode);
+            entry.facingMode = config.facingMode;
+        }
+    }
+
+    const char* m_name;
+    std::unordered_map<std::string, Entry> m_entries;
+    size_t m_createCount = 0;
+    size_t m_reuseCount = 0;
+};
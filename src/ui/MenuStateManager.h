@@ -8,7 +8,9 @@
 //
 // Menus are initialized on first use (when user tries to open them), not at game start.
 // This improves startup time and ensures any initialization errors are user-triggered
-// rather than causing mysterious crashes during game load.
+// rather than causing mysterious crashes during game load. EditModeWarmup calls the
+// same EnsureXxxReady() methods on idle frames after a load, so normally the first
+// open finds the menu ready.
 //
 // Usage:
 //   // In menu Show() method:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <RE/Skyrim.h>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <Windows.h>
@@ -19,6 +20,7 @@
 #include "../persistence/ChangedObjectRegistry.h"
 #include "../grab/RemoteGrabController.h"
 #include "SelectionMenuHelpers.h"
+#include "MenuElementPool.h"
 #include "GalleryMenu.h"
 #include "openvr.h"
 #include "MenuStateManager.h"
@@ -192,12 +194,35 @@ public:
         return true;
     }
 
+    // Edit-mode warm-up: build every wheel and tool row element once while the
+    // root is hidden, so the first ShowAtHand only re-skins pooled elements
+    void PrewarmElements()
+    {
+        if (!m_menuSetup || IsMenuOpen()) return;
+
+        if (auto* root = GetRoot()) {
+            root->SetVisible(false);
+        }
+
+        // Selection mode is a superset of hidden mode (shares empty_center)
+        PopulateSelectionModeWheel();
+        PopulateToolRow();
+
+        m_wheelPool.ReleaseAll();
+        m_toolRowPool.ReleaseAll();
+
+        spdlog::info("SelectionMenu::PrewarmElements - Pooled {} wheel and {} tool row elements",
+            m_wheelPool.GetPooledCount(), m_toolRowPool.GetPooledCount());
+    }
+
     // Show the menu at the specified hand position
     void ShowAtHand(bool isLeftHand)
     {
         if (IsMenuOpen()) return;
 
-        // Lazy initialization - setup menu on first show
+        const auto showStart = std::chrono::steady_clock::now();
+
+        // Lazy initialization - setup menu on first show (normally done by EditModeWarmup)
         if (!m_menuSetup) {
             if (!MenuStateManager::GetSingleton()->EnsureSelectionMenuReady()) {
                 spdlog::error("SelectionMenu::ShowAtHand - Failed to initialize menu");
@@ -239,7 +264,10 @@ public:
             root->SetVisible(true);
         }
 
-        spdlog::info("SelectionMenu::ShowAtHand - Menu opened");
+        const float showMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - showStart).count();
+        spdlog::info("SelectionMenu::ShowAtHand - Menu opened in {:.2f} ms", showMs);
+        m_wheelPool.LogStats();
+        m_toolRowPool.LogStats();
     }
 
     // Hide the menu (does NOT exit edit mode)
@@ -251,6 +279,10 @@ public:
         }
 
         root->SetVisible(false);
+
+        // Elements stay attached until the next populate, but are free for reuse
+        m_wheelPool.ReleaseAll();
+        m_toolRowPool.ReleaseAll();
         spdlog::info("SelectionMenu::Hide - Menu hidden");
     }
 
@@ -605,6 +637,7 @@ private:
     {
         if (!m_contextDependentWheel || !m_api) return;
 
+        m_wheelPool.ReleaseAll();
         m_contextDependentWheel->Clear();
 
         // Empty element - placeholder to maintain wheel layout
@@ -614,10 +647,11 @@ private:
         emptyConfig.facingMode = P3DUI::FacingMode::None;
         emptyConfig.isAnchorHandle = true;
 
-        auto* emptyElement = m_api->CreateElement(emptyConfig);
+        auto* emptyElement = m_wheelPool.Acquire(m_api, emptyConfig);
         if (emptyElement) {
             m_contextDependentWheel->AddChild(emptyElement);
         }
+        m_wheelPool.HideUnused();
 
         spdlog::info("SelectionMenu::PopulateHiddenModeWheel - Added empty center placeholder");
     }
@@ -627,6 +661,7 @@ private:
     {
         if (!m_contextDependentWheel || !m_api) return;
 
+        m_wheelPool.ReleaseAll();
         m_contextDependentWheel->Clear();
 
         // Empty element - placeholder to maintain wheel layout
@@ -636,7 +671,7 @@ private:
         emptyConfig.facingMode = P3DUI::FacingMode::None;
         emptyConfig.isAnchorHandle = true;
 
-        auto* emptyElement = m_api->CreateElement(emptyConfig);
+        auto* emptyElement = m_wheelPool.Acquire(m_api, emptyConfig);
         if (emptyElement) {
             m_contextDependentWheel->AddChild(emptyElement);
         }
@@ -648,7 +683,7 @@ private:
         copyConfig.scale = 1.1f;
         copyConfig.facingMode = P3DUI::FacingMode::None;
 
-        auto* copyButton = m_api->CreateElement(copyConfig);
+        auto* copyButton = m_wheelPool.Acquire(m_api, copyConfig);
         if (copyButton) {
             m_contextDependentWheel->AddChild(copyButton);
         }
@@ -660,7 +695,7 @@ private:
         deleteConfig.scale = 1.1f;
         deleteConfig.facingMode = P3DUI::FacingMode::None;
 
-        auto* deleteButton = m_api->CreateElement(deleteConfig);
+        auto* deleteButton = m_wheelPool.Acquire(m_api, deleteConfig);
         if (deleteButton) {
             m_contextDependentWheel->AddChild(deleteButton);
         }
@@ -672,7 +707,7 @@ private:
         resetRotConfig.scale = 1.1f;
         resetRotConfig.facingMode = P3DUI::FacingMode::None;
 
-        auto* resetRotButton = m_api->CreateElement(resetRotConfig);
+        auto* resetRotButton = m_wheelPool.Acquire(m_api, resetRotConfig);
         if (resetRotButton) {
             m_contextDependentWheel->AddChild(resetRotButton);
         }
@@ -695,13 +730,14 @@ private:
             galleryActionConfig.scale = 1.1f;
             galleryActionConfig.facingMode = P3DUI::FacingMode::None;
 
-            m_saveToGalleryButton = m_api->CreateElement(galleryActionConfig);
+            m_saveToGalleryButton = m_wheelPool.Acquire(m_api, galleryActionConfig);
             if (m_saveToGalleryButton) {
                 m_contextDependentWheel->AddChild(m_saveToGalleryButton);
             }
         } else {
             m_saveToGalleryButton = nullptr;
         }
+        m_wheelPool.HideUnused();
 
         spdlog::info("SelectionMenu::PopulateSelectionModeWheel - Added {} action buttons + close handle",
             selectionCount == 1 ? 5 : 4);
@@ -721,6 +757,7 @@ private:
     {
         if (!m_toolRow || !m_bigToolRow || !m_api) return;
 
+        m_toolRowPool.ReleaseAll();
         m_toolRow->Clear();
         m_bigToolRow->Clear();
         m_galleryButton = nullptr;
@@ -740,7 +777,7 @@ private:
         undoConfig.hoverThreshold = bigButtonHoverThreshold;
         undoConfig.facingMode = P3DUI::FacingMode::None;
 
-        auto* undoButton = m_api->CreateElement(undoConfig);
+        auto* undoButton = m_toolRowPool.Acquire(m_api, undoConfig);
         if (undoButton) {
             m_bigToolRow->AddChild(undoButton);
         }
@@ -752,7 +789,7 @@ private:
         orbConfig.facingMode = P3DUI::FacingMode::None;
         orbConfig.isAnchorHandle = true;
 
-        auto* closeHandle = m_api->CreateElement(orbConfig);
+        auto* closeHandle = m_toolRowPool.Acquire(m_api, orbConfig);
         if (closeHandle) {
             m_bigToolRow->AddChild(closeHandle);
         }
@@ -765,7 +802,7 @@ private:
         redoConfig.hoverThreshold = bigButtonHoverThreshold;
         redoConfig.facingMode = P3DUI::FacingMode::None;
 
-        auto* redoButton = m_api->CreateElement(redoConfig);
+        auto* redoButton = m_toolRowPool.Acquire(m_api, redoConfig);
         if (redoButton) {
             m_bigToolRow->AddChild(redoButton);
         }
@@ -779,7 +816,7 @@ private:
         closeConfig.scale = 1.1f;
         closeConfig.facingMode = P3DUI::FacingMode::None;
 
-        auto* closeButton = m_api->CreateElement(closeConfig);
+        auto* closeButton = m_toolRowPool.Acquire(m_api, closeConfig);
         if (closeButton) {
             m_toolRow->AddChild(closeButton);
         }
@@ -795,7 +832,7 @@ private:
             galleryConfig.scale = 1.1f;
             galleryConfig.facingMode = P3DUI::FacingMode::None;
 
-            m_galleryButton = m_api->CreateElement(galleryConfig);
+            m_galleryButton = m_toolRowPool.Acquire(m_api, galleryConfig);
             if (m_galleryButton) {
                 m_toolRow->AddChild(m_galleryButton);
             }
@@ -811,7 +848,7 @@ private:
         groupMoveConfig.scale = 1.1f;
         groupMoveConfig.facingMode = P3DUI::FacingMode::None;
 
-        m_groupMoveButton = m_api->CreateElement(groupMoveConfig);
+        m_groupMoveButton = m_toolRowPool.Acquire(m_api, groupMoveConfig);
         if (m_groupMoveButton) {
             m_toolRow->AddChild(m_groupMoveButton);
         }
@@ -826,7 +863,7 @@ private:
         snapToGridConfig.scale = 1.1f;
         snapToGridConfig.facingMode = P3DUI::FacingMode::None;
 
-        m_snapToGridButton = m_api->CreateElement(snapToGridConfig);
+        m_snapToGridButton = m_toolRowPool.Acquire(m_api, snapToGridConfig);
         if (m_snapToGridButton) {
             m_toolRow->AddChild(m_snapToGridButton);
         }
@@ -860,11 +897,12 @@ private:
                 gridAlignConfig.tooltip = L"Align grid to selection. Select exactly 2 objects (Hold A for multi select)";
             }
 
-            m_gridAlignButton = m_api->CreateElement(gridAlignConfig);
+            m_gridAlignButton = m_toolRowPool.Acquire(m_api, gridAlignConfig);
             if (m_gridAlignButton) {
                 m_toolRow->AddChild(m_gridAlignButton);
             }
         }
+        m_toolRowPool.HideUnused();
 
         spdlog::info("SelectionMenu::PopulateToolRow - Added 2 big tool buttons + {} tool buttons",
             hasGalleryItems ? 4 : 3);
@@ -883,6 +921,10 @@ private:
     P3DUI::Element* m_snapToGridButton = nullptr;
     P3DUI::Element* m_gridAlignButton = nullptr;
 
+    // Pooled elements - reused across repopulations instead of recreated
+    MenuElementPool m_wheelPool{ "SelectionWheel" };
+    MenuElementPool m_toolRowPool{ "SelectionToolRow" };
+
     // Context menu state
     ContextMenuState m_contextMenuState = ContextMenuState::Hidden;
 
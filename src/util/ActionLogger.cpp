@@ -52,14 +52,23 @@ std::string FormatPositionDelta(const RE::NiPoint3& before, const RE::NiPoint3&
     return fmt::format("delta=({:+.1f}, {:+.1f}, {:+.1f})", dx, dy, dz);
 }
 
+bool IsEnabled()
+{
+    return Log::IsEnabled(Log::kInfo);
+}
+
 void LogHeader(const char* context, size_t objectCount)
 {
-    spdlog::info("=== {} ({} object{}) ===", context, objectCount, objectCount == 1 ? "" : "s");
+    LOG_INFO("=== {} ({} object{}) ===", context, objectCount, objectCount == 1 ? "" : "s");
 }
 
 void LogSnapshot(int index, int total, RE::FormID formId,
                  const RE::NiPoint3& pos, const RE::NiPoint3& eulerRad, float scale)
 {
+    if (!IsEnabled()) {
+        return;
+    }
+
     std::string name = GetDisplayName(formId);
     std::string transform = FormatTransform(pos, eulerRad, scale);
     spdlog::info("  [{}/{}] {} ({:08X}): {}", index, total, name, formId, transform);
@@ -69,6 +78,10 @@ void LogChange(int index, int total, RE::FormID formId,
                const RE::NiPoint3& beforePos, const RE::NiPoint3& beforeEuler, float beforeScale,
                const RE::NiPoint3& afterPos, const RE::NiPoint3& afterEuler, float afterScale)
 {
+    if (!IsEnabled()) {
+        return;
+    }
+
     std::string name = GetDisplayName(formId);
     std::string beforeStr = FormatTransform(beforePos, beforeEuler, beforeScale);
     std::string afterStr = FormatTransform(afterPos, afterEuler, afterScale);
@@ -80,4 +93,11 @@ void LogChange(int index, int total, RE::FormID formId,
     spdlog::info("    {}", delta);
 }
 
+void LogOmitted(int total)
+{
+    if (total > kMaxLoggedObjects) {
+        LOG_INFO("  ... {} more objects", total - kMaxLoggedObjects);
+    }
+}
+
 } // namespace Util::ActionLogger
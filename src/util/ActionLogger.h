@@ -18,6 +18,14 @@ namespace Util::ActionLogger {
     std::string FormatPositionDelta(const RE::NiPoint3& before, const RE::NiPoint3& after);
 
     // ========== Logging Helpers (format and print via spdlog::info) ==========
+    // All of these are no-ops (no lookups, no formatting) when info logging is off
+
+    // Per-object lines logged for one action; the rest are summarized by LogOmitted
+    // so grabbing a few hundred objects doesn't format a few hundred lines
+    constexpr int kMaxLoggedObjects = 20;
+
+    // True when info logging is enabled - check before building arguments in a loop
+    bool IsEnabled();
 
     // Log a section header: "=== context (N objects) ==="
     void LogHeader(const char* context, size_t objectCount);
@@ -35,4 +43,7 @@ namespace Util::ActionLogger {
                    const RE::NiPoint3& beforePos, const RE::NiPoint3& beforeEuler, float beforeScale,
                    const RE::NiPoint3& afterPos, const RE::NiPoint3& afterEuler, float afterScale);
 
+    // Log "  ... N more objects" after a loop capped at kMaxLoggedObjects
+    void LogOmitted(int total);
+
 } // namespace Util::ActionLogger
@@ -0,0 +1,178 @@
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace Util::AllocationCounter {
+
+#ifndef NDEBUG
+
+namespace {
+    // Trivially initialized, so operator new can touch it during thread startup
+    thread_local uint64_t t_allocations = 0;
+
+    void* Allocate(std::size_t size)
+    {
+        t_allocations++;
+        return std::malloc(size ? size : 1);
+    }
+
+    void* AllocateAligned(std::size_t size, std::align_val_t alignment)
+    {
+        t_allocations++;
+        const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+        return _aligned_malloc(size ? size : 1, align);
+#else
+        // aligned_alloc wants the size to be a multiple of the alignment
+        return std::aligned_alloc(align, ((size ? size : 1) + align - 1) / align * align);
+#endif
+    }
+
+    void FreeAligned(void* p)
+    {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+uint64_t GetThreadCount()
+{
+    return t_allocations;
+}
+
+void ResetThreadCount()
+{
+    t_allocations = 0;
+}
+
+#else
+
+uint64_t GetThreadCount()
+{
+    return 0;
+}
+
+void ResetThreadCount()
+{
+}
+
+#endif
+
+} // namespace Util::AllocationCounter
+
+#ifndef NDEBUG
+
+// Replaceable global allocation functions - these cover every new expression and
+// std::allocator in the plugin
+
+void* operator new(std::size_t size)
+{
+    if (void* p = Util::AllocationCounter::Allocate(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Util::AllocationCounter::Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Util::AllocationCounter::Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* p = Util::AllocationCounter::AllocateAligned(size, alignment)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Util::AllocationCounter::AllocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Util::AllocationCounter::AllocateAligned(size, alignment);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    Util::AllocationCounter::FreeAligned(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+    Util::AllocationCounter::FreeAligned(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    Util::AllocationCounter::FreeAligned(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    Util::AllocationCounter::FreeAligned(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Util::AllocationCounter::FreeAligned(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Util::AllocationCounter::FreeAligned(p);
+}
+
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+// =============================================================================
+// AllocationCounter - heap allocations per thread (debug builds)
+// =============================================================================
+// Debug builds replace the plugin's global operator new/delete with versions
+// that count allocations on the calling thread. FrameCallbackDispatcher resets
+// the count at frame start and reads it after the listeners ran, so edit mode
+// can be checked for zero steady-state heap allocations per frame.
+//
+// Only allocations made by this DLL are seen - the game's own heap is not.
+// Release builds compile the counter out and always report 0.
+
+namespace Util::AllocationCounter {
+
+#ifndef NDEBUG
+inline constexpr bool kEnabled = true;
+#else
+inline constexpr bool kEnabled = false;
+#endif
+
+// operator new calls on this thread since the last Reset
+uint64_t GetThreadCount();
+
+void ResetThreadCount();
+
+} // namespace Util::AllocationCounter
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace Util {
+
+// =============================================================================
+// FrameArena - bump allocator for per-frame scratch containers
+// =============================================================================
+// Scans, ray casts and hover updates build short-lived vectors and sets every
+// frame. Backing them with FrameArena instead of the heap turns each allocation
+// into a pointer bump; FrameCallbackDispatcher resets the arena at frame start,
+// which frees everything at once.
+//
+// Rules:
+// - Main thread only. Debug builds assert this.
+// - Only function-local containers, or ones handed straight back to the caller.
+//   Nothing allocated here may be kept past the end of the frame - members,
+//   statics and anything captured by deferred work must use the heap.
+//
+// If a frame needs more than the buffer holds, the rest comes from the heap
+// (counted as overflow) and the next Reset grows the buffer to fit, so a steady
+// workload settles at zero heap allocations.
+//
+// Usage:
+//   Util::FrameVector<RE::TESObjectREFR*> hits(Util::FrameArena::Get());
+//   Util::FrameSet<RE::FormID> seen(Util::FrameArena::Get());
+
+class FrameArena : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t kDefaultCapacity = 64 * 1024;
+
+    explicit FrameArena(size_t capacity = kDefaultCapacity) { Allocate(capacity); }
+
+    ~FrameArena() override
+    {
+        ReleaseOverflow();
+        ::operator delete(m_buffer, std::align_val_t{ kBufferAlignment });
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // The main thread's arena
+    static FrameArena* GetSingleton()
+    {
+        static FrameArena instance;
+        return &instance;
+    }
+
+    // Shorthand for constructing pmr containers on the main thread's arena
+    static std::pmr::memory_resource* Get() { return GetSingleton(); }
+
+    // Start a new frame. Everything allocated since the last Reset becomes
+    // invalid. Also (re)binds the arena to the calling thread.
+    void Reset()
+    {
+        if (m_overflowBytes > 0) {
+            // Grow to last frame's total so the same workload fits next time
+            const size_t needed = m_offset + m_overflowBytes;
+            ::operator delete(m_buffer, std::align_val_t{ kBufferAlignment });
+            Allocate(std::bit_ceil(needed));
+            m_growCount++;
+        }
+        ReleaseOverflow();
+
+        m_peakBytes = std::max(m_peakBytes, m_offset);
+        m_lastFrameBytes = m_offset;
+        m_offset = 0;
+        m_overflowBytes = 0;
+        m_overflowCount = 0;
+#ifndef NDEBUG
+        m_owner = std::this_thread::get_id();
+#endif
+    }
+
+    size_t GetCapacity() const { return m_capacity; }
+    size_t GetBytesUsed() const { return m_offset; }            // This frame, from the buffer
+    size_t GetLastFrameBytes() const { return m_lastFrameBytes; }
+    size_t GetPeakBytes() const { return std::max(m_peakBytes, m_offset); }
+    size_t GetOverflowCount() const { return m_overflowCount; }  // This frame, from the heap
+    size_t GetGrowCount() const { return m_growCount; }
+
+private:
+    static constexpr size_t kBufferAlignment = alignof(std::max_align_t) < 16 ? 16 : alignof(std::max_align_t);
+
+    // Heap block for an allocation that did not fit; chained so Reset can free them
+    struct OverflowBlock {
+        OverflowBlock* next;
+        size_t alignment;
+    };
+
+    void Allocate(size_t capacity)
+    {
+        m_capacity = capacity;
+        m_buffer = static_cast<std::byte*>(::operator new(capacity, std::align_val_t{ kBufferAlignment }));
+    }
+
+    void ReleaseOverflow()
+    {
+        while (m_overflow) {
+            OverflowBlock* next = m_overflow->next;
+            ::operator delete(m_overflow, std::align_val_t{ m_overflow->alignment });
+            m_overflow = next;
+        }
+    }
+
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+#ifndef NDEBUG
+        assert((m_owner == std::thread::id{} || m_owner == std::this_thread::get_id()) &&
+               "FrameArena used off the main thread");
+#endif
+        const uintptr_t base = reinterpret_cast<uintptr_t>(m_buffer);
+        const uintptr_t aligned = (base + m_offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        const size_t end = static_cast<size_t>(aligned - base) + bytes;
+        if (end <= m_capacity) {
+            m_offset = end;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // Header sits in front of the payload, padded out to the payload's alignment
+        const size_t blockAlignment = std::max(alignment, alignof(OverflowBlock));
+        const size_t header = (sizeof(OverflowBlock) + blockAlignment - 1) & ~(blockAlignment - 1);
+        auto* block = static_cast<OverflowBlock*>(::operator new(header + bytes, std::align_val_t{ blockAlignment }));
+        block->next = m_overflow;
+        block->alignment = blockAlignment;
+        m_overflow = block;
+        m_overflowBytes += bytes + alignment;
+        m_overflowCount++;
+        return reinterpret_cast<std::byte*>(block) + header;
+    }
+
+    void do_deallocate(void*, size_t, size_t) override
+    {
+        // Bump allocator: memory comes back all at once in Reset
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::byte* m_buffer = nullptr;
+    size_t m_capacity = 0;
+    size_t m_offset = 0;
+
+    OverflowBlock* m_overflow = nullptr;
+    size_t m_overflowBytes = 0;
+    size_t m_overflowCount = 0;
+
+    size_t m_lastFrameBytes = 0;
+    size_t m_peakBytes = 0;
+    size_t m_growCount = 0;
+
+#ifndef NDEBUG
+    std::thread::id m_owner;
+#endif
+};
+
+template <typename T>
+using FrameVector = std::pmr::vector<T>;
+
+template <typename T>
+using FrameSet = std::pmr::unordered_set<T>;
+
+} // namespace Util
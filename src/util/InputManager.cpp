@@ -1,5 +1,6 @@
 #include "InputManager.h"
 #include "MenuChecker.h"
+#include "InputRecorder.h"
 #include "../log.h"
 #include "../interfaces/ThreeDUIInterface001.h"
 #include <algorithm>
@@ -269,6 +270,23 @@ bool InputManager::OnControllerStateChanged(
 		return false;  // Unknown device
 	}
 
+	// A replay owns the callback pipeline - live input passes to the game untouched
+	if (InputReplay::GetSingleton()->IsActive()) {
+		return false;
+	}
+
+	InputRecorder::GetSingleton()->RecordControllerState(isLeft, *pOutputControllerState);
+
+	return instance->ProcessControllerState(handIndex, isLeft, pOutputControllerState);
+}
+
+void InputManager::InjectControllerState(bool isLeft, vr::VRControllerState_t& state)
+{
+	ProcessControllerState(isLeft ? 0 : 1, isLeft, &state);
+}
+
+bool InputManager::ProcessControllerState(int handIndex, bool isLeft, vr::VRControllerState_t* pOutputControllerState)
+{
 	// IMPORTANT: Read from pOutputControllerState, not pControllerState!
 	// Other DLLs (like 3DUI) may have already processed and blocked buttons.
 	// By reading from the output state, we see what's left after their processing.
@@ -316,18 +334,18 @@ bool InputManager::OnControllerStateChanged(
 	}
 
 	if (pressedToProcess) {
-		uint64_t blocked = instance->InvokeButtonCallbacks(isLeft, false, pressedToProcess);
+		uint64_t blocked = InvokeButtonCallbacks(isLeft, false, pressedToProcess);
 		s_blockedHeldButtons[handIndex] |= blocked;  // Remember blocked buttons while held
 	}
 
 	if (releasedToProcess) {
-		instance->InvokeButtonCallbacks(isLeft, true, releasedToProcess);
+		InvokeButtonCallbacks(isLeft, true, releasedToProcess);
 		s_blockedHeldButtons[handIndex] &= ~releasedToProcess;  // Stop blocking on release
 	}
 
 	// Invoke axis callbacks and track which axes to block
 	// Use pOutputControllerState for the same reason as buttons - see other DLLs' modifications
-	uint32_t axisBlocked = instance->InvokeAxisCallbacks(isLeft, pOutputControllerState);
+	uint32_t axisBlocked = InvokeAxisCallbacks(isLeft, pOutputControllerState);
 	s_blockedAxes[handIndex] = axisBlocked;
 
 	// Block consumed buttons from reaching the game - every frame while held
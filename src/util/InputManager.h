@@ -38,6 +38,10 @@ public:
 	// Remove an axis callback by its ID
 	void RemoveVrAxisCallback(CallbackId id);
 
+	// Feed a controller state through the callback pipeline as if OpenVR had reported it
+	// (used by InputReplay). state is modified the same way as the live output state.
+	void InjectControllerState(bool isLeft, vr::VRControllerState_t& state);
+
 private:
 	InputManager() = default;
 	~InputManager() = default;
@@ -50,6 +54,9 @@ private:
 		uint32_t unControllerStateSize,
 		vr::VRControllerState_t* pOutputControllerState);
 
+	// Shared by the OpenVR hook and InjectControllerState - returns true if anything is blocked
+	bool ProcessControllerState(int handIndex, bool isLeft, vr::VRControllerState_t* pOutputControllerState);
+
 	uint64_t InvokeButtonCallbacks(bool isLeft, bool isReleased, uint64_t changedButtons);
 	uint32_t InvokeAxisCallbacks(bool isLeft, const vr::VRControllerState_t* state);
 	static const char* GetButtonName(uint64_t buttonMask);
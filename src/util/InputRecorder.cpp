@@ -0,0 +1,237 @@
+#include "InputRecorder.h"
+#include "InputManager.h"
+#include "VRNodes.h"
+#include "../log.h"
+#include <ctime>
+#include <format>
+
+namespace {
+    using namespace Util::InputTrace;
+
+    static_assert(vr::k_unControllerStateAxisCount == kAxisCount);
+
+    ControllerSample ToSample(const vr::VRControllerState_t& state)
+    {
+        ControllerSample sample;
+        sample.packetNum = state.unPacketNum;
+        sample.buttonPressed = state.ulButtonPressed;
+        sample.buttonTouched = state.ulButtonTouched;
+        for (size_t i = 0; i < kAxisCount; ++i) {
+            sample.axis[i][0] = state.rAxis[i].x;
+            sample.axis[i][1] = state.rAxis[i].y;
+        }
+        return sample;
+    }
+
+    vr::VRControllerState_t ToState(const ControllerSample& sample)
+    {
+        vr::VRControllerState_t state{};
+        state.unPacketNum = sample.packetNum;
+        state.ulButtonPressed = sample.buttonPressed;
+        state.ulButtonTouched = sample.buttonTouched;
+        for (size_t i = 0; i < kAxisCount; ++i) {
+            state.rAxis[i].x = sample.axis[i][0];
+            state.rAxis[i].y = sample.axis[i][1];
+        }
+        return state;
+    }
+
+    // Returns false (pose left untouched) when the node is missing
+    bool ReadPose(RE::NiAVObject* node, Pose& pose)
+    {
+        if (!node) return false;
+        const auto& world = node->world;
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                pose.rotate[r][c] = world.rotate.entry[r][c];
+            }
+        }
+        pose.translate[0] = world.translate.x;
+        pose.translate[1] = world.translate.y;
+        pose.translate[2] = world.translate.z;
+        return true;
+    }
+
+    void WritePose(RE::NiAVObject* node, const Pose& pose)
+    {
+        if (!node) return;
+        auto& world = node->world;
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                world.rotate.entry[r][c] = pose.rotate[r][c];
+            }
+        }
+        world.translate = RE::NiPoint3(pose.translate[0], pose.translate[1], pose.translate[2]);
+    }
+
+    std::optional<std::filesystem::path> LogsFolder()
+    {
+        auto logsFolder = SKSE::log::log_directory();
+        if (!logsFolder) {
+            spdlog::error("InputRecorder: SKSE log directory not available");
+        }
+        return logsFolder;
+    }
+}
+
+// =============================================================================
+// InputRecorder
+// =============================================================================
+
+InputRecorder* InputRecorder::GetSingleton()
+{
+    static InputRecorder instance;
+    return &instance;
+}
+
+void InputRecorder::StartRecording()
+{
+    if (InputReplay::GetSingleton()->IsActive()) {
+        spdlog::warn("InputRecorder: Cannot record while a replay is running");
+        return;
+    }
+
+    m_writer = std::make_unique<Writer>();
+    m_writer->Reserve(kInitialBufferBytes);
+    m_startTime = std::chrono::steady_clock::now();
+    spdlog::info("InputRecorder: Recording started");
+}
+
+std::string InputRecorder::StopRecording()
+{
+    if (!m_writer) {
+        return {};
+    }
+    auto writer = std::move(m_writer);
+
+    auto logsFolder = LogsFolder();
+    if (!logsFolder) {
+        return {};
+    }
+
+    const std::time_t now = std::time(nullptr);
+    std::tm local{};
+    localtime_s(&local, &now);
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &local);
+    const auto path = *logsFolder / std::format("VREditor_input_{}.vrtrace", stamp);
+
+    if (!writer->Save(path)) {
+        spdlog::error("InputRecorder: Failed writing {}", path.string());
+        return {};
+    }
+
+    spdlog::info("InputRecorder: Wrote {} frames, {} controller states ({} KB) to {}",
+        writer->GetFrameCount(), writer->GetControllerCount(), writer->GetBuffer().size() / 1024, path.string());
+    return path.string();
+}
+
+uint64_t InputRecorder::ElapsedUs() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - m_startTime).count());
+}
+
+void InputRecorder::RecordControllerState(bool isLeft, const vr::VRControllerState_t& state)
+{
+    if (m_writer) {
+        m_writer->AddController(ElapsedUs(), isLeft, ToSample(state));
+    }
+}
+
+void InputRecorder::RecordFrame(float deltaTime)
+{
+    if (!m_writer) {
+        return;
+    }
+
+    FramePoses poses;
+    if (ReadPose(VRNodes::GetHMD(), poses.hmd)) poses.mask |= kPoseHmd;
+    if (ReadPose(VRNodes::GetLeftHand(), poses.left)) poses.mask |= kPoseLeft;
+    if (ReadPose(VRNodes::GetRightHand(), poses.right)) poses.mask |= kPoseRight;
+
+    m_writer->AddFrame(ElapsedUs(), deltaTime, poses);
+}
+
+// =============================================================================
+// InputReplay
+// =============================================================================
+
+InputReplay* InputReplay::GetSingleton()
+{
+    static InputReplay instance;
+    return &instance;
+}
+
+bool InputReplay::StartReplay(const std::filesystem::path& path)
+{
+    if (InputRecorder::GetSingleton()->IsRecording()) {
+        spdlog::warn("InputReplay: Cannot replay while recording");
+        return false;
+    }
+
+    std::filesystem::path resolved = path;
+    if (resolved.is_relative()) {
+        auto logsFolder = LogsFolder();
+        if (!logsFolder) {
+            return false;
+        }
+        resolved = *logsFolder / path;
+    }
+
+    auto records = Load(resolved);
+    if (!records) {
+        spdlog::error("InputReplay: {} is missing or not a valid input trace", resolved.string());
+        return false;
+    }
+
+    spdlog::info("InputReplay: Replaying {} records from {}", records->size(), resolved.string());
+    m_replayer = std::make_unique<Replayer>(std::move(*records));
+    m_startTime = std::chrono::steady_clock::now();
+    return true;
+}
+
+void InputReplay::StopReplay()
+{
+    if (!m_replayer) {
+        return;
+    }
+
+    const float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_startTime).count();
+    spdlog::info("InputReplay: Stopped after {} frames ({:.2f} s)", m_replayer->GetFramesPlayed(), seconds);
+    m_replayer.reset();
+}
+
+float InputReplay::AdvanceFrame(float liveDeltaTime)
+{
+    if (!m_replayer) {
+        return liveDeltaTime;
+    }
+
+    if (!m_replayer->StepFrame(*this)) {
+        StopReplay();
+        return liveDeltaTime;
+    }
+    return m_frameDeltaTime;
+}
+
+void InputReplay::ApplyControllerState(bool isLeft, const ControllerSample& sample)
+{
+    auto state = ToState(sample);
+    InputManager::GetSingleton()->InjectControllerState(isLeft, state);
+}
+
+void InputReplay::ApplyPoses(const FramePoses& poses)
+{
+    // The game refreshes these nodes every frame, so the override only lasts for
+    // this frame's listeners - exactly the window the replay needs
+    if (poses.mask & kPoseHmd) WritePose(VRNodes::GetHMD(), poses.hmd);
+    if (poses.mask & kPoseLeft) WritePose(VRNodes::GetLeftHand(), poses.left);
+    if (poses.mask & kPoseRight) WritePose(VRNodes::GetRightHand(), poses.right);
+}
+
+void InputReplay::RunFrame(float deltaTime)
+{
+    // FrameCallbackDispatcher runs the listeners with the returned delta
+    m_frameDeltaTime = deltaTime;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "InputTrace.h"
+#include "VRHookAPI.h"
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+// =============================================================================
+// InputRecorder / InputReplay - game side of Util::InputTrace
+// =============================================================================
+// InputRecorder captures every controller state InputManager receives and, once
+// per frame, the delta time and HMD/hand poses, then writes the session to
+// <SKSE logs>/VREditor_input_<time>.vrtrace.
+//
+// InputReplay plays such a file back: each frame it injects the recorded
+// controller states into InputManager, overwrites the HMD/wand node world
+// transforms with the recorded poses and hands the recorded delta time to
+// FrameCallbackDispatcher. Live controller input is ignored while replaying.
+//
+// Both run on the main thread (controller callbacks and frame hook). Start/stop
+// from Papyrus goes through the SKSE task queue.
+
+class InputRecorder
+{
+public:
+    static InputRecorder* GetSingleton();
+
+    void StartRecording();
+
+    // Stop and write the trace; returns the file path, or empty if nothing was written
+    std::string StopRecording();
+
+    bool IsRecording() const { return m_writer != nullptr; }
+
+    // Called by InputManager for every controller state of a known hand
+    void RecordControllerState(bool isLeft, const vr::VRControllerState_t& state);
+
+    // Called by FrameCallbackDispatcher before listeners run
+    void RecordFrame(float deltaTime);
+
+private:
+    InputRecorder() = default;
+    ~InputRecorder() = default;
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    uint64_t ElapsedUs() const;
+
+    // ~1 MB covers about two minutes at 90 fps with both controllers
+    static constexpr size_t kInitialBufferBytes = 1 << 20;
+
+    std::unique_ptr<Util::InputTrace::Writer> m_writer;
+    std::chrono::steady_clock::time_point m_startTime;
+};
+
+class InputReplay : public Util::InputTrace::IReplaySink
+{
+public:
+    static InputReplay* GetSingleton();
+
+    // Load a trace (relative paths resolve against the SKSE log folder) and
+    // start replaying it on the next frame
+    bool StartReplay(const std::filesystem::path& path);
+    void StopReplay();
+
+    bool IsActive() const { return m_replayer != nullptr; }
+
+    // Called by FrameCallbackDispatcher each frame while active. Applies the next
+    // recorded frame and returns its delta time (liveDeltaTime once finished).
+    float AdvanceFrame(float liveDeltaTime);
+
+    // Util::InputTrace::IReplaySink
+    void ApplyControllerState(bool isLeft, const Util::InputTrace::ControllerSample& sample) override;
+    void ApplyPoses(const Util::InputTrace::FramePoses& poses) override;
+    void RunFrame(float deltaTime) override;
+
+private:
+    InputReplay() = default;
+    ~InputReplay() override = default;
+    InputReplay(const InputReplay&) = delete;
+    InputReplay& operator=(const InputReplay&) = delete;
+
+    std::unique_ptr<Util::InputTrace::Replayer> m_replayer;
+    float m_frameDeltaTime = 0.0f;
+    std::chrono::steady_clock::time_point m_startTime;
+};
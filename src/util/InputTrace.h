@@ -0,0 +1,304 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+// =============================================================================
+// InputTrace - compact binary recording of VR input, replayable headless
+// =============================================================================
+// A trace is the sequence of controller states (one per OpenVR state callback,
+// as InputManager sees them) and frames (delta time plus HMD/hand poses taken at
+// the start of FrameCallbackDispatcher::Update), in the order they happened.
+//
+// Replaying walks the same sequence through an IReplaySink: every controller
+// state recorded before a frame is delivered, then the frame's poses, then the
+// frame itself with its recorded delta time. The game sink feeds InputManager and
+// the dispatcher (InputRecorder.h). Tests provide their own sinks without the
+// game or a headset: one checks a session's records and ordering, one runs the
+// sphere selection scan (WorldQuery.h) on a simulated world. The game's frame
+// listeners themselves only run in game.
+//
+// Deliberately free of game and OpenVR types - ControllerSample mirrors
+// vr::VRControllerState_t and Pose mirrors the rotation/translation of an
+// NiTransform; the conversions live with the game-side recorder.
+//
+// File layout (little-endian, no padding):
+//   Header  "VRIT" | uint32 version
+//   Record  uint8 type | uint64 timeUs (since recording start) | payload
+//     kController  uint8 hand (0 = left, 1 = right) | ControllerSample
+//     kFrame       float deltaTime | uint8 poseMask | Pose hmd | Pose left | Pose right
+
+namespace Util::InputTrace {
+
+    inline constexpr char kMagic[4] = { 'V', 'R', 'I', 'T' };
+    inline constexpr uint32_t kVersion = 2;
+    inline constexpr size_t kHeaderSize = sizeof(kMagic) + sizeof(kVersion);
+
+    // vr::k_unControllerStateAxisCount
+    inline constexpr size_t kAxisCount = 5;
+
+    struct ControllerSample {
+        uint32_t packetNum = 0;
+        uint64_t buttonPressed = 0;
+        uint64_t buttonTouched = 0;
+        float axis[kAxisCount][2] = {};
+    };
+
+    struct Pose {
+        float rotate[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+        float translate[3] = {};
+    };
+
+    enum PoseMask : uint8_t {
+        kPoseHmd = 1 << 0,
+        kPoseLeft = 1 << 1,
+        kPoseRight = 1 << 2,
+    };
+
+    struct FramePoses {
+        uint8_t mask = 0;  // PoseMask bits - a missing node is not replayed
+        Pose hmd;
+        Pose left;
+        Pose right;
+    };
+
+    enum class RecordType : uint8_t {
+        kController = 1,
+        kFrame = 2,
+    };
+
+    struct Record {
+        RecordType type = RecordType::kFrame;
+        uint64_t timeUs = 0;
+
+        // kController
+        bool isLeft = false;
+        ControllerSample controller;
+
+        // kFrame
+        float deltaTime = 0.0f;
+        FramePoses poses;
+    };
+
+    namespace detail {
+        template <typename T>
+        void Put(std::vector<uint8_t>& out, const T& value)
+        {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+
+        inline void PutPose(std::vector<uint8_t>& out, const Pose& pose)
+        {
+            for (const auto& row : pose.rotate) {
+                for (float v : row) Put(out, v);
+            }
+            for (float v : pose.translate) Put(out, v);
+        }
+
+        // Bounds-checked cursor over a loaded trace
+        struct Cursor {
+            const uint8_t* data;
+            size_t size;
+            size_t offset = 0;
+
+            template <typename T>
+            bool Get(T& value)
+            {
+                if (size - offset < sizeof(T)) return false;
+                std::memcpy(&value, data + offset, sizeof(T));
+                offset += sizeof(T);
+                return true;
+            }
+
+            bool GetPose(Pose& pose)
+            {
+                for (auto& row : pose.rotate) {
+                    for (float& v : row) {
+                        if (!Get(v)) return false;
+                    }
+                }
+                for (float& v : pose.translate) {
+                    if (!Get(v)) return false;
+                }
+                return true;
+            }
+        };
+    }
+
+    // Appends records to an in-memory buffer; Save() writes it out in one go so
+    // recording never touches the disk mid-session
+    class Writer
+    {
+    public:
+        Writer()
+        {
+            m_buffer.reserve(kHeaderSize);
+            m_buffer.insert(m_buffer.end(), std::begin(kMagic), std::end(kMagic));
+            detail::Put(m_buffer, kVersion);
+        }
+
+        void Reserve(size_t bytes) { m_buffer.reserve(bytes); }
+
+        void AddController(uint64_t timeUs, bool isLeft, const ControllerSample& sample)
+        {
+            detail::Put(m_buffer, RecordType::kController);
+            detail::Put(m_buffer, timeUs);
+            detail::Put(m_buffer, static_cast<uint8_t>(isLeft ? 0 : 1));
+            detail::Put(m_buffer, sample.packetNum);
+            detail::Put(m_buffer, sample.buttonPressed);
+            detail::Put(m_buffer, sample.buttonTouched);
+            for (const auto& axis : sample.axis) {
+                detail::Put(m_buffer, axis[0]);
+                detail::Put(m_buffer, axis[1]);
+            }
+            m_controllerCount++;
+        }
+
+        void AddFrame(uint64_t timeUs, float deltaTime, const FramePoses& poses)
+        {
+            detail::Put(m_buffer, RecordType::kFrame);
+            detail::Put(m_buffer, timeUs);
+            detail::Put(m_buffer, deltaTime);
+            detail::Put(m_buffer, poses.mask);
+            detail::PutPose(m_buffer, poses.hmd);
+            detail::PutPose(m_buffer, poses.left);
+            detail::PutPose(m_buffer, poses.right);
+            m_frameCount++;
+        }
+
+        const std::vector<uint8_t>& GetBuffer() const { return m_buffer; }
+        size_t GetFrameCount() const { return m_frameCount; }
+        size_t GetControllerCount() const { return m_controllerCount; }
+
+        bool Save(const std::filesystem::path& path) const
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file) return false;
+            file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+            return static_cast<bool>(file);
+        }
+
+    private:
+        std::vector<uint8_t> m_buffer;
+        size_t m_frameCount = 0;
+        size_t m_controllerCount = 0;
+    };
+
+    // Parse a whole trace. Returns nullopt on a bad header or a truncated/unknown
+    // record - a partial trace would replay a different session.
+    inline std::optional<std::vector<Record>> Parse(const uint8_t* data, size_t size)
+    {
+        detail::Cursor cursor{ data, size };
+
+        char magic[4];
+        uint32_t version = 0;
+        if (!cursor.Get(magic) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+            !cursor.Get(version) || version != kVersion) {
+            return std::nullopt;
+        }
+
+        std::vector<Record> records;
+        while (cursor.offset < size) {
+            Record record;
+            if (!cursor.Get(record.type) || !cursor.Get(record.timeUs)) {
+                return std::nullopt;
+            }
+
+            bool ok = false;
+            switch (record.type) {
+            case RecordType::kController: {
+                uint8_t hand = 0;
+                auto& sample = record.controller;
+                ok = cursor.Get(hand) && hand <= 1 && cursor.Get(sample.packetNum) &&
+                     cursor.Get(sample.buttonPressed) && cursor.Get(sample.buttonTouched);
+                for (auto& axis : sample.axis) {
+                    ok = ok && cursor.Get(axis[0]) && cursor.Get(axis[1]);
+                }
+                record.isLeft = hand == 0;
+                break;
+            }
+            case RecordType::kFrame: {
+                auto& poses = record.poses;
+                ok = cursor.Get(record.deltaTime) && cursor.Get(poses.mask) &&
+                     cursor.GetPose(poses.hmd) && cursor.GetPose(poses.left) && cursor.GetPose(poses.right);
+                break;
+            }
+            }
+
+            if (!ok) {
+                return std::nullopt;
+            }
+            records.push_back(record);
+        }
+        return records;
+    }
+
+    inline std::optional<std::vector<Record>> Load(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return std::nullopt;
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        return Parse(bytes.data(), bytes.size());
+    }
+
+    // Receives a replayed trace - implemented by the game (InputReplay) and by tests
+    class IReplaySink
+    {
+    public:
+        virtual ~IReplaySink() = default;
+
+        virtual void ApplyControllerState(bool isLeft, const ControllerSample& sample) = 0;
+        virtual void ApplyPoses(const FramePoses& poses) = 0;
+        virtual void RunFrame(float deltaTime) = 0;
+    };
+
+    // Steps through a parsed trace one frame at a time
+    class Replayer
+    {
+    public:
+        explicit Replayer(std::vector<Record> records) :
+            m_records(std::move(records))
+        {}
+
+        // Deliver the controller states leading up to the next frame, then the
+        // frame. Returns false once the trace is exhausted (trailing controller
+        // states without a frame are still delivered).
+        bool StepFrame(IReplaySink& sink)
+        {
+            while (m_next < m_records.size()) {
+                const Record& record = m_records[m_next++];
+                if (record.type == RecordType::kController) {
+                    sink.ApplyControllerState(record.isLeft, record.controller);
+                    continue;
+                }
+                sink.ApplyPoses(record.poses);
+                sink.RunFrame(record.deltaTime);
+                m_framesPlayed++;
+                return true;
+            }
+            return false;
+        }
+
+        void Rewind()
+        {
+            m_next = 0;
+            m_framesPlayed = 0;
+        }
+
+        bool IsFinished() const { return m_next >= m_records.size(); }
+        size_t GetFramesPlayed() const { return m_framesPlayed; }
+
+    private:
+        std::vector<Record> m_records;
+        size_t m_next = 0;
+        size_t m_framesPlayed = 0;
+    };
+
+} // namespace Util::InputTrace
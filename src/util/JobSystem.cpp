@@ -0,0 +1,323 @@
+#include "JobSystem.h"
+#if defined(TEST_ENVIRONMENT)
+#include "TestStubs.h"  // spdlog
+#endif
+#include "../log.h"
+#include <algorithm>
+#include <chrono>
+
+namespace Util {
+
+namespace {
+    // Which pool and deque the current thread works for (outside threads: none)
+    struct WorkerIdentity {
+        const JobSystem* owner = nullptr;
+        size_t index = 0;
+    };
+    thread_local WorkerIdentity t_worker;
+}
+
+// ============================================================================
+// JobSystem
+// ============================================================================
+
+JobSystem* JobSystem::GetSingleton()
+{
+    // Never destroyed: at process exit the OS has already stopped the workers
+    // (possibly while one held a deque lock), so they could not be joined
+    static JobSystem* instance = new JobSystem();
+    return instance;
+}
+
+JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+size_t JobSystem::GetDefaultWorkerCount()
+{
+    const size_t hardwareThreads = std::thread::hardware_concurrency();
+    return std::clamp<size_t>(hardwareThreads / 2, 1, 4);
+}
+
+void JobSystem::Start(size_t workerCount)
+{
+    if (IsRunning()) {
+        spdlog::warn("JobSystem: Already running with {} workers", m_workers.size());
+        return;
+    }
+
+    if (workerCount == 0) {
+        workerCount = GetDefaultWorkerCount();
+    }
+
+    m_stopping = false;
+    m_workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+    // Every deque exists before the first worker starts stealing
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_workers[i]->thread = std::thread(&JobSystem::WorkerLoop, this, i);
+    }
+    m_running.store(true, std::memory_order_release);
+
+    spdlog::info("JobSystem: Started {} workers", workerCount);
+}
+
+void JobSystem::Shutdown()
+{
+    if (!IsRunning()) {
+        return;
+    }
+
+    // From here on jobs scheduled by the draining workers run inline
+    m_running.store(false, std::memory_order_release);
+    {
+        std::lock_guard lock(m_sleepMutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker->thread.join();
+    }
+
+    // Nothing can be left unless an outside thread broke the rules above
+    Job job;
+    while (TryPop(job)) {
+        RunJob(job);
+    }
+
+    m_workers.clear();
+    spdlog::info("JobSystem: Shut down");
+}
+
+void JobSystem::Schedule(Job job)
+{
+    if (!IsRunning()) {
+        RunJob(job);
+        return;
+    }
+
+    // Workers keep their own jobs; outside jobs are dealt round-robin
+    const size_t index = (t_worker.owner == this)
+        ? t_worker.index
+        : m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+
+    Worker& worker = *m_workers[index];
+    {
+        std::lock_guard lock(worker.mutex);
+        worker.jobs.push_back(std::move(job));
+    }
+    m_queuedCount.fetch_add(1);
+
+    // A worker counts itself as sleeping before it checks m_queuedCount, so
+    // either it sees the job or we see it and wake it
+    if (m_sleeping.load() > 0) {
+        std::lock_guard lock(m_sleepMutex);
+        m_wake.notify_one();
+    }
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& body)
+{
+    grainSize = std::max<size_t>(grainSize, 1);
+    if (count <= grainSize || !IsRunning()) {
+        if (count > 0) {
+            body(0, count);
+        }
+        return;
+    }
+
+    JobGroup group(this);
+    size_t begin = 0;
+    for (; begin + grainSize < count; begin += grainSize) {
+        group.Run([&body, begin, end = begin + grainSize] { body(begin, end); });
+    }
+
+    // The last chunk runs here; the wait then helps with the others
+    body(begin, count);
+    group.Wait();
+}
+
+bool JobSystem::TryRunOne()
+{
+    Job job;
+    if (!TryPop(job)) {
+        return false;
+    }
+    RunJob(job);
+    return true;
+}
+
+bool JobSystem::TryPop(Job& job)
+{
+    if (m_queuedCount.load() == 0 || m_workers.empty()) {
+        return false;
+    }
+
+    if (t_worker.owner == this) {
+        Worker& own = *m_workers[t_worker.index];
+        std::lock_guard lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            m_queuedCount.fetch_sub(1);
+            return true;
+        }
+    }
+
+    const size_t thiefIndex = (t_worker.owner == this)
+        ? t_worker.index
+        : m_nextWorker.load(std::memory_order_relaxed);
+    return TrySteal(thiefIndex, job);
+}
+
+bool JobSystem::TrySteal(size_t thiefIndex, Job& job)
+{
+    // Oldest job first - usually the biggest piece of the victim's work
+    const size_t count = m_workers.size();
+    for (size_t offset = 1; offset <= count; ++offset) {
+        Worker& victim = *m_workers[(thiefIndex + offset) % count];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            m_queuedCount.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::RunJob(Job& job)
+{
+    try {
+        job();
+    } catch (const std::exception& e) {
+        spdlog::error("JobSystem: Job threw: {}", e.what());
+    } catch (...) {
+        spdlog::error("JobSystem: Job threw an unknown exception");
+    }
+    job = nullptr;  // Release captures on the thread that ran the job
+}
+
+void JobSystem::WorkerLoop(size_t index)
+{
+    t_worker = { this, index };
+
+    Job job;
+    while (true) {
+        if (TryPop(job)) {
+            RunJob(job);
+            continue;
+        }
+
+        std::unique_lock lock(m_sleepMutex);
+        if (m_stopping && m_queuedCount.load() == 0) {
+            break;
+        }
+        m_sleeping.fetch_add(1);
+        m_wake.wait(lock, [this] { return m_queuedCount.load() > 0 || m_stopping; });
+        m_sleeping.fetch_sub(1);
+    }
+
+    t_worker = {};
+}
+
+void JobSystem::RunOnMainThread(Job job)
+{
+    std::lock_guard lock(m_mainThreadMutex);
+    m_mainThreadJobs.push_back(std::move(job));
+}
+
+size_t JobSystem::RunMainThreadContinuations()
+{
+    std::vector<Job> jobs;
+    {
+        std::lock_guard lock(m_mainThreadMutex);
+        if (m_mainThreadJobs.empty()) {
+            return 0;
+        }
+        jobs.swap(m_mainThreadJobs);
+    }
+
+    for (auto& job : jobs) {
+        RunJob(job);
+    }
+    return jobs.size();
+}
+
+size_t JobSystem::GetPendingContinuationCount() const
+{
+    std::lock_guard lock(m_mainThreadMutex);
+    return m_mainThreadJobs.size();
+}
+
+void JobSystem::OnFrameUpdate(float)
+{
+    RunMainThreadContinuations();
+}
+
+// ============================================================================
+// JobGroup
+// ============================================================================
+
+JobGroup::~JobGroup()
+{
+    WaitForJobs();
+}
+
+void JobGroup::Run(JobSystem::Job job)
+{
+    m_pending.fetch_add(1);
+    m_jobSystem->Schedule([this, job = std::move(job)] {
+        try {
+            job();
+        } catch (...) {
+            std::lock_guard lock(m_mutex);
+            if (!m_exception) {
+                m_exception = std::current_exception();
+            }
+        }
+
+        // Under the lock: once Wait sees zero it may destroy the group
+        std::lock_guard lock(m_mutex);
+        if (m_pending.fetch_sub(1) == 1) {
+            m_done.notify_all();
+        }
+    });
+}
+
+void JobGroup::Wait()
+{
+    WaitForJobs();
+
+    std::exception_ptr exception;
+    {
+        std::lock_guard lock(m_mutex);
+        exception = std::exchange(m_exception, nullptr);
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void JobGroup::WaitForJobs()
+{
+    while (m_pending.load() > 0) {
+        if (m_jobSystem->TryRunOne()) {
+            continue;
+        }
+
+        // Our jobs are running elsewhere; they may still fork stealable work
+        std::unique_lock lock(m_mutex);
+        m_done.wait_for(lock, std::chrono::milliseconds(1), [this] { return m_pending.load() == 0; });
+    }
+
+    // The last job notifies under the lock - wait for it to let go
+    std::lock_guard lock(m_mutex);
+}
+
+} // namespace Util
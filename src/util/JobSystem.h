@@ -0,0 +1,179 @@
+#pragma once
+
+#include "../IFrameUpdateListener.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Util {
+
+// =============================================================================
+// JobSystem - work-stealing thread pool for game-independent background work
+// =============================================================================
+// Parsing, formatting, hashing and file writes that do not touch game objects
+// can run here instead of on the main thread.
+//
+// Each worker owns a deque: it pushes and pops its own jobs at the back (the
+// most recent job's data is still in cache) and idle workers steal from the
+// front of the others. Jobs scheduled from outside the pool are dealt
+// round-robin across the deques.
+//
+// - Schedule(job): fire and forget.
+// - JobGroup: fork/join. Wait() runs queued jobs while it waits, so groups can
+//   nest and a worker waiting on a group never blocks the pool.
+// - RunOnMainThread / ScheduleThen: continuations. They are queued and run by
+//   OnFrameUpdate, which FrameCallbackDispatcher calls every frame - the place
+//   to touch game objects with a job's results.
+//
+// Jobs must not throw past a JobGroup (the first exception is rethrown by
+// Wait); an exception escaping a plain Schedule() job is logged and dropped.
+//
+// Before Start() and after Shutdown() jobs run inline on the calling thread.
+//
+// Lifetime: plugin.cpp starts the pool on kPostLoad with iJobWorkerCount
+// workers. Shutdown() runs what is still queued, then joins the workers; other
+// instances (tests, benchmarks) shut down when destroyed.
+class JobSystem : public IFrameUpdateListener
+{
+public:
+    using Job = std::function<void()>;
+
+    static JobSystem* GetSingleton();
+
+    JobSystem() = default;
+    ~JobSystem() override;
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // ========== Lifecycle ==========
+
+    // Start workerCount workers (0 = GetDefaultWorkerCount())
+    void Start(size_t workerCount = 0);
+
+    // Run the queued jobs, then stop and join the workers
+    // Start and Shutdown belong to one thread, with no other thread scheduling
+    // jobs meanwhile. Queued main-thread continuations are kept.
+    void Shutdown();
+
+    bool IsRunning() const { return m_running.load(std::memory_order_acquire); }
+    size_t GetWorkerCount() const { return m_workers.size(); }
+
+    // Half the hardware threads, 1..4 - the game keeps the other cores busy
+    static size_t GetDefaultWorkerCount();
+
+    // ========== Jobs ==========
+
+    void Schedule(Job job);
+
+    // Run work on a worker, then then(result) on the main thread
+    template <typename Work, typename Then>
+    void ScheduleThen(Work work, Then then)
+    {
+        Schedule([this, work = std::move(work), then = std::move(then)]() mutable {
+            if constexpr (std::is_void_v<std::invoke_result_t<Work&>>) {
+                work();
+                RunOnMainThread(std::move(then));
+            } else {
+                auto result = std::make_shared<std::invoke_result_t<Work&>>(work());
+                RunOnMainThread([then = std::move(then), result]() mutable { then(std::move(*result)); });
+            }
+        });
+    }
+
+    // Split [0, count) into chunks of at most grainSize and call body(begin, end)
+    // for each in parallel; returns when all chunks are done
+    void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& body);
+
+    // Run one queued job on the calling thread; false if there was none
+    bool TryRunOne();
+
+    // ========== Main thread ==========
+
+    // Queue a continuation for the next OnFrameUpdate (any thread)
+    void RunOnMainThread(Job job);
+
+    // Run the continuations queued so far; ones they queue wait for the next frame
+    // Returns the number run
+    size_t RunMainThreadContinuations();
+
+    size_t GetPendingContinuationCount() const;
+
+    // IFrameUpdateListener - registered with FrameCallbackDispatcher (not edit-mode only)
+    void OnFrameUpdate(float deltaTime) override;
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+        std::thread thread;
+    };
+
+    void WorkerLoop(size_t index);
+
+    // Pop from the calling worker's own deque (back), else steal (front)
+    bool TryPop(Job& job);
+    bool TrySteal(size_t thiefIndex, Job& job);
+
+    static void RunJob(Job& job);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<bool> m_running{ false };
+    std::atomic<size_t> m_nextWorker{ 0 };   // Round-robin target for outside jobs
+    std::atomic<size_t> m_queuedCount{ 0 };  // Jobs in all deques
+    std::atomic<bool> m_stopping{ false };
+
+    // Idle workers sleep here until a job is queued
+    std::atomic<size_t> m_sleeping{ 0 };
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+
+    mutable std::mutex m_mainThreadMutex;
+    std::vector<Job> m_mainThreadJobs;
+};
+
+// Fork/join: jobs run on the pool, Wait() returns when all have finished
+//
+//   Util::JobGroup group;
+//   for (auto& file : files) {
+//       group.Run([&file] { Parse(file); });
+//   }
+//   group.Wait();
+class JobGroup
+{
+public:
+    explicit JobGroup(JobSystem* jobSystem = JobSystem::GetSingleton()) :
+        m_jobSystem(jobSystem)
+    {}
+
+    // Waits for jobs still running - a group must outlive its jobs
+    ~JobGroup();
+
+    JobGroup(const JobGroup&) = delete;
+    JobGroup& operator=(const JobGroup&) = delete;
+
+    void Run(JobSystem::Job job);
+
+    // Help run queued jobs until this group's are done
+    // Rethrows the first exception thrown by one of them
+    void Wait();
+
+private:
+    void WaitForJobs();
+
+    JobSystem* m_jobSystem;
+    std::atomic<size_t> m_pending{ 0 };
+    std::mutex m_mutex;
+    std::condition_variable m_done;
+    std::exception_ptr m_exception;
+};
+
+} // namespace Util
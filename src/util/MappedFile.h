@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+// =============================================================================
+// MappedFile - read-only memory map of a whole file
+// =============================================================================
+// Used to read the columnar cell files (persistence/CellBinaryFormat.h) in place:
+// the OS pages in only the columns a loader touches, and nothing is copied.
+// Empty files open successfully with an empty span.
+
+namespace Util {
+
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Map filePath read-only; false if it cannot be opened or mapped
+    bool Open(const std::filesystem::path& filePath);
+    void Close();
+
+    bool IsOpen() const { return m_open; }
+    std::span<const std::byte> GetBytes() const { return { m_data, m_size }; }
+
+private:
+    const std::byte* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_open = false;
+#ifdef _WIN32
+    void* m_file = nullptr;     // HANDLE
+    void* m_mapping = nullptr;  // HANDLE
+#endif
+};
+
+} // namespace Util
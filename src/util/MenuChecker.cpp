@@ -1,47 +1,109 @@
 #include "MenuChecker.h"
 #include "../log.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 
 // Menu checking utility adapted from activeragdoll
 // Thanks to Shizof for this method of checking what menus are open
 namespace MenuChecker
 {
-    // Menus that should stop input processing
-    static const std::unordered_set<std::string> gameStoppingMenus = {
-        "BarterMenu",
-        "Book Menu",
-        "CustomMenu",
-        "Console",
-        "Native UI Menu",
-        "ContainerMenu",
-        "Dialogue Menu",
-        "Crafting Menu",
-        "Credits Menu",
-        "Debug Text Menu",
-        "FavoritesMenu",
-        "GiftMenu",
-        "InventoryMenu",
-        "Journal Menu",
-        "Kinect Menu",
-        "Loading Menu",
-        "Lockpicking Menu",
-        "MagicMenu",
-        "Main Menu",
-        "MapMarkerText3D",
-        "MapMenu",
-        "MessageBoxMenu",
-        "Mist Menu",
-        "Quantity Menu",
-        "RaceSex Menu",
-        "Sleep/Wait Menu",
-        "StatsMenuSkillRing",
-        "StatsMenuPerks",
-        "Training Menu",
-        "Tutorial Menu",
-        "TweenMenu"
-    };
-
-    // Currently open menus
-    static std::unordered_set<std::string> openMenus;
+    namespace
+    {
+        struct KnownMenu
+        {
+            std::string_view name;
+            bool stopsGame;  // Should stop input processing
+        };
+
+        // Index in this table is the menu's ID (bit in g_openMenus)
+        constexpr auto kKnownMenus = std::to_array<KnownMenu>({
+            { "BarterMenu", true },
+            { "Book Menu", true },
+            { "CustomMenu", true },
+            { "Console", true },
+            { "Native UI Menu", true },
+            { "ContainerMenu", true },
+            { "Dialogue Menu", true },
+            { "Crafting Menu", true },
+            { "Credits Menu", true },
+            { "Debug Text Menu", true },
+            { "FavoritesMenu", true },
+            { "GiftMenu", true },
+            { "InventoryMenu", true },
+            { "Journal Menu", true },
+            { "Kinect Menu", true },
+            { "Loading Menu", true },
+            { "Lockpicking Menu", true },
+            { "MagicMenu", true },
+            { "Main Menu", true },
+            { "MapMarkerText3D", true },
+            { "MapMenu", true },
+            { "MessageBoxMenu", true },
+            { "Mist Menu", true },
+            { "Quantity Menu", true },
+            { "RaceSex Menu", true },
+            { "Sleep/Wait Menu", true },
+            { "StatsMenuSkillRing", true },
+            { "StatsMenuPerks", true },
+            { "Training Menu", true },
+            { "Tutorial Menu", true },
+            { "TweenMenu", true },
+
+            // Tracked for IsMenuOpen only
+            { "HUD Menu", false },
+            { "Cursor Menu", false },
+            { "Fader Menu", false },
+            { "LevelUp Menu", false },
+            { "StatsMenu", false },
+            { "LoadWaitSpinner", false },
+            { "Creation Club Menu", false },
+            { "Mod Manager Menu", false },
+            { "TitleSequence Menu", false },
+        });
+
+        static_assert(kKnownMenus.size() <= 64, "open-menu bitset is 64 bits");
+
+        constexpr uint64_t kGameStoppingMask = [] {
+            uint64_t mask = 0;
+            for (size_t i = 0; i < kKnownMenus.size(); ++i) {
+                if (kKnownMenus[i].stopsGame) {
+                    mask |= 1ull << i;
+                }
+            }
+            return mask;
+        }();
+
+        // Interned name pointers, index = menu ID
+        // BSFixedString is pooled, so equal names share one pointer and the sink can
+        // compare pointers instead of strings. Written once before the sink is added.
+        std::array<const char*, kKnownMenus.size()> g_internedNames{};
+
+        // Bit i set while kKnownMenus[i] is open
+        std::atomic<uint64_t> g_openMenus{ 0 };
+
+        int FindMenuId(const char* internedName)
+        {
+            for (size_t i = 0; i < g_internedNames.size(); ++i) {
+                if (g_internedNames[i] == internedName) {
+                    return static_cast<int>(i);
+                }
+            }
+            return -1;
+        }
+
+        void InternMenuNames()
+        {
+            // Pool entries are reference counted - keep one reference per name for the
+            // lifetime of the process so the pointers stay valid (intentionally leaked)
+            static auto* names = new std::array<RE::BSFixedString, kKnownMenus.size()>();
+            for (size_t i = 0; i < kKnownMenus.size(); ++i) {
+                (*names)[i] = RE::BSFixedString(kKnownMenus[i].name);
+                g_internedNames[i] = (*names)[i].c_str();
+            }
+        }
+    }
 
     MenuEventHandler* MenuEventHandler::GetSingleton()
     {
@@ -57,12 +119,16 @@ namespace MenuChecker
             return RE::BSEventNotifyControl::kContinue;
         }
 
-        std::string menuName = a_event->menuName.c_str();
+        const int id = FindMenuId(a_event->menuName.c_str());
+        if (id < 0) {
+            return RE::BSEventNotifyControl::kContinue;
+        }
 
+        const uint64_t bit = 1ull << id;
         if (a_event->opening) {
-            openMenus.insert(menuName);
+            g_openMenus.fetch_or(bit, std::memory_order_relaxed);
         } else {
-            openMenus.erase(menuName);
+            g_openMenus.fetch_and(~bit, std::memory_order_relaxed);
         }
 
         return RE::BSEventNotifyControl::kContinue;
@@ -71,8 +137,9 @@ namespace MenuChecker
     void RegisterEventSink()
     {
         if (auto* ui = RE::UI::GetSingleton()) {
+            InternMenuNames();
             ui->AddEventSink(MenuEventHandler::GetSingleton());
-            spdlog::info("MenuChecker: Registered menu event sink");
+            spdlog::info("MenuChecker: Registered menu event sink ({} known menus)", kKnownMenus.size());
         } else {
             spdlog::error("MenuChecker: Failed to get UI singleton");
         }
@@ -80,17 +147,23 @@ namespace MenuChecker
 
     bool IsGameStopped()
     {
-        for (const auto& menu : openMenus) {
-            if (gameStoppingMenus.contains(menu)) {
-                
-                return true;
-            }
-        }
-        return false;
+        return (g_openMenus.load(std::memory_order_relaxed) & kGameStoppingMask) != 0;
+    }
+
+    int GetOpenGameStoppingMenuCount()
+    {
+        return std::popcount(g_openMenus.load(std::memory_order_relaxed) & kGameStoppingMask);
     }
 
-    bool IsMenuOpen(const std::string& menuName)
+    bool IsMenuOpen(std::string_view menuName)
     {
-        return openMenus.contains(menuName);
+        auto it = std::find_if(kKnownMenus.begin(), kKnownMenus.end(),
+            [menuName](const KnownMenu& menu) { return menu.name == menuName; });
+        if (it == kKnownMenus.end()) {
+            return false;
+        }
+
+        const auto id = static_cast<size_t>(it - kKnownMenus.begin());
+        return (g_openMenus.load(std::memory_order_relaxed) & (1ull << id)) != 0;
     }
 }
@@ -1,10 +1,16 @@
 #pragma once
 
-#include <unordered_set>
-#include <string>
+#include <cstdint>
+#include <string_view>
 
 // Menu checking utility adapted from activeragdoll
 // Thanks to Shizof for this method of checking what menus are open
+//
+// Known menu names are interned once (RegisterEventSink) into small IDs. The open
+// state lives in one atomic bitset, so IsGameStopped() - called from the OpenVR
+// input hook on every controller state change - is a single relaxed load and a
+// mask, and the UI-thread event sink never allocates or locks.
+// Menus not in the known list (mod menus) are ignored.
 namespace MenuChecker
 {
     // Event sink for menu open/close events
@@ -30,6 +36,9 @@ namespace MenuChecker
     // Returns true if any game-stopping menu is open
     bool IsGameStopped();
 
-    // Returns true if a specific menu is open
-    bool IsMenuOpen(const std::string& menuName);
+    // Number of game-stopping menus currently open
+    int GetOpenGameStoppingMenuCount();
+
+    // Returns true if a specific known menu is open (always false for unknown names)
+    bool IsMenuOpen(std::string_view menuName);
 }
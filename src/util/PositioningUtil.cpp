@@ -1,4 +1,6 @@
 #include "PositioningUtil.h"
+#include "RotationMath.h"
+#include "SimdMath.h"
 #include "../log.h"
 #include <cmath>
 
@@ -44,92 +46,17 @@ RE::NiPoint3 MatrixToEulerAngles(const RE::NiMatrix3& m)
 
 RE::NiPoint3 SurfaceNormalToEuler(const RE::NiPoint3& normal, float preservedYaw)
 {
-    // Derive pitch and roll directly from surface normal, preserving yaw.
-    //
-    // Mathematical derivation:
-    // For Skyrim's ZYX Euler order, the rotation matrix R = Rx(pitch) * Ry(roll) * Rz(yaw).
-    // The Z-column of R (column 2) is the direction the object's local Z-axis points.
-    // We want this to equal the surface normal.
-    //
-    // For R = Rx(p) * Ry(r) (ignoring yaw which only affects XY orientation):
-    // Z-column = [sin(r), -sin(p)*cos(r), cos(p)*cos(r)]
-    //
-    // Given normal = (nx, ny, nz), we solve:
-    //   sin(r) = nx
-    //   -sin(p)*cos(r) = ny
-    //   cos(p)*cos(r) = nz
-    //
-    // From the normal being unit length: nx² + ny² + nz² = 1
-    // So cos²(r) = 1 - sin²(r) = 1 - nx² = ny² + nz²
-    //
-    // Therefore:
-    //   roll  = atan2(nx, sqrt(ny² + nz²))
-    //   pitch = atan2(-ny, nz)  [when cos(r) ≠ 0]
-    //
-    // This decomposition is stable except when the normal is nearly horizontal
-    // (pointing in ±X direction), which is a gimbal lock case we handle specially.
-
-    RE::NiPoint3 angles;
-
-    float nx = normal.x;
-    float ny = normal.y;
-    float nz = normal.z;
-
-    // cos²(roll) = ny² + nz²
-    float cosRollSq = ny * ny + nz * nz;
-    float cosRoll = std::sqrt(cosRollSq);
-
-    if (cosRoll > 1e-6f) {
-        // Normal case: surface is not a vertical wall facing ±X
-        angles.y = std::atan2(nx, cosRoll);     // Roll (Y rotation)
-        angles.x = std::atan2(-ny, nz);         // Pitch (X rotation)
-    } else {
-        // Gimbal lock: surface normal is nearly horizontal (pointing ±X)
-        // In this case, pitch and yaw become coupled. We preserve yaw and set pitch=0.
-        angles.y = (nx > 0) ? (3.14159265f / 2.0f) : (-3.14159265f / 2.0f);  // ±90° roll
-        angles.x = 0.0f;
-    }
-
-    // Yaw is preserved from the original Euler angles + any delta
-    // This is the LOSSLESS part - we never convert yaw through a matrix
-    angles.z = preservedYaw;
-
-    return angles;
+    return Util::RotationMath::SurfaceNormalToEuler(normal, preservedYaw);
 }
 
 RE::NiMatrix3 RotationAroundZ(float angle)
 {
-    RE::NiMatrix3 result;
-    float c = std::cos(angle);
-    float s = std::sin(angle);
-
-    result.entry[0][0] = c;
-    result.entry[0][1] = -s;
-    result.entry[0][2] = 0.0f;
-
-    result.entry[1][0] = s;
-    result.entry[1][1] = c;
-    result.entry[1][2] = 0.0f;
-
-    result.entry[2][0] = 0.0f;
-    result.entry[2][1] = 0.0f;
-    result.entry[2][2] = 1.0f;
-
-    return result;
+    return Util::SimdMath::RotationAroundZ(angle);
 }
 
 RE::NiMatrix3 MultiplyMatrices(const RE::NiMatrix3& a, const RE::NiMatrix3& b)
 {
-    RE::NiMatrix3 result;
-    for (int i = 0; i < 3; ++i) {
-        for (int j = 0; j < 3; ++j) {
-            result.entry[i][j] =
-                a.entry[i][0] * b.entry[0][j] +
-                a.entry[i][1] * b.entry[1][j] +
-                a.entry[i][2] * b.entry[2][j];
-        }
-    }
-    return result;
+    return Util::SimdMath::Multiply(a, b);
 }
 
 bool IsStaticCollisionLayer(RE::COL_LAYER layer)
@@ -0,0 +1,64 @@
+#include "Profiler.h"
+#include "../log.h"
+
+#include <ctime>
+#include <fstream>
+
+namespace Util::Profiler {
+
+#if defined(VREDIT_PROFILER)
+
+std::string Dump()
+{
+    Stop();
+
+    auto logsFolder = SKSE::log::log_directory();
+    if (!logsFolder) {
+        spdlog::error("Profiler: SKSE log directory not available");
+        return {};
+    }
+
+    const std::time_t now = std::time(nullptr);
+    std::tm local{};
+    localtime_s(&local, &now);
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &local);
+    const auto path = *logsFolder / std::format("VREditor_trace_{}.json", stamp);
+
+    std::string json;
+    json.reserve(1 << 20);
+    const size_t eventCount = WriteChromeTrace(json);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        spdlog::error("Profiler: Could not open {}", path.string());
+        return {};
+    }
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!file) {
+        spdlog::error("Profiler: Failed writing {}", path.string());
+        return {};
+    }
+
+    spdlog::info("Profiler: Wrote {} events ({} KB) to {}", eventCount, json.size() / 1024, path.string());
+    return path.string();
+}
+
+#else
+
+void Start()
+{
+    spdlog::warn("Profiler: Not compiled in - rebuild with VREDIT_ENABLE_PROFILER=ON");
+}
+
+void Stop() {}
+
+std::string Dump()
+{
+    spdlog::warn("Profiler: Not compiled in - rebuild with VREDIT_ENABLE_PROFILER=ON");
+    return {};
+}
+
+#endif
+
+} // namespace Util::Profiler
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <string>
+
+// =============================================================================
+// Profiler - scoped zones dumped as Chrome trace_event JSON
+// =============================================================================
+// PROFILE_ZONE("name") records a begin event now and an end event when the scope
+// exits. Events go into a ring buffer owned by the recording thread (no locks on
+// the hot path) and are only written while a capture is running. The buffers can
+// be read while their threads keep writing (Dump runs on the Papyrus VM thread,
+// and zones still open at Stop() write their end events afterwards): slots are
+// relaxed atomics, and the reader drops any slot a writer may have reused while
+// it was being copied - see ThreadBuffer. Dump() writes
+// everything captured to <SKSE logs>/VREditor_trace_<time>.json - open it in
+// chrome://tracing or https://ui.perfetto.dev.
+//
+// Compiled in only when VREDIT_PROFILER is defined (CMake option
+// VREDIT_ENABLE_PROFILER). Otherwise the macros expand to nothing and
+// Start/Stop/Dump just log that the profiler is not available.
+//
+// Zone names must outlive the capture: string literals, __FUNCTION__ or RTTI names.
+//
+// Usage:
+//   void Foo() {
+//       PROFILE_FUNCTION();
+//       { PROFILE_ZONE("Foo::inner"); ... }
+//   }
+
+#define VREDIT_PROFILE_CONCAT_INNER(a, b) a##b
+#define VREDIT_PROFILE_CONCAT(a, b) VREDIT_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(VREDIT_PROFILER)
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#define PROFILE_ZONE(name) ::Util::Profiler::Zone VREDIT_PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_ZONE(__FUNCTION__)
+
+// Name computed only while a capture is running (e.g. typeid(...).name())
+#define PROFILE_ZONE_DYNAMIC(nameExpr) \
+    ::Util::Profiler::Zone VREDIT_PROFILE_CONCAT(profileZone_, __LINE__)(::Util::Profiler::IsRecording() ? (nameExpr) : nullptr)
+
+namespace Util::Profiler {
+
+    // Per thread - 24 bytes each, allocated on the thread's first recorded zone
+    inline constexpr size_t kEventsPerThread = 1 << 16;
+
+    // Relaxed atomics, so a dump can copy slots a thread is writing
+    struct Event {
+        std::atomic<const char*> name{ nullptr };
+        std::atomic<int64_t> timestampNs{ 0 };
+        std::atomic<char> phase{ 0 };  // 'B' or 'E'
+    };
+
+    // Writing event n: claimed = n + 1, release fence, fill the slot, head = n + 1
+    // (release). A reader copies slots below head (acquire), then an acquire fence
+    // and claimed tell it which of those a writer has started to reuse meanwhile.
+    struct ThreadBuffer {
+        uint32_t threadId = 0;
+        std::unique_ptr<Event[]> events = std::make_unique<Event[]>(kEventsPerThread);
+
+        // Total events ever written; slot = head % kEventsPerThread
+        std::atomic<uint64_t> head{ 0 };
+
+        // Total events whose slot has been (or is being) written - head, or head + 1
+        std::atomic<uint64_t> claimed{ 0 };
+
+        // Value of head when the current capture started
+        std::atomic<uint64_t> captureBegin{ 0 };
+    };
+
+    namespace detail {
+        inline std::atomic<bool> g_recording{ false };
+        inline std::atomic<int64_t> g_captureStartNs{ 0 };
+
+        // Buffers outlive their threads (a dump may run after a worker exits)
+        inline std::mutex g_registryMutex;
+        inline std::vector<std::unique_ptr<ThreadBuffer>> g_buffers;
+
+        inline int64_t NowNs()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        inline ThreadBuffer* RegisterThread()
+        {
+            std::lock_guard lock(g_registryMutex);
+            auto buffer = std::make_unique<ThreadBuffer>();
+            buffer->threadId = static_cast<uint32_t>(g_buffers.size() + 1);
+            g_buffers.push_back(std::move(buffer));
+            return g_buffers.back().get();
+        }
+
+        inline ThreadBuffer& LocalBuffer()
+        {
+            thread_local ThreadBuffer* buffer = RegisterThread();
+            return *buffer;
+        }
+
+        inline void Record(const char* name, char phase)
+        {
+            auto& buffer = LocalBuffer();
+            const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+            buffer.claimed.store(head + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            auto& slot = buffer.events[head % kEventsPerThread];
+            slot.name.store(name, std::memory_order_relaxed);
+            slot.timestampNs.store(NowNs(), std::memory_order_relaxed);
+            slot.phase.store(phase, std::memory_order_relaxed);
+            buffer.head.store(head + 1, std::memory_order_release);
+        }
+
+        inline void AppendEscaped(std::string& out, const char* text)
+        {
+            for (const char* c = text; *c; ++c) {
+                if (*c == '"' || *c == '\\') {
+                    out += '\\';
+                }
+                out += *c;
+            }
+        }
+    }
+
+    inline bool IsRecording()
+    {
+        return detail::g_recording.load(std::memory_order_relaxed);
+    }
+
+    class Zone
+    {
+    public:
+        explicit Zone(const char* name) :
+            m_name(name && IsRecording() ? name : nullptr)
+        {
+            if (m_name) {
+                detail::Record(m_name, 'B');
+            }
+        }
+
+        // An end event is written even if the capture stopped meanwhile, so zones
+        // that began inside the capture are always closed
+        ~Zone()
+        {
+            if (m_name) {
+                detail::Record(m_name, 'E');
+            }
+        }
+
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+
+    private:
+        const char* m_name;
+    };
+
+    // Begin a capture, discarding previously captured events
+    // Safe from any thread - buffers are never reset, the capture just starts at
+    // each thread's current write position
+    inline void Start()
+    {
+        std::lock_guard lock(detail::g_registryMutex);
+        for (auto& buffer : detail::g_buffers) {
+            buffer->captureBegin.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+        }
+        detail::g_captureStartNs.store(detail::NowNs(), std::memory_order_relaxed);
+        detail::g_recording.store(true, std::memory_order_release);
+    }
+
+    inline void Stop()
+    {
+        detail::g_recording.store(false, std::memory_order_release);
+    }
+
+    // Append the captured events as Chrome trace_event JSON
+    // Only the newest kEventsPerThread events per thread survive; end events whose
+    // begin was overwritten are dropped so the viewer sees balanced zones.
+    // Safe while other threads record: events written after the call started
+    // are left out.
+    inline size_t WriteChromeTrace(std::string& out)
+    {
+        struct EventCopy {
+            const char* name;
+            int64_t timestampNs;
+            char phase;
+        };
+
+        std::lock_guard lock(detail::g_registryMutex);
+
+        const int64_t startNs = detail::g_captureStartNs.load(std::memory_order_relaxed);
+        size_t written = 0;
+        std::vector<EventCopy> events;
+
+        out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        for (const auto& buffer : detail::g_buffers) {
+            const uint64_t head = buffer->head.load(std::memory_order_acquire);
+            const uint64_t oldest = head > kEventsPerThread ? head - kEventsPerThread : 0;
+            const uint64_t first = std::max(oldest, buffer->captureBegin.load(std::memory_order_relaxed));
+
+            events.clear();
+            for (uint64_t i = first; i < head; ++i) {
+                const Event& slot = buffer->events[i % kEventsPerThread];
+                events.push_back({ slot.name.load(std::memory_order_relaxed),
+                                   slot.timestampNs.load(std::memory_order_relaxed),
+                                   slot.phase.load(std::memory_order_relaxed) });
+            }
+
+            // Slots of events below claimed - kEventsPerThread may have been reused mid-copy
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t claimed = buffer->claimed.load(std::memory_order_relaxed);
+            const uint64_t skip = claimed > kEventsPerThread + first
+                ? std::min<uint64_t>(claimed - kEventsPerThread - first, events.size())
+                : 0;
+
+            int depth = 0;
+            for (size_t e = static_cast<size_t>(skip); e < events.size(); ++e) {
+                const EventCopy& event = events[e];
+                if (event.phase == 'E') {
+                    if (depth == 0) continue;
+                    depth--;
+                } else {
+                    depth++;
+                }
+
+                if (written > 0) {
+                    out += ',';
+                }
+                out += "{\"name\":\"";
+                detail::AppendEscaped(out, event.name);
+                out += "\",\"ph\":\"";
+                out += event.phase;
+                out += "\",\"pid\":1,\"tid\":";
+
+                char number[32];
+                auto [tidEnd, tidEc] = std::to_chars(number, number + sizeof(number), buffer->threadId);
+                out.append(number, tidEnd);
+
+                // Microseconds since capture start, nanosecond precision
+                out += ",\"ts\":";
+                const double micros = static_cast<double>(event.timestampNs - startNs) / 1000.0;
+                auto [tsEnd, tsEc] = std::to_chars(number, number + sizeof(number), micros,
+                                                   std::chars_format::fixed, 3);
+                out.append(number, tsEnd);
+                out += '}';
+                written++;
+            }
+        }
+        out += "]}";
+        return written;
+    }
+
+    // Stop the capture and write it to the SKSE log folder (game build only)
+    // Returns the file path, or an empty string on failure
+    std::string Dump();
+
+    inline constexpr bool kCompiledIn = true;
+
+} // namespace Util::Profiler
+
+#else
+
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#define PROFILE_ZONE_DYNAMIC(nameExpr) ((void)0)
+
+namespace Util::Profiler {
+    inline constexpr bool kCompiledIn = false;
+
+    inline bool IsRecording() { return false; }
+    void Start();
+    void Stop();
+    std::string Dump();
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include "Raycast.h"
+#include "Profiler.h"
 #include <cmath>
 
 namespace Raycast {
@@ -41,6 +42,7 @@ RaycastResult CastRay(const RE::NiPoint3& origin, const RE::NiPoint3& direction,
 }
 
 RaycastResult CastRay(const RE::NiPoint3& origin, const RE::NiPoint3& direction, float maxDistance, RE::COL_LAYER sourceLayer) {
+    PROFILE_FUNCTION();
     RaycastResult result = MakeEmptyResult(origin, direction, maxDistance);
 
     auto* player = RE::PlayerCharacter::GetSingleton();
@@ -78,6 +80,7 @@ RaycastResult CastRay(const RE::NiPoint3& origin, const RE::NiPoint3& direction,
 }
 
 RaycastResult CastRayFiltered(const RE::NiPoint3& origin, const RE::NiPoint3& direction, float maxDistance, CollisionLayerMask layerMask) {
+    PROFILE_FUNCTION();
     RaycastResult result = MakeEmptyResult(origin, direction, maxDistance);
 
     auto* player = RE::PlayerCharacter::GetSingleton();
@@ -167,6 +170,7 @@ float GetAllowedDistance(const RE::NiPoint3& origin, const RE::NiPoint3& directi
 }
 
 float GetAllowedDistance(const RE::NiPoint3& origin, const RE::NiPoint3& direction, float maxDistance, float buffer, LayerFilter layerFilter) {
+    PROFILE_FUNCTION();
     RaycastResult rayResult = CastRay(origin, direction, maxDistance + buffer);
 
     // Only consider hits on layers that pass the filter
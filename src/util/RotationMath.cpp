@@ -1,4 +1,5 @@
 #include "RotationMath.h"
+#include "SimdMath.h"
 #include <cmath>
 
 namespace Util::RotationMath {
@@ -10,28 +11,7 @@ float ExtractZRotation(const RE::NiMatrix3& m)
 
 RE::NiMatrix3 EulerToMatrix(const RE::NiPoint3& angles)
 {
-    float cx = std::cos(angles.x);
-    float sx = std::sin(angles.x);
-    float cy = std::cos(angles.y);
-    float sy = std::sin(angles.y);
-    float cz = std::cos(angles.z);
-    float sz = std::sin(angles.z);
-
-    RE::NiMatrix3 result;
-    // ZYX rotation order: first Z (yaw), then Y (roll), then X (pitch)
-    result.entry[0][0] = cy * cz;
-    result.entry[0][1] = -cy * sz;
-    result.entry[0][2] = sy;
-
-    result.entry[1][0] = sx * sy * cz + cx * sz;
-    result.entry[1][1] = -sx * sy * sz + cx * cz;
-    result.entry[1][2] = -sx * cy;
-
-    result.entry[2][0] = -cx * sy * cz + sx * sz;
-    result.entry[2][1] = cx * sy * sz + sx * cz;
-    result.entry[2][2] = cx * cy;
-
-    return result;
+    return SimdMath::EulerToMatrix(angles);
 }
 
 RE::NiPoint3 RotatePointAroundZ(const RE::NiPoint3& point, const RE::NiPoint3& origin, float angle)
@@ -55,6 +35,61 @@ RE::NiPoint3 RotatePointAroundZ(const RE::NiPoint3& point, const RE::NiPoint3& o
     };
 }
 
+RE::NiPoint3 SurfaceNormalToEuler(const RE::NiPoint3& normal, float preservedYaw)
+{
+    // Derive pitch and roll directly from surface normal, preserving yaw.
+    //
+    // Mathematical derivation:
+    // For Skyrim's ZYX Euler order, the rotation matrix R = Rx(pitch) * Ry(roll) * Rz(yaw).
+    // The Z-column of R (column 2) is the direction the object's local Z-axis points.
+    // We want this to equal the surface normal.
+    //
+    // For R = Rx(p) * Ry(r) (ignoring yaw which only affects XY orientation):
+    // Z-column = [sin(r), -sin(p)*cos(r), cos(p)*cos(r)]
+    //
+    // Given normal = (nx, ny, nz), we solve:
+    //   sin(r) = nx
+    //   -sin(p)*cos(r) = ny
+    //   cos(p)*cos(r) = nz
+    //
+    // From the normal being unit length: nx² + ny² + nz² = 1
+    // So cos²(r) = 1 - sin²(r) = 1 - nx² = ny² + nz²
+    //
+    // Therefore:
+    //   roll  = atan2(nx, sqrt(ny² + nz²))
+    //   pitch = atan2(-ny, nz)  [when cos(r) ≠ 0]
+    //
+    // This decomposition is stable except when the normal is nearly horizontal
+    // (pointing in ±X direction), which is a gimbal lock case we handle specially.
+
+    RE::NiPoint3 angles;
+
+    float nx = normal.x;
+    float ny = normal.y;
+    float nz = normal.z;
+
+    // cos²(roll) = ny² + nz²
+    float cosRollSq = ny * ny + nz * nz;
+    float cosRoll = std::sqrt(cosRollSq);
+
+    if (cosRoll > 1e-6f) {
+        // Normal case: surface is not a vertical wall facing ±X
+        angles.y = std::atan2(nx, cosRoll);     // Roll (Y rotation)
+        angles.x = std::atan2(-ny, nz);         // Pitch (X rotation)
+    } else {
+        // Gimbal lock: surface normal is nearly horizontal (pointing ±X)
+        // In this case, pitch and yaw become coupled. We preserve yaw and set pitch=0.
+        angles.y = (nx > 0) ? (3.14159265f / 2.0f) : (-3.14159265f / 2.0f);  // ±90° roll
+        angles.x = 0.0f;
+    }
+
+    // Yaw is preserved from the original Euler angles + any delta
+    // This is the LOSSLESS part - we never convert yaw through a matrix
+    angles.z = preservedYaw;
+
+    return angles;
+}
+
 float Normalize(RE::NiPoint3& v)
 {
     float len = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
@@ -1,6 +1,10 @@
 #pragma once
 
+#if !defined(TEST_ENVIRONMENT)
 #include <RE/Skyrim.h>
+#else
+#include "TestStubs.h"
+#endif
 
 namespace Util::RotationMath {
 
@@ -15,6 +19,11 @@ RE::NiMatrix3 EulerToMatrix(const RE::NiPoint3& angles);
 // Rotate a point around the Z axis at a given origin
 RE::NiPoint3 RotatePointAroundZ(const RE::NiPoint3& point, const RE::NiPoint3& origin, float angle);
 
+// Euler angles (pitch, roll, yaw) that align an object's Z-axis with a surface
+// normal (normalized) while keeping the given yaw exactly - no Matrix->Euler
+// round-trip. Used by ground snapping.
+RE::NiPoint3 SurfaceNormalToEuler(const RE::NiPoint3& normal, float preservedYaw);
+
 // Normalize a vector in-place, returns original length
 float Normalize(RE::NiPoint3& v);
 
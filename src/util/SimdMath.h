@@ -0,0 +1,386 @@
+#pragma once
+
+#if !defined(TEST_ENVIRONMENT)
+#include <RE/Skyrim.h>
+#else
+#include "TestStubs.h"
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <emmintrin.h>
+
+namespace Util::SimdMath {
+
+// =============================================================================
+// SimdMath - SSE-backed 3x3 rotation, vector and quaternion math
+// =============================================================================
+// Register types used by everything that multiplies rotations or moves points
+// through them (grab, rotation gestures, Euler conversion). Values go in and out
+// as RE::NiMatrix3 / RE::NiPoint3 so callers keep the engine types.
+//
+// Every product and sum is evaluated in the same order as the scalar code it
+// replaced, so Multiply / Transpose / Transform / Slerp give bit-identical
+// results. The one exception is SinCos: a polynomial approximation that stays
+// within a couple of ulp of std::sin / std::cos for the angles the editor uses
+// (|angle| < 8192 rad), in exchange for doing four angles in one pass. The
+// rotation builders (EulerToMatrix, RotationAroundZ) do not use it: their
+// matrices are compared with and written back as the game's own angles, so
+// they keep std::sin / std::cos and match the scalar code exactly.
+
+// Lanes x, y, z, 0
+struct Vec3 {
+    __m128 v;
+
+    static Vec3 Load(const RE::NiPoint3& p) { return { _mm_set_ps(0.0f, p.z, p.y, p.x) }; }
+
+    RE::NiPoint3 Store() const
+    {
+        RE::NiPoint3 p;
+        Store(p);
+        return p;
+    }
+
+    void Store(RE::NiPoint3& p) const
+    {
+        _mm_storel_pi(reinterpret_cast<__m64*>(&p.x), v);
+        _mm_store_ss(&p.z, _mm_movehl_ps(v, v));
+    }
+};
+
+// Three rows, each laid out like a Vec3
+struct Mat3 {
+    __m128 row[3];
+
+    static Mat3 Load(const RE::NiMatrix3& m)
+    {
+        // NiMatrix3 is nine packed floats: the first two rows can be read four
+        // wide, the last one is read from one float earlier so the load stays
+        // inside the matrix. The spare lane is cleared either way.
+        const __m128 xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+        const __m128 tail = _mm_loadu_ps(&m.entry[1][2]);
+        return { { _mm_and_ps(_mm_loadu_ps(&m.entry[0][0]), xyz),
+                   _mm_and_ps(_mm_loadu_ps(&m.entry[1][0]), xyz),
+                   _mm_and_ps(_mm_shuffle_ps(tail, tail, _MM_SHUFFLE(0, 3, 2, 1)), xyz) } };
+    }
+
+    RE::NiMatrix3 Store() const
+    {
+        // Rows 0 and 1 spill one lane into the next row, which the next store overwrites
+        RE::NiMatrix3 m;
+        _mm_storeu_ps(&m.entry[0][0], row[0]);
+        _mm_storeu_ps(&m.entry[1][0], row[1]);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&m.entry[2][0]), row[2]);
+        _mm_store_ss(&m.entry[2][2], _mm_movehl_ps(row[2], row[2]));
+        return m;
+    }
+};
+
+namespace detail {
+    template <int Lane>
+    inline __m128 Splat(__m128 v)
+    {
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+    }
+
+    // Row-vector-times-matrix: lanes of r pick rows of m
+    inline __m128 CombineRows(__m128 r, const Mat3& m)
+    {
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(Splat<0>(r), m.row[0]), _mm_mul_ps(Splat<1>(r), m.row[1])),
+                          _mm_mul_ps(Splat<2>(r), m.row[2]));
+    }
+
+    // Columns of m times the broadcast components of v - m * v with m transposed
+    inline __m128 CombineColumns(const Mat3& columns, __m128 v)
+    {
+        return CombineRows(v, columns);
+    }
+
+    // Lane sum in x, y, z, w order, matching a scalar left-to-right sum
+    inline float SumLanes(__m128 v)
+    {
+        __m128 sum = _mm_add_ss(v, Splat<1>(v));
+        sum = _mm_add_ss(sum, Splat<2>(v));
+        sum = _mm_add_ss(sum, Splat<3>(v));
+        return _mm_cvtss_f32(sum);
+    }
+}
+
+// =============================================================================
+// Matrices and vectors
+// =============================================================================
+
+inline Mat3 Multiply(const Mat3& a, const Mat3& b)
+{
+    return { { detail::CombineRows(a.row[0], b), detail::CombineRows(a.row[1], b),
+               detail::CombineRows(a.row[2], b) } };
+}
+
+inline RE::NiMatrix3 Multiply(const RE::NiMatrix3& a, const RE::NiMatrix3& b)
+{
+    return Multiply(Mat3::Load(a), Mat3::Load(b)).Store();
+}
+
+inline Mat3 Transpose(const Mat3& m)
+{
+    __m128 r0 = m.row[0], r1 = m.row[1], r2 = m.row[2], r3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    return { { r0, r1, r2 } };
+}
+
+// Transpose - the inverse of a pure rotation
+inline RE::NiMatrix3 InvertRotation(const RE::NiMatrix3& m)
+{
+    return Transpose(Mat3::Load(m)).Store();
+}
+
+inline Vec3 Transform(const Mat3& m, const Vec3& v)
+{
+    return { detail::CombineColumns(Transpose(m), v.v) };
+}
+
+inline RE::NiPoint3 Transform(const RE::NiMatrix3& m, const RE::NiPoint3& v)
+{
+    return Transform(Mat3::Load(m), Vec3::Load(v)).Store();
+}
+
+// center + m * (point - center)
+inline RE::NiPoint3 RotateAround(const RE::NiMatrix3& m, const RE::NiPoint3& center, const RE::NiPoint3& point)
+{
+    const Vec3 c = Vec3::Load(center);
+    const Vec3 offset{ _mm_sub_ps(Vec3::Load(point).v, c.v) };
+    return Vec3{ _mm_add_ps(c.v, Transform(Mat3::Load(m), offset).v) }.Store();
+}
+
+// out[i] = m * in[i]. The matrix is transposed once for the whole batch;
+// in and out may be the same span.
+inline void TransformPoints(const RE::NiMatrix3& m, std::span<const RE::NiPoint3> in, std::span<RE::NiPoint3> out)
+{
+    const Mat3 columns = Transpose(Mat3::Load(m));
+    const size_t count = in.size() < out.size() ? in.size() : out.size();
+    for (size_t i = 0; i < count; ++i) {
+        Vec3{ detail::CombineColumns(columns, Vec3::Load(in[i]).v) }.Store(out[i]);
+    }
+}
+
+// out[i] = center + m * (in[i] - center), the batch form of RotateAround
+inline void RotatePointsAround(const RE::NiMatrix3& m, const RE::NiPoint3& center,
+                               std::span<const RE::NiPoint3> in, std::span<RE::NiPoint3> out)
+{
+    const Mat3 columns = Transpose(Mat3::Load(m));
+    const __m128 c = Vec3::Load(center).v;
+    const size_t count = in.size() < out.size() ? in.size() : out.size();
+    for (size_t i = 0; i < count; ++i) {
+        const __m128 offset = _mm_sub_ps(Vec3::Load(in[i]).v, c);
+        Vec3{ _mm_add_ps(c, detail::CombineColumns(columns, offset)) }.Store(out[i]);
+    }
+}
+
+// =============================================================================
+// Trigonometry
+// =============================================================================
+
+// Sine and cosine of four angles at once (Cephes single-precision polynomials
+// with a three-part pi/4 range reduction)
+inline void SinCos(__m128 angles, __m128& outSin, __m128& outCos)
+{
+    const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+
+    __m128 x = _mm_andnot_ps(signMask, angles);
+    __m128 sinSign = _mm_and_ps(angles, signMask);
+
+    // Octant, rounded up to even: j = (int(|x| * 4/pi) + 1) & ~1
+    __m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+    j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+    const __m128 y = _mm_cvtepi32_ps(j);
+
+    const __m128 swapSinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29));
+    const __m128 cosSign = _mm_castsi128_ps(
+        _mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+    const __m128 useSinPoly = _mm_castsi128_ps(
+        _mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+    sinSign = _mm_xor_ps(sinSign, swapSinSign);
+
+    // x - y * pi/4, in three parts so the reduction stays exact
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(3.77489497744594108e-8f)));
+    const __m128 z = _mm_mul_ps(x, x);
+
+    // cos(x) on [-pi/4, pi/4]
+    __m128 cosPoly = _mm_set1_ps(2.443315711809948e-5f);
+    cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(-1.388731625493765e-3f));
+    cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(4.166664568298827e-2f));
+    cosPoly = _mm_mul_ps(_mm_mul_ps(cosPoly, z), z);
+    cosPoly = _mm_sub_ps(cosPoly, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    cosPoly = _mm_add_ps(cosPoly, _mm_set1_ps(1.0f));
+
+    // sin(x) on [-pi/4, pi/4]
+    __m128 sinPoly = _mm_set1_ps(-1.9515295891e-4f);
+    sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(8.3321608736e-3f));
+    sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(-1.6666654611e-1f));
+    sinPoly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPoly, z), x), x);
+
+    // Odd octant pairs swap the roles of the two polynomials
+    const __m128 s = _mm_or_ps(_mm_and_ps(useSinPoly, sinPoly), _mm_andnot_ps(useSinPoly, cosPoly));
+    const __m128 c = _mm_or_ps(_mm_and_ps(useSinPoly, cosPoly), _mm_andnot_ps(useSinPoly, sinPoly));
+    outSin = _mm_xor_ps(s, sinSign);
+    outCos = _mm_xor_ps(c, cosSign);
+}
+
+inline void SinCos(float angle, float& outSin, float& outCos)
+{
+    __m128 s, c;
+    SinCos(_mm_set_ss(angle), s, c);
+    outSin = _mm_cvtss_f32(s);
+    outCos = _mm_cvtss_f32(c);
+}
+
+// Skyrim's ZYX order: angles.x = pitch, angles.y = roll, angles.z = yaw
+inline RE::NiMatrix3 EulerToMatrix(const RE::NiPoint3& angles)
+{
+    const float cx = std::cos(angles.x);
+    const float sx = std::sin(angles.x);
+    const float cy = std::cos(angles.y);
+    const float sy = std::sin(angles.y);
+    const float cz = std::cos(angles.z);
+    const float sz = std::sin(angles.z);
+
+    RE::NiMatrix3 result;
+    result.entry[0][0] = cy * cz;
+    result.entry[0][1] = -cy * sz;
+    result.entry[0][2] = sy;
+
+    result.entry[1][0] = sx * sy * cz + cx * sz;
+    result.entry[1][1] = -sx * sy * sz + cx * cz;
+    result.entry[1][2] = -sx * cy;
+
+    result.entry[2][0] = -cx * sy * cz + sx * sz;
+    result.entry[2][1] = cx * sy * sz + sx * cz;
+    result.entry[2][2] = cx * cy;
+
+    return result;
+}
+
+inline RE::NiMatrix3 RotationAroundZ(float angle)
+{
+    const float c = std::cos(angle);
+    const float s = std::sin(angle);
+
+    RE::NiMatrix3 result;
+    result.entry[0][0] = c;
+    result.entry[0][1] = -s;
+    result.entry[0][2] = 0.0f;
+
+    result.entry[1][0] = s;
+    result.entry[1][1] = c;
+    result.entry[1][2] = 0.0f;
+
+    result.entry[2][0] = 0.0f;
+    result.entry[2][1] = 0.0f;
+    result.entry[2][2] = 1.0f;
+
+    return result;
+}
+
+// =============================================================================
+// Quaternions
+// =============================================================================
+
+// Lanes w, x, y, z
+struct Quat {
+    __m128 v;
+
+    static Quat Identity() { return { _mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f) }; }
+    static Quat FromWXYZ(float w, float x, float y, float z) { return { _mm_set_ps(z, y, x, w) }; }
+
+    static Quat FromMatrix(const RE::NiMatrix3& m)
+    {
+        const float trace = m.entry[0][0] + m.entry[1][1] + m.entry[2][2];
+
+        if (trace > 0.0f) {
+            const float s = std::sqrt(trace + 1.0f) * 2.0f;
+            return FromWXYZ(0.25f * s, (m.entry[2][1] - m.entry[1][2]) / s, (m.entry[0][2] - m.entry[2][0]) / s,
+                            (m.entry[1][0] - m.entry[0][1]) / s);
+        }
+        if (m.entry[0][0] > m.entry[1][1] && m.entry[0][0] > m.entry[2][2]) {
+            const float s = std::sqrt(1.0f + m.entry[0][0] - m.entry[1][1] - m.entry[2][2]) * 2.0f;
+            return FromWXYZ((m.entry[2][1] - m.entry[1][2]) / s, 0.25f * s, (m.entry[0][1] + m.entry[1][0]) / s,
+                            (m.entry[0][2] + m.entry[2][0]) / s);
+        }
+        if (m.entry[1][1] > m.entry[2][2]) {
+            const float s = std::sqrt(1.0f + m.entry[1][1] - m.entry[0][0] - m.entry[2][2]) * 2.0f;
+            return FromWXYZ((m.entry[0][2] - m.entry[2][0]) / s, (m.entry[0][1] + m.entry[1][0]) / s, 0.25f * s,
+                            (m.entry[1][2] + m.entry[2][1]) / s);
+        }
+        const float s = std::sqrt(1.0f + m.entry[2][2] - m.entry[0][0] - m.entry[1][1]) * 2.0f;
+        return FromWXYZ((m.entry[1][0] - m.entry[0][1]) / s, (m.entry[0][2] + m.entry[2][0]) / s,
+                        (m.entry[1][2] + m.entry[2][1]) / s, 0.25f * s);
+    }
+
+    RE::NiMatrix3 ToMatrix() const
+    {
+        alignas(16) float q[4];
+        _mm_store_ps(q, v);
+        const float w = q[0], x = q[1], y = q[2], z = q[3];
+
+        const float xx = x * x, yy = y * y, zz = z * z;
+        const float xy = x * y, xz = x * z, yz = y * z;
+        const float wx = w * x, wy = w * y, wz = w * z;
+
+        RE::NiMatrix3 m;
+        m.entry[0][0] = 1.0f - 2.0f * (yy + zz);
+        m.entry[0][1] = 2.0f * (xy - wz);
+        m.entry[0][2] = 2.0f * (xz + wy);
+
+        m.entry[1][0] = 2.0f * (xy + wz);
+        m.entry[1][1] = 1.0f - 2.0f * (xx + zz);
+        m.entry[1][2] = 2.0f * (yz - wx);
+
+        m.entry[2][0] = 2.0f * (xz - wy);
+        m.entry[2][1] = 2.0f * (yz + wx);
+        m.entry[2][2] = 1.0f - 2.0f * (xx + yy);
+
+        return m;
+    }
+
+    float Dot(const Quat& other) const { return detail::SumLanes(_mm_mul_ps(v, other.v)); }
+
+    Quat Normalize() const
+    {
+        const float len = std::sqrt(Dot(*this));
+        if (len < 0.0001f) {
+            return Identity();
+        }
+        return { _mm_div_ps(v, _mm_set1_ps(len)) };
+    }
+
+    // Shortest-path slerp; falls back to a normalized lerp for nearly equal inputs
+    static Quat Slerp(const Quat& a, const Quat& b, float t)
+    {
+        float dot = a.Dot(b);
+
+        __m128 b2 = b.v;
+        if (dot < 0.0f) {
+            dot = -dot;
+            b2 = _mm_xor_ps(b2, _mm_set1_ps(-0.0f));
+        }
+
+        if (dot > 0.9995f) {
+            return Quat{ _mm_add_ps(a.v, _mm_mul_ps(_mm_set1_ps(t), _mm_sub_ps(b2, a.v))) }.Normalize();
+        }
+
+        const float theta0 = std::acos(dot);
+        const float theta = theta0 * t;
+        const float sinTheta = std::sin(theta);
+        const float sinTheta0 = std::sin(theta0);
+
+        const float s0 = std::cos(theta) - dot * sinTheta / sinTheta0;
+        const float s1 = sinTheta / sinTheta0;
+
+        return Quat{ _mm_add_ps(_mm_mul_ps(_mm_set1_ps(s0), a.v), _mm_mul_ps(_mm_set1_ps(s1), b2)) }.Normalize();
+    }
+};
+
+} // namespace Util::SimdMath
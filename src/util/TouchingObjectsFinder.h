@@ -1,8 +1,8 @@
 #pragma once
 
 #include <RE/Skyrim.h>
+#include "FrameArena.h"
 #include <vector>
-#include <unordered_set>
 
 namespace Util {
 
@@ -11,6 +11,8 @@ namespace Util {
 //
 // Use case: When grabbing a table, automatically include plates/cups sitting on it
 //
+// The bounds and candidate filters live in Util::WorldQuery (shared with tests)
+//
 class TouchingObjectsFinder
 {
 public:
@@ -33,8 +35,9 @@ public:
     };
 
     // Find all objects that are touching/sitting on the given selection
-    // Returns objects NOT in the original selection that should be added
-    static std::vector<RE::TESObjectREFR*> FindTouchingObjects(
+    // Returns objects NOT in the original selection that should be added.
+    // The result lives in the frame arena - use it now, don't keep it.
+    static FrameVector<RE::TESObjectREFR*> FindTouchingObjects(
         const std::vector<RE::TESObjectREFR*>& selection,
         const Config& config = Config{});
 
@@ -43,26 +46,6 @@ public:
     static size_t AddTouchingObjectsToSelection(
         const std::vector<RE::TESObjectREFR*>& currentSelection,
         const Config& config = Config{});
-
-private:
-    // AABB structure for overlap testing
-    struct WorldAABB {
-        RE::NiPoint3 min;
-        RE::NiPoint3 max;
-
-        bool Overlaps(const WorldAABB& other) const;
-        void Expand(float amount);
-        RE::NiPoint3 Center() const;
-    };
-
-    // Get the world-space AABB of an object
-    static bool GetWorldAABB(RE::TESObjectREFR* ref, WorldAABB& outAABB);
-
-    // Check if an object's collision layer is valid for inclusion
-    static bool IsValidCollisionLayer(RE::TESObjectREFR* ref, const Config& config);
-
-    // Check if an object is moveable (has physics, not static architecture)
-    static bool IsMoveable(RE::TESObjectREFR* ref);
 };
 
 } // namespace Util
@@ -0,0 +1,284 @@
+#pragma once
+
+#if !defined(TEST_ENVIRONMENT)
+#include "RE/Skyrim.h"
+#else
+#include "TestStubs.h"
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+namespace Util::WorldQuery {
+
+// WorldQuery: Reference scans shared by the selection tools
+//
+// The per-reference filters and range loops of SphereSelectionController and
+// TouchingObjectsFinder live here, header-only, so they build against
+// TestStubs.h and run headless on the simulated world (Tests/SimulatedWorld.h).
+// The controllers own the input, visuals and selection state around them.
+
+// =============================================================================
+// Bounds
+// =============================================================================
+
+struct WorldAABB {
+    RE::NiPoint3 min;
+    RE::NiPoint3 max;
+
+    bool Overlaps(const WorldAABB& other) const
+    {
+        // Separated on any axis = no overlap
+        if (max.x < other.min.x || min.x > other.max.x) return false;
+        if (max.y < other.min.y || min.y > other.max.y) return false;
+        if (max.z < other.min.z || min.z > other.max.z) return false;
+        return true;
+    }
+
+    void Expand(float amount)
+    {
+        min.x -= amount;
+        min.y -= amount;
+        min.z -= amount;
+        max.x += amount;
+        max.y += amount;
+        max.z += amount;
+    }
+
+    RE::NiPoint3 Center() const
+    {
+        return RE::NiPoint3{ (min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f };
+    }
+};
+
+// World-space AABB of a reference: Havok rigid body if present (most accurate),
+// else the 3D bounding sphere, else a small box around the position
+inline bool GetWorldAABB(RE::TESObjectREFR* ref, WorldAABB& outAABB)
+{
+    if (!ref) {
+        return false;
+    }
+
+    auto* node3D = ref->Get3D();
+    if (!node3D) {
+        return false;
+    }
+
+    if (auto* collisionObj = node3D->GetCollisionObject()) {
+        if (auto* rigidBody = collisionObj->GetRigidBody()) {
+            RE::hkAabb havokAABB;
+            rigidBody->GetAabbWorldspace(havokAABB);
+
+            // Havok uses ~1/69.99 of Skyrim world scale
+            const float worldScale = RE::bhkWorld::GetWorldScaleInverse();
+
+            outAABB.min.x = havokAABB.min.quad.m128_f32[0] * worldScale;
+            outAABB.min.y = havokAABB.min.quad.m128_f32[1] * worldScale;
+            outAABB.min.z = havokAABB.min.quad.m128_f32[2] * worldScale;
+            outAABB.max.x = havokAABB.max.quad.m128_f32[0] * worldScale;
+            outAABB.max.y = havokAABB.max.quad.m128_f32[1] * worldScale;
+            outAABB.max.z = havokAABB.max.quad.m128_f32[2] * worldScale;
+            return true;
+        }
+    }
+
+    const auto& worldBound = node3D->worldBound;
+    if (worldBound.radius > 0.0f) {
+        const float radius = worldBound.radius;
+        const RE::NiPoint3 center = worldBound.center;
+        outAABB.min = RE::NiPoint3{ center.x - radius, center.y - radius, center.z - radius };
+        outAABB.max = RE::NiPoint3{ center.x + radius, center.y + radius, center.z + radius };
+        return true;
+    }
+
+    constexpr float kDefaultHalfSize = 20.0f;
+    const RE::NiPoint3 pos = ref->GetPosition();
+    outAABB.min = RE::NiPoint3{ pos.x - kDefaultHalfSize, pos.y - kDefaultHalfSize, pos.z - kDefaultHalfSize };
+    outAABB.max = RE::NiPoint3{ pos.x + kDefaultHalfSize, pos.y + kDefaultHalfSize, pos.z + kDefaultHalfSize };
+    return true;
+}
+
+// =============================================================================
+// Sphere selection
+// =============================================================================
+
+// Enabled, not deleted, 3D loaded, not an actor and of a placeable form type
+inline bool IsSphereSelectable(RE::TESObjectREFR* ref)
+{
+    if (!ref || ref->IsDisabled() || ref->IsDeleted() || !ref->Get3D()) {
+        return false;
+    }
+
+    auto* baseObj = ref->GetBaseObject();
+    if (!baseObj) {
+        return false;
+    }
+
+    // Sphere selection is for props/clutter - skip NPCs and creatures
+    if (ref->As<RE::Actor>()) {
+        return false;
+    }
+
+    switch (baseObj->GetFormType()) {
+        case RE::FormType::Static:
+        case RE::FormType::MovableStatic:
+        case RE::FormType::Container:
+        case RE::FormType::Door:
+        case RE::FormType::Light:
+        case RE::FormType::Furniture:
+        case RE::FormType::Activator:
+        case RE::FormType::Tree:
+        case RE::FormType::Flora:
+        case RE::FormType::Misc:
+        case RE::FormType::Weapon:
+        case RE::FormType::Grass:
+        case RE::FormType::Armor:
+        case RE::FormType::Book:
+        case RE::FormType::IdleMarker:
+        case RE::FormType::Ingredient:
+        case RE::FormType::AnimatedObject:
+        case RE::FormType::AlchemyItem:
+        case RE::FormType::Ammo:
+        case RE::FormType::Scroll:
+        case RE::FormType::SoulGem:
+        case RE::FormType::ArtObject:
+        case RE::FormType::VolumetricLighting:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Append every selectable reference within radius of center to out (not cleared).
+// ForEachReferenceInRange is centred on the player, so the search radius is grown
+// to reach a sphere placed away from them, then refined per reference.
+// passesFilter(ref) is the caller's extra filter (Selection::ObjectFilter in game).
+// out may use any allocator (e.g. a Util::FrameVector).
+template <typename Filter, typename Alloc>
+void CollectInSphere(RE::TES* tes, RE::TESObjectREFR* player, const RE::NiPoint3& center, float radius,
+                     Filter&& passesFilter, std::vector<RE::TESObjectREFR*, Alloc>& out)
+{
+    if (!tes || !player) {
+        return;
+    }
+
+    const RE::NiPoint3 toPlayer = center - player->GetPosition();
+    const float searchRadius = radius * 2.0f + toPlayer.Length();
+    const float radiusSquared = radius * radius;
+
+    tes->ForEachReferenceInRange(player, searchRadius, [&](RE::TESObjectREFR* ref) -> RE::BSContainer::ForEachResult {
+        if (!ref || ref == player || !IsSphereSelectable(ref) || !passesFilter(ref)) {
+            return RE::BSContainer::ForEachResult::kContinue;
+        }
+
+        const RE::NiPoint3 d = ref->GetPosition() - center;
+        if (d.x * d.x + d.y * d.y + d.z * d.z <= radiusSquared) {
+            out.push_back(ref);
+        }
+        return RE::BSContainer::ForEachResult::kContinue;
+    });
+}
+
+// =============================================================================
+// Touching objects
+// =============================================================================
+
+// Loose physics objects only - no actors, doors, containers, activators, statics,
+// and the 3D must have a collision object
+inline bool IsMoveable(RE::TESObjectREFR* ref)
+{
+    if (!ref || !ref->Get3D()) {
+        return false;
+    }
+
+    if (ref->As<RE::Actor>()) {
+        return false;
+    }
+
+    if (auto* baseObj = ref->GetBaseObject()) {
+        if (baseObj->Is(RE::FormType::Door) || baseObj->Is(RE::FormType::Container) ||
+            baseObj->Is(RE::FormType::Activator) || baseObj->Is(RE::FormType::Static)) {
+            return false;
+        }
+    }
+
+    // No physics = probably not moveable
+    return ref->Get3D()->GetCollisionObject() != nullptr;
+}
+
+// Clutter, weapons and small debris always; props unless excluded; anim statics
+// only when the search is not clutter-only
+inline bool IsTouchableLayer(RE::TESObjectREFR* ref, bool includeProps, bool clutterOnly)
+{
+    auto* node3D = ref->Get3D();
+    if (!node3D) {
+        return false;
+    }
+
+    switch (node3D->GetCollisionLayer()) {
+        case RE::COL_LAYER::kClutter:
+        case RE::COL_LAYER::kWeapon:
+        case RE::COL_LAYER::kDebrisSmall:
+            return true;
+        case RE::COL_LAYER::kProps:
+            return includeProps;
+        case RE::COL_LAYER::kAnimStatic:
+            return !clutterOnly;
+        default:
+            return false;
+    }
+}
+
+struct TouchingParams {
+    float searchRadius = 500.0f;
+    bool includeProps = true;
+    bool clutterOnly = true;
+    size_t maxResults = 50;
+};
+
+// Append references in cell (within searchRadius of center) whose AABB overlaps
+// any of selectionAABBs. References in excluded (any set of FormIDs) are skipped;
+// stops at maxResults.
+template <typename ExcludedSet, typename Alloc>
+void CollectTouching(RE::TESObjectCELL* cell, const RE::NiPoint3& center, std::span<const WorldAABB> selectionAABBs,
+                     const ExcludedSet& excluded, const TouchingParams& params,
+                     std::vector<RE::TESObjectREFR*, Alloc>& out)
+{
+    if (!cell) {
+        return;
+    }
+
+    cell->ForEachReferenceInRange(center, params.searchRadius,
+        [&](RE::TESObjectREFR* candidate) -> RE::BSContainer::ForEachResult {
+            if (out.size() >= params.maxResults) {
+                return RE::BSContainer::ForEachResult::kStop;
+            }
+
+            if (!candidate || excluded.contains(candidate->GetFormID()) || !candidate->Get3D() ||
+                candidate->IsDeleted() || candidate->IsDisabled()) {
+                return RE::BSContainer::ForEachResult::kContinue;
+            }
+
+            if (!IsMoveable(candidate) || !IsTouchableLayer(candidate, params.includeProps, params.clutterOnly)) {
+                return RE::BSContainer::ForEachResult::kContinue;
+            }
+
+            WorldAABB candidateAABB;
+            if (!GetWorldAABB(candidate, candidateAABB)) {
+                return RE::BSContainer::ForEachResult::kContinue;
+            }
+
+            for (const auto& selectionAABB : selectionAABBs) {
+                if (candidateAABB.Overlaps(selectionAABB)) {
+                    out.push_back(candidate);
+                    break;
+                }
+            }
+            return RE::BSContainer::ForEachResult::kContinue;
+        });
+}
+
+} // namespace Util::WorldQuery